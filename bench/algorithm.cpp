@@ -0,0 +1,608 @@
+/* (c) 2026 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки SAGA.
+
+SAGA -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+/** @file bench/algorithm.cpp
+ @brief Замеры производительности алгоритмов из saga/algorithm.hpp
+*/
+
+#include "bench.hpp"
+
+#include <saga/algorithm.hpp>
+#include <saga/algorithm/batch_search.hpp>
+#include <saga/cursor/cycle.hpp>
+#include <saga/cursor/merge_k.hpp>
+#include <saga/cursor/stride.hpp>
+#include <saga/cursor/subrange.hpp>
+#include <saga/cursor/take.hpp>
+#include <saga/numeric.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <queue>
+#include <random>
+
+namespace
+{
+    using Value = int;
+
+    // Сортировка
+    template <class Sort>
+    void bench_sort(saga_bench::bench_state & state, Sort sort)
+    {
+        auto const src = saga_bench::make_data(state.size(), state.distribution());
+        auto data = src;
+
+        state.measure([&] { data = src; }
+                      , [&] { sort(data); saga_bench::do_not_optimize(data.data()); });
+    }
+
+    void register_sorting(saga_bench::registry & reg)
+    {
+        auto const sizes = saga_bench::default_sizes();
+        auto const distributions = saga_bench::all_distributions();
+
+        reg.add({"sort", "int", "saga", sizes, distributions, [](saga_bench::bench_state & state)
+        {
+            bench_sort(state, [](std::vector<Value> & data)
+                       { saga::sort(saga::cursor::all(data)); });
+        }});
+
+        reg.add({"sort", "int", "std", sizes, distributions, [](saga_bench::bench_state & state)
+        {
+            bench_sort(state, [](std::vector<Value> & data)
+                       { std::sort(data.begin(), data.end()); });
+        }});
+
+        reg.add({"stable_sort", "int", "saga", sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            bench_sort(state, [](std::vector<Value> & data)
+                       { saga::stable_sort(saga::cursor::all(data)); });
+        }});
+
+        reg.add({"stable_sort", "int", "std", sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            bench_sort(state, [](std::vector<Value> & data)
+                       { std::stable_sort(data.begin(), data.end()); });
+        }});
+
+        reg.add({"nth_element", "median", "saga", sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            bench_sort(state, [](std::vector<Value> & data)
+            {
+                saga::nth_element(saga::cursor::drop_front_n(saga::cursor::all(data)
+                                                             , data.size() / 2));
+            });
+        }});
+
+        reg.add({"nth_element", "median", "std", sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            bench_sort(state, [](std::vector<Value> & data)
+                       { std::nth_element(data.begin(), data.begin() + data.size() / 2
+                                          , data.end()); });
+        }});
+    }
+
+    // Операции над множествами
+    template <class SetOperation>
+    void bench_set_operation(saga_bench::bench_state & state, SetOperation operation)
+    {
+        auto lhs = saga_bench::make_data(state.size(), state.distribution(), 1);
+        auto rhs = saga_bench::make_data(state.size(), state.distribution(), 2);
+
+        std::sort(lhs.begin(), lhs.end());
+        std::sort(rhs.begin(), rhs.end());
+
+        std::vector<Value> out(lhs.size() + rhs.size());
+
+        state.measure([&]
+        {
+            saga_bench::do_not_optimize(operation(lhs, rhs, out));
+        });
+    }
+
+    void register_set_operations(saga_bench::registry & reg)
+    {
+        auto const sizes = saga_bench::default_sizes();
+        auto const distributions = std::vector<std::string>{"random", "few_unique"};
+
+#define SAGA_BENCH_SET_OPERATION(Name) \
+        reg.add({#Name, "int", "saga", sizes, distributions, [](saga_bench::bench_state & state) \
+        { \
+            bench_set_operation(state, [](auto const & lhs, auto const & rhs, auto & out) \
+            { \
+                return saga::Name(saga::cursor::all(lhs), saga::cursor::all(rhs) \
+                                  , saga::cursor::all(out)).out.size(); \
+            }); \
+        }}); \
+        reg.add({#Name, "int", "std", sizes, distributions, [](saga_bench::bench_state & state) \
+        { \
+            bench_set_operation(state, [](auto const & lhs, auto const & rhs, auto & out) \
+            { \
+                return out.end() - std::Name(lhs.begin(), lhs.end(), rhs.begin(), rhs.end() \
+                                            , out.begin()); \
+            }); \
+        }})
+
+        SAGA_BENCH_SET_OPERATION(set_union);
+        SAGA_BENCH_SET_OPERATION(set_intersection);
+        SAGA_BENCH_SET_OPERATION(set_difference);
+
+#undef SAGA_BENCH_SET_OPERATION
+    }
+
+    // Упорядоченный список из num различных значений из интервала [0, 4 * size]
+    std::vector<Value> make_posting_list(std::size_t size, std::size_t num, unsigned seed)
+    {
+        std::mt19937 rnd(seed);
+        std::uniform_int_distribution<Value> distr(0, static_cast<Value>(4 * size));
+
+        std::vector<Value> result(num);
+        std::generate(result.begin(), result.end(), [&] { return distr(rnd); });
+
+        std::sort(result.begin(), result.end());
+        result.erase(std::unique(result.begin(), result.end()), result.end());
+
+        return result;
+    }
+
+    /* Пересечение списков сильно различающихся размеров: size, size / 10 и size / 1000
+    элементов
+    */
+    void register_set_operations_adaptive(saga_bench::registry & reg)
+    {
+        auto const sizes = std::vector<std::size_t>{100'000, 1'000'000, 10'000'000};
+        auto const distributions = saga_bench::random_distribution_only();
+
+        reg.add({"set_intersection", "skewed", "saga", sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            auto const large = make_posting_list(state.size(), state.size(), 1);
+            auto const small = make_posting_list(state.size(), state.size() / 1000, 2);
+            std::vector<Value> out;
+
+            state.measure([&] { out.clear(); }, [&]
+            {
+                saga::set_intersection_adaptive(saga::cursor::all(large), saga::cursor::all(small)
+                                               , saga::back_inserter(out));
+                saga_bench::do_not_optimize(out.data());
+            });
+        }});
+
+        reg.add({"set_intersection", "skewed", "std", sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            auto const large = make_posting_list(state.size(), state.size(), 1);
+            auto const small = make_posting_list(state.size(), state.size() / 1000, 2);
+            std::vector<Value> out;
+
+            state.measure([&] { out.clear(); }, [&]
+            {
+                std::set_intersection(large.begin(), large.end(), small.begin(), small.end()
+                                     , std::back_inserter(out));
+                saga_bench::do_not_optimize(out.data());
+            });
+        }});
+
+        reg.add({"set_intersection_k", "3_lists", "saga", sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            std::vector<std::vector<Value>> const lists
+                = {make_posting_list(state.size(), state.size(), 1)
+                  , make_posting_list(state.size(), state.size() / 10, 2)
+                  , make_posting_list(state.size(), state.size() / 1000, 3)};
+            std::vector<Value> out;
+
+            state.measure([&] { out.clear(); }, [&]
+            {
+                std::vector<saga::subrange_cursor<std::vector<Value>::const_iterator>> inputs;
+                for(auto const & list : lists)
+                {
+                    inputs.push_back(saga::cursor::all(list));
+                }
+
+                saga::set_intersection_k(inputs, saga::back_inserter(out));
+                saga_bench::do_not_optimize(out.data());
+            });
+        }});
+
+        reg.add({"set_intersection_k", "3_lists", "std", sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            std::vector<std::vector<Value>> const lists
+                = {make_posting_list(state.size(), state.size(), 1)
+                  , make_posting_list(state.size(), state.size() / 10, 2)
+                  , make_posting_list(state.size(), state.size() / 1000, 3)};
+            std::vector<Value> temp;
+            std::vector<Value> out;
+
+            state.measure([&] { temp.clear(); out.clear(); }, [&]
+            {
+                std::set_intersection(lists[0].begin(), lists[0].end()
+                                     , lists[1].begin(), lists[1].end()
+                                     , std::back_inserter(temp));
+                std::set_intersection(temp.begin(), temp.end(), lists[2].begin(), lists[2].end()
+                                     , std::back_inserter(out));
+                saga_bench::do_not_optimize(out.data());
+            });
+        }});
+    }
+
+    // Поиск и подсчёт (векторизованные реализации)
+    void register_searching(saga_bench::registry & reg)
+    {
+        auto const sizes = saga_bench::default_sizes();
+        auto const distributions = std::vector<std::string>{"few_unique"};
+
+        reg.add({"count", "int", "saga", sizes, distributions, [](saga_bench::bench_state & state)
+        {
+            auto const data = saga_bench::make_data(state.size(), state.distribution());
+
+            state.measure([&]
+            { saga_bench::do_not_optimize(saga::count(saga::cursor::all(data), 7)); });
+        }});
+
+        reg.add({"count", "int", "std", sizes, distributions, [](saga_bench::bench_state & state)
+        {
+            auto const data = saga_bench::make_data(state.size(), state.distribution());
+
+            state.measure([&]
+            { saga_bench::do_not_optimize(std::count(data.begin(), data.end(), 7)); });
+        }});
+
+        reg.add({"mismatch", "int", "saga", sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            auto const lhs = saga_bench::make_data(state.size(), state.distribution());
+            auto rhs = lhs;
+            rhs.back() += 1;
+
+            state.measure([&]
+            {
+                auto const result = saga::mismatch(saga::cursor::all(lhs), saga::cursor::all(rhs));
+                saga_bench::do_not_optimize(result.in1.size());
+            });
+        }});
+
+        reg.add({"mismatch", "int", "std", sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            auto const lhs = saga_bench::make_data(state.size(), state.distribution());
+            auto rhs = lhs;
+            rhs.back() += 1;
+
+            state.measure([&]
+            {
+                auto const result = std::mismatch(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+                saga_bench::do_not_optimize(result.first);
+            });
+        }});
+    }
+
+    /// @brief Запросы для поиска в make_data(num): 10^6 значений из того же интервала
+    std::vector<int> make_search_queries(std::size_t num, bool sorted)
+    {
+        std::mt19937 rnd(2);
+        std::uniform_int_distribution<int> distr(0, static_cast<int>(4 * num));
+
+        std::vector<int> result(1'000'000);
+        std::generate(result.begin(), result.end(), [&] { return distr(rnd); });
+
+        if(sorted)
+        {
+            std::sort(result.begin(), result.end());
+        }
+
+        return result;
+    }
+
+    template <class Search>
+    void measure_batch_search(saga_bench::bench_state & state, Search search)
+    {
+        auto data = saga_bench::make_data(state.size(), state.distribution());
+        std::sort(data.begin(), data.end());
+
+        auto const queries = make_search_queries(state.size(), state.distribution() == "sorted");
+
+        std::vector<std::ptrdiff_t> positions(queries.size());
+
+        state.measure([&]
+        {
+            search(data, queries, positions);
+            saga_bench::do_not_optimize(positions.data());
+        });
+    }
+
+    template <class LowerBound>
+    void measure_lower_bound(saga_bench::bench_state & state, LowerBound lower_bound)
+    {
+        auto data = saga_bench::make_data(state.size(), state.distribution());
+        std::sort(data.begin(), data.end());
+
+        auto const queries = make_search_queries(state.size(), false);
+
+        state.measure([&]
+        {
+            auto sum = std::ptrdiff_t(0);
+
+            for(auto const & query : queries)
+            {
+                sum += lower_bound(data, query);
+            }
+
+            saga_bench::do_not_optimize(sum);
+        });
+    }
+
+    // Размеры от помещающихся в кэш L1 до многократно превосходящих кэш последнего уровня
+    void register_lower_bound(saga_bench::registry & reg)
+    {
+        auto const sizes = std::vector<std::size_t>{1'000, 10'000, 100'000, 1'000'000
+                                                   , 10'000'000};
+        auto const distributions = saga_bench::random_distribution_only();
+
+        reg.add({"lower_bound", "int", "saga", sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            measure_lower_bound(state, [](auto const & data, int query)
+            { return saga::lower_bound(saga::cursor::all(data), query).begin() - data.begin(); });
+        }});
+
+        reg.add({"lower_bound", "int", "std", sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            measure_lower_bound(state, [](auto const & data, int query)
+            { return std::lower_bound(data.begin(), data.end(), query) - data.begin(); });
+        }});
+    }
+
+    /* Поиск 10^6 значений: по одному с помощью std::lower_bound и пакетом. Упорядоченные
+    запросы (распределение "sorted") обрабатываются слиянием.
+    */
+    void register_batch_search(saga_bench::registry & reg)
+    {
+        auto const sizes = std::vector<std::size_t>{10'000, 1'000'000, 10'000'000};
+        auto const distributions = std::vector<std::string>{"random", "sorted"};
+
+        reg.add({"lower_bound_batch", "int", "saga", sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            measure_batch_search(state, [](auto const & data, auto const & queries, auto & out)
+            {
+                saga::lower_bound_batch(saga::cursor::all(data), saga::cursor::all(queries)
+                                       , saga::cursor::all(out));
+            });
+        }});
+
+        reg.add({"lower_bound_batch", "int", "std", sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            measure_batch_search(state, [](auto const & data, auto const & queries, auto & out)
+            {
+                auto pos = out.begin();
+
+                for(auto const & query : queries)
+                {
+                    *pos = std::lower_bound(data.begin(), data.end(), query) - data.begin();
+                    ++pos;
+                }
+            });
+        }});
+    }
+
+    /* Сегментированный обход адаптеров курсоров сравнивается с рукописными циклами: при
+    одинаковом сгенерированном коде время должно совпадать.
+    */
+    void register_segmented(saga_bench::registry & reg)
+    {
+        auto const sizes = saga_bench::default_sizes();
+        auto const distributions = saga_bench::random_distribution_only();
+
+        reg.add({"reduce", "subrange", "saga", sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            auto const data = saga_bench::make_data(state.size(), state.distribution());
+
+            state.measure([&]
+            { saga_bench::do_not_optimize(saga::reduce(saga::cursor::all(data))); });
+        }});
+
+        reg.add({"reduce", "subrange", "std", sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            auto const data = saga_bench::make_data(state.size(), state.distribution());
+
+            state.measure([&]
+            { saga_bench::do_not_optimize(std::accumulate(data.begin(), data.end(), 0)); });
+        }});
+
+        reg.add({"for_each", "take_cycle", "saga", sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            auto const data = saga_bench::make_data(state.size() / 4 + 1, state.distribution());
+
+            state.measure([&]
+            {
+                auto sum = Value(0);
+                auto input = saga::cursor::take(saga::cursor::make_cycled(saga::cursor::all(data))
+                                                , state.size());
+
+                saga::for_each(std::move(input), [&](Value const & arg) { sum += arg; });
+
+                saga_bench::do_not_optimize(sum);
+            });
+        }});
+
+        reg.add({"for_each", "take_cycle", "raw", sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            auto const data = saga_bench::make_data(state.size() / 4 + 1, state.distribution());
+
+            state.measure([&]
+            {
+                auto sum = Value(0);
+
+                for(auto rest = state.size(); rest > 0;)
+                {
+                    auto const num = std::min(rest, data.size());
+
+                    for(auto index = std::size_t(0); index < num; ++index)
+                    {
+                        sum += data[index];
+                    }
+
+                    rest -= num;
+                }
+
+                saga_bench::do_not_optimize(sum);
+            });
+        }});
+
+        reg.add({"reduce", "stride_3", "saga", sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            auto const data = saga_bench::make_data(state.size(), state.distribution());
+
+            state.measure([&]
+            {
+                auto const input = saga::cursor::stride(saga::cursor::all(data), 3);
+                saga_bench::do_not_optimize(saga::reduce(input));
+            });
+        }});
+
+        reg.add({"reduce", "stride_3", "raw", sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            auto const data = saga_bench::make_data(state.size(), state.distribution());
+
+            state.measure([&]
+            {
+                auto sum = Value(0);
+
+                for(auto index = std::size_t(0); index < data.size(); index += 3)
+                {
+                    sum += data[index];
+                }
+
+                saga_bench::do_not_optimize(sum);
+            });
+        }});
+    }
+
+    /* Слияние k упорядоченных последовательностей с помощью дерева проигравших сравнивается со
+    слиянием на основе двоичной кучи.
+    */
+    std::vector<std::vector<Value>> make_runs(saga_bench::bench_state const & state
+                                             , std::size_t run_count)
+    {
+        auto const data = saga_bench::make_data(state.size(), state.distribution());
+
+        std::vector<std::vector<Value>> runs(run_count);
+        for(auto index = std::size_t(0); index < data.size(); ++index)
+        {
+            runs[index % run_count].push_back(data[index]);
+        }
+
+        for(auto & run : runs)
+        {
+            std::sort(run.begin(), run.end());
+        }
+
+        return runs;
+    }
+
+    void register_merging(saga_bench::registry & reg)
+    {
+        auto const sizes = saga_bench::default_sizes();
+        auto const distributions = saga_bench::random_distribution_only();
+        auto const run_count = std::size_t(16);
+
+        reg.add({"merge_k", "16_runs", "saga", sizes, distributions
+                , [=](saga_bench::bench_state & state)
+        {
+            auto const runs = make_runs(state, run_count);
+            std::vector<Value> out;
+            out.reserve(state.size());
+
+            state.measure([&] { out.clear(); }, [&]
+            {
+                std::vector<saga::subrange_cursor<std::vector<Value>::const_iterator>> inputs;
+                for(auto const & run : runs)
+                {
+                    inputs.push_back(saga::cursor::all(run));
+                }
+
+                saga::copy(saga::cursor::merge_k(std::move(inputs)), saga::back_inserter(out));
+                saga_bench::do_not_optimize(out.data());
+            });
+        }});
+
+        reg.add({"merge_k", "16_runs", "std", sizes, distributions
+                , [=](saga_bench::bench_state & state)
+        {
+            auto const runs = make_runs(state, run_count);
+            std::vector<Value> out;
+            out.reserve(state.size());
+
+            state.measure([&] { out.clear(); }, [&]
+            {
+                using Position = std::pair<Value, std::size_t>;
+                std::priority_queue<Position, std::vector<Position>, std::greater<>> heap;
+                std::vector<std::size_t> positions(runs.size(), 0);
+
+                for(auto index = std::size_t(0); index < runs.size(); ++index)
+                {
+                    if(!runs[index].empty())
+                    {
+                        heap.emplace(runs[index].front(), index);
+                    }
+                }
+
+                for(; !heap.empty();)
+                {
+                    auto const index = heap.top().second;
+                    out.push_back(heap.top().first);
+                    heap.pop();
+
+                    if(++positions[index] < runs[index].size())
+                    {
+                        heap.emplace(runs[index][positions[index]], index);
+                    }
+                }
+
+                saga_bench::do_not_optimize(out.data());
+            });
+        }});
+    }
+}
+// namespace
+
+void saga_bench::register_algorithm_benchmarks(registry & reg)
+{
+    register_sorting(reg);
+    register_set_operations(reg);
+    register_set_operations_adaptive(reg);
+    register_searching(reg);
+    register_lower_bound(reg);
+    register_batch_search(reg);
+    register_segmented(reg);
+    register_merging(reg);
+}
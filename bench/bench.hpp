@@ -0,0 +1,541 @@
+/* (c) 2026 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки SAGA.
+
+SAGA -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#ifndef Z_SAGA_BENCH_BENCH_HPP_INCLUDED
+#define Z_SAGA_BENCH_BENCH_HPP_INCLUDED
+
+/** @file bench/bench.hpp
+ @brief Простая инфраструктура для измерения производительности алгоритмов
+
+ Каждый замер (bench_case) относится к группе (например, "sort"), имеет название варианта и
+ реализации ("saga" или эталонные "std" и "raw" -- рукописный цикл) и выполняется для нескольких
+ размеров и распределений входных данных. Результаты выводятся в формате CSV или JSON, CSV-файл
+ может служить эталоном при последующих запусках для поиска регрессий.
+
+ Помимо времени, для каждого замера подсчитывается количество динамических выделений памяти, а по
+ запросу -- значения аппаратных счётчиков (см. saga/test/hardware_counters.hpp).
+*/
+
+#include <saga/test/allocation_counter.hpp>
+#include <saga/test/hardware_counters.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <istream>
+#include <numeric>
+#include <ostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace saga_bench
+{
+    /// @brief Средние значения счётчиков за одно повторение замера
+    struct bench_counters
+    {
+        double allocations = 0;
+        double allocated_bytes = 0;
+        saga::hardware_counts hardware;
+    };
+
+    /// @brief Состояние одного замера: параметры и результаты измерений
+    class bench_state
+    {
+    public:
+        // Создание, копирование, уничтожение
+        bench_state(std::size_t size, std::string distribution, std::size_t repetitions
+                    , saga::hardware_counters * hardware = nullptr)
+         : size_(size)
+         , distribution_(std::move(distribution))
+         , repetitions_(repetitions)
+         , hardware_(hardware)
+        {}
+
+        // Параметры
+        std::size_t size() const
+        {
+            return this->size_;
+        }
+
+        std::string const & distribution() const
+        {
+            return this->distribution_;
+        }
+
+        /** @brief Измерение времени выполнения функции @c run
+        @param setup функция подготовки данных, которая вызывается перед каждым повторением; время
+        её выполнения не учитывается
+        @param run измеряемая функция
+        */
+        template <class Setup, class Run>
+        void measure(Setup setup, Run run)
+        {
+            using Clock = std::chrono::steady_clock;
+
+            this->times_.clear();
+            this->counters_ = bench_counters{};
+
+            auto allocations = saga::allocation_counts{};
+            auto hardware = std::array<std::int64_t, 4>{};
+
+            for(auto rep = std::size_t(0); rep < this->repetitions_; ++rep)
+            {
+                setup();
+
+                saga::allocation_counter const allocation_counter;
+
+                if(this->hardware_)
+                {
+                    this->hardware_->start();
+                }
+
+                auto const start = Clock::now();
+                run();
+                auto const finish = Clock::now();
+
+                if(this->hardware_)
+                {
+                    auto const counts = this->hardware_->stop();
+
+                    hardware[0] += counts.cycles;
+                    hardware[1] += counts.instructions;
+                    hardware[2] += counts.cache_misses;
+                    hardware[3] += counts.branch_misses;
+                }
+
+                auto const allocated = allocation_counter.counts();
+                allocations.allocations += allocated.allocations;
+                allocations.allocated_bytes += allocated.allocated_bytes;
+
+                this->times_.push_back(std::chrono::duration<double, std::nano>(finish - start)
+                                       .count());
+            }
+
+            auto const reps = static_cast<double>(std::max<std::size_t>(this->repetitions_, 1));
+
+            this->counters_.allocations = allocations.allocations / reps;
+            this->counters_.allocated_bytes = allocations.allocated_bytes / reps;
+
+            // Недоступные счётчики возвращают -1 при каждом повторении
+            auto const average = [&](std::int64_t total)
+                { return total < 0 ? std::int64_t(-1) : static_cast<std::int64_t>(total / reps); };
+
+            if(this->hardware_)
+            {
+                this->counters_.hardware = {average(hardware[0]), average(hardware[1])
+                                           , average(hardware[2]), average(hardware[3])};
+            }
+        }
+
+        template <class Run>
+        void measure(Run run)
+        {
+            return this->measure([]{}, std::move(run));
+        }
+
+        // Результаты
+        std::vector<double> const & times() const
+        {
+            return this->times_;
+        }
+
+        bench_counters const & counters() const
+        {
+            return this->counters_;
+        }
+
+    private:
+        std::size_t size_ = 0;
+        std::string distribution_;
+        std::size_t repetitions_ = 1;
+        saga::hardware_counters * hardware_ = nullptr;
+        std::vector<double> times_;
+        bench_counters counters_;
+    };
+
+    /// @brief Предотвращение удаления оптимизатором вычислений, результат которых не используется
+    template <class T>
+    void do_not_optimize(T const & value)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        static volatile char const * sink = nullptr;
+        sink = reinterpret_cast<char const *>(&value);
+#endif
+    }
+
+    /// @brief Описание замера
+    struct bench_case
+    {
+        std::string group;
+        std::string name;
+        std::string impl;
+        std::vector<std::size_t> sizes;
+        std::vector<std::string> distributions;
+        std::function<void(bench_state &)> body;
+    };
+
+    /// @brief Реестр замеров
+    class registry
+    {
+    public:
+        void add(bench_case info)
+        {
+            this->cases_.push_back(std::move(info));
+        }
+
+        std::vector<bench_case> const & cases() const
+        {
+            return this->cases_;
+        }
+
+    private:
+        std::vector<bench_case> cases_;
+    };
+
+    void register_algorithm_benchmarks(registry & reg);
+    void register_container_benchmarks(registry & reg);
+    void register_numeric_benchmarks(registry & reg);
+    void register_optimization_benchmarks(registry & reg);
+
+    // Стандартные параметры
+    inline std::vector<std::size_t> default_sizes()
+    {
+        return {1000, 100'000, 1'000'000};
+    }
+
+    inline std::vector<std::string> all_distributions()
+    {
+        return {"random", "sorted", "reversed", "few_unique"};
+    }
+
+    inline std::vector<std::string> random_distribution_only()
+    {
+        return {"random"};
+    }
+
+    /** @brief Данные для замера
+    @param num размер
+    @param distribution распределение: "random" -- равномерное, "sorted" -- по возрастанию,
+    "reversed" -- по убыванию, "few_unique" -- случайные значения из небольшого множества
+    @param seed начальное значение генератора случайных чисел, замеры, которым нужны
+    разные последовательности одного размера, должны использовать разные значения
+    */
+    inline std::vector<int> make_data(std::size_t num, std::string const & distribution
+                                      , unsigned seed = 20260101)
+    {
+        std::mt19937 rnd(seed);
+
+        std::vector<int> result(num);
+
+        if(distribution == "few_unique")
+        {
+            std::uniform_int_distribution<int> distr(0, 15);
+            std::generate(result.begin(), result.end(), [&] { return distr(rnd); });
+            return result;
+        }
+
+        std::uniform_int_distribution<int> distr(0, static_cast<int>(4 * num));
+        std::generate(result.begin(), result.end(), [&] { return distr(rnd); });
+
+        if(distribution == "sorted")
+        {
+            std::sort(result.begin(), result.end());
+        }
+        else if(distribution == "reversed")
+        {
+            std::sort(result.begin(), result.end(), std::greater<>{});
+        }
+
+        return result;
+    }
+
+    /// @brief Результат замера
+    struct bench_result
+    {
+        std::string group;
+        std::string name;
+        std::string impl;
+        std::string distribution;
+        std::size_t size = 0;
+        std::size_t repetitions = 0;
+        double min_ns = 0;
+        double median_ns = 0;
+        double mean_ns = 0;
+        bench_counters counters;
+
+        std::string key() const
+        {
+            return this->group + '/' + this->name + '/' + this->distribution + '/'
+                   + std::to_string(this->size);
+        }
+    };
+
+    inline bench_result make_result(bench_case const & info, bench_state const & state)
+    {
+        auto times = state.times();
+
+        bench_result result;
+        result.group = info.group;
+        result.name = info.name;
+        result.impl = info.impl;
+        result.distribution = state.distribution();
+        result.size = state.size();
+        result.repetitions = times.size();
+        result.counters = state.counters();
+
+        if(!times.empty())
+        {
+            std::sort(times.begin(), times.end());
+
+            result.min_ns = times.front();
+            result.median_ns = times[times.size() / 2];
+            result.mean_ns = std::accumulate(times.begin(), times.end(), 0.0) / times.size();
+        }
+
+        return result;
+    }
+
+    /// @brief Является ли реализация эталонной: из стандартной библиотеки или рукописным циклом
+    inline bool is_reference_impl(std::string const & impl)
+    {
+        return impl == "std" || impl == "raw";
+    }
+
+    /** @brief Отношение медианного времени к времени эталонной реализации (из std или рукописного
+    цикла) того же замера
+    @return Отношение или отрицательное число, если соответствующего замера нет
+    */
+    inline double ratio_to_reference(bench_result const & result
+                                     , std::vector<bench_result> const & all)
+    {
+        if(saga_bench::is_reference_impl(result.impl))
+        {
+            return -1;
+        }
+
+        for(auto const & other : all)
+        {
+            if(saga_bench::is_reference_impl(other.impl) && other.key() == result.key()
+               && other.median_ns > 0)
+            {
+                return result.median_ns / other.median_ns;
+            }
+        }
+
+        return -1;
+    }
+
+    // Вывод
+    inline void write_counter(std::ostream & os, std::int64_t value)
+    {
+        if(value >= 0)
+        {
+            os << value;
+        }
+    }
+
+    inline void write_csv(std::ostream & os, std::vector<bench_result> const & results)
+    {
+        os << "group,name,impl,distribution,size,repetitions,min_ns,median_ns,mean_ns"
+           << ",ns_per_element,ratio_to_reference,allocations,allocated_bytes"
+           << ",cycles,instructions,cache_misses,branch_misses\n";
+
+        for(auto const & result : results)
+        {
+            auto const ratio = saga_bench::ratio_to_reference(result, results);
+
+            os << result.group << ',' << result.name << ',' << result.impl << ','
+               << result.distribution << ',' << result.size << ',' << result.repetitions << ','
+               << result.min_ns << ',' << result.median_ns << ',' << result.mean_ns << ','
+               << result.median_ns / std::max<std::size_t>(result.size, 1) << ',';
+
+            if(ratio >= 0)
+            {
+                os << ratio;
+            }
+
+            auto const & hardware = result.counters.hardware;
+
+            os << ',' << result.counters.allocations << ',' << result.counters.allocated_bytes;
+            os << ',';
+            saga_bench::write_counter(os, hardware.cycles);
+            os << ',';
+            saga_bench::write_counter(os, hardware.instructions);
+            os << ',';
+            saga_bench::write_counter(os, hardware.cache_misses);
+            os << ',';
+            saga_bench::write_counter(os, hardware.branch_misses);
+            os << '\n';
+        }
+    }
+
+    inline void write_json(std::ostream & os, std::vector<bench_result> const & results)
+    {
+        os << "[\n";
+
+        for(auto index = std::size_t(0); index < results.size(); ++index)
+        {
+            auto const & result = results[index];
+            auto const ratio = saga_bench::ratio_to_reference(result, results);
+
+            os << "  {\"group\": \"" << result.group << "\", \"name\": \"" << result.name
+               << "\", \"impl\": \"" << result.impl
+               << "\", \"distribution\": \"" << result.distribution
+               << "\", \"size\": " << result.size
+               << ", \"repetitions\": " << result.repetitions
+               << ", \"min_ns\": " << result.min_ns
+               << ", \"median_ns\": " << result.median_ns
+               << ", \"mean_ns\": " << result.mean_ns
+               << ", \"ratio_to_reference\": ";
+
+            if(ratio >= 0)
+            {
+                os << ratio;
+            }
+            else
+            {
+                os << "null";
+            }
+
+            auto const & hardware = result.counters.hardware;
+
+            os << ", \"allocations\": " << result.counters.allocations
+               << ", \"allocated_bytes\": " << result.counters.allocated_bytes;
+
+            auto const write_json_counter = [&os](char const * name, std::int64_t value)
+            {
+                os << ", \"" << name << "\": ";
+
+                if(value >= 0)
+                {
+                    os << value;
+                }
+                else
+                {
+                    os << "null";
+                }
+            };
+
+            write_json_counter("cycles", hardware.cycles);
+            write_json_counter("instructions", hardware.instructions);
+            write_json_counter("cache_misses", hardware.cache_misses);
+            write_json_counter("branch_misses", hardware.branch_misses);
+
+            os << '}' << (index + 1 < results.size() ? ",\n" : "\n");
+        }
+
+        os << "]\n";
+    }
+
+    /// @brief Чтение результатов, ранее записанных функцией write_csv
+    inline std::vector<bench_result> read_csv(std::istream & is)
+    {
+        std::vector<bench_result> results;
+
+        std::string line;
+        std::getline(is, line);
+
+        while(std::getline(is, line))
+        {
+            if(line.empty())
+            {
+                continue;
+            }
+
+            std::vector<std::string> fields;
+            std::istringstream line_stream(line);
+
+            for(std::string field; std::getline(line_stream, field, ',');)
+            {
+                fields.push_back(field);
+            }
+
+            if(fields.size() < 9)
+            {
+                continue;
+            }
+
+            bench_result result;
+            result.group = fields[0];
+            result.name = fields[1];
+            result.impl = fields[2];
+            result.distribution = fields[3];
+            result.size = std::stoul(fields[4]);
+            result.repetitions = std::stoul(fields[5]);
+            result.min_ns = std::stod(fields[6]);
+            result.median_ns = std::stod(fields[7]);
+            result.mean_ns = std::stod(fields[8]);
+
+            results.push_back(std::move(result));
+        }
+
+        return results;
+    }
+
+    /** @brief Сравнение с эталонными результатами
+    @param threshold допустимое относительное замедление медианного времени, например, 0.1
+    означает, что регрессией считается замедление более чем на 10%
+    @return Количество обнаруженных регрессий
+    */
+    inline std::size_t compare_with_baseline(std::vector<bench_result> const & current
+                                             , std::vector<bench_result> const & baseline
+                                             , double threshold, std::ostream & report)
+    {
+        auto regressions = std::size_t(0);
+
+        for(auto const & result : current)
+        {
+            for(auto const & old : baseline)
+            {
+                if(old.impl != result.impl || old.key() != result.key() || old.median_ns <= 0)
+                {
+                    continue;
+                }
+
+                auto const ratio = result.median_ns / old.median_ns;
+
+                if(ratio > 1 + threshold)
+                {
+                    ++regressions;
+
+                    report << "REGRESSION " << result.key() << " [" << result.impl << "]: "
+                           << old.median_ns << " ns -> " << result.median_ns << " ns (x"
+                           << ratio << ")\n";
+                }
+                else if(ratio < 1 - threshold)
+                {
+                    report << "improvement " << result.key() << " [" << result.impl << "]: "
+                           << old.median_ns << " ns -> " << result.median_ns << " ns (x"
+                           << ratio << ")\n";
+                }
+            }
+        }
+
+        return regressions;
+    }
+}
+// namespace saga_bench
+
+#endif
+// Z_SAGA_BENCH_BENCH_HPP_INCLUDED
@@ -0,0 +1,316 @@
+/* (c) 2026 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки SAGA.
+
+SAGA -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+/** @file bench/container.cpp
+ @brief Замеры производительности контейнеров
+*/
+
+#include "bench.hpp"
+
+#include <saga/compressed_integer_set.hpp>
+#include <saga/eytzinger_set.hpp>
+#include <saga/flat_map.hpp>
+#include <saga/flat_set.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <vector>
+
+namespace
+{
+    using Value = int;
+
+    /// @brief Запросы, равномерно распределённые по тому же интервалу, что и make_data(num)
+    std::vector<Value> make_queries(std::size_t num)
+    {
+        std::mt19937 rnd(2);
+        std::uniform_int_distribution<Value> distr(0, static_cast<Value>(4 * num));
+
+        std::vector<Value> result(1'000'000);
+        std::generate(result.begin(), result.end(), [&] { return distr(rnd); });
+
+        return result;
+    }
+
+    void register_flat_set(saga_bench::registry & reg)
+    {
+        // Размер множества, в которое вставляется пакет из size / 100 элементов
+        auto const sizes = std::vector<std::size_t>{100'000, 1'000'000, 10'000'000};
+        auto const distributions = saga_bench::random_distribution_only();
+
+        reg.add({"flat_set", "insert_range", "saga", sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            auto const base_data = saga_bench::make_data(state.size(), state.distribution());
+            auto const batch = saga_bench::make_data(state.size() / 100, state.distribution(), 2);
+
+            saga::flat_set<Value> const base(base_data);
+            auto set = base;
+
+            state.measure([&] { set = base; }, [&]
+            {
+                set.insert(batch.begin(), batch.end());
+                saga_bench::do_not_optimize(set.size());
+            });
+        }});
+
+        // Прежний способ: добавление в конец, сортировка и удаление повторов для всех элементов
+        reg.add({"flat_set", "insert_range", "raw", sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            auto const base_data = saga_bench::make_data(state.size(), state.distribution());
+            auto const batch = saga_bench::make_data(state.size() / 100, state.distribution(), 2);
+
+            saga::flat_set<Value> const base(base_data);
+            std::vector<Value> data;
+
+            state.measure([&] { data.assign(base.begin(), base.end()); }, [&]
+            {
+                data.insert(data.end(), batch.begin(), batch.end());
+                std::sort(data.begin(), data.end());
+                data.erase(std::unique(data.begin(), data.end()), data.end());
+                saga_bench::do_not_optimize(data.size());
+            });
+        }});
+
+        reg.add({"flat_set", "insert_range", "one_by_one", {100'000, 1'000'000}, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            auto const base_data = saga_bench::make_data(state.size(), state.distribution());
+            auto const batch = saga_bench::make_data(state.size() / 100, state.distribution(), 2);
+
+            saga::flat_set<Value> const base(base_data);
+            auto set = base;
+
+            state.measure([&] { set = base; }, [&]
+            {
+                for(auto value : batch)
+                {
+                    set.insert(set.end(), Value(value));
+                }
+                saga_bench::do_not_optimize(set.size());
+            });
+        }});
+    }
+
+    template <class Map>
+    void measure_map_find(saga_bench::bench_state & state)
+    {
+        // Ключи -- чётные числа из [0, 8 * size]
+        auto const data = saga_bench::make_data(state.size(), state.distribution());
+        auto const queries = make_queries(2 * state.size());
+
+        std::vector<std::pair<Value, Value>> elements;
+        for(auto const & value : data)
+        {
+            elements.emplace_back(2 * value, value);
+        }
+
+        Map const map(elements.begin(), elements.end());
+
+        state.measure([&]
+        {
+            auto sum = Value(0);
+
+            for(auto const & query : queries)
+            {
+                auto const pos = map.find(query);
+
+                if(pos != map.end())
+                {
+                    sum += pos->second;
+                }
+            }
+
+            saga_bench::do_not_optimize(sum);
+        });
+    }
+
+    void register_flat_map(saga_bench::registry & reg)
+    {
+        // Размер отображения, число запросов -- всегда 10^6
+        auto const sizes = std::vector<std::size_t>{10'000, 1'000'000, 4'000'000};
+        auto const distributions = saga_bench::random_distribution_only();
+
+        reg.add({"flat_map", "find", "saga", sizes, distributions
+                , &measure_map_find<saga::flat_map<Value, Value>>});
+
+        reg.add({"flat_map", "find", "std", sizes, distributions
+                , &measure_map_find<std::map<Value, Value>>});
+    }
+
+    template <class Contains>
+    void measure_set_contains(saga_bench::bench_state & state, Contains contains)
+    {
+        auto const data = saga_bench::make_data(state.size(), state.distribution());
+        auto const queries = make_queries(state.size());
+
+        saga::flat_set<Value> const set(data);
+        auto const snapshot = saga::eytzinger_set<Value>(set);
+
+        state.measure([&]
+        {
+            auto count = std::size_t(0);
+
+            for(auto const & query : queries)
+            {
+                count += contains(set, snapshot, query) ? 1 : 0;
+            }
+
+            saga_bench::do_not_optimize(count);
+        });
+    }
+
+    void register_eytzinger_set(saga_bench::registry & reg)
+    {
+        // Размер множества, число запросов -- всегда 10^6
+        auto const sizes = std::vector<std::size_t>{10'000, 1'000'000, 10'000'000};
+        auto const distributions = saga_bench::random_distribution_only();
+
+        reg.add({"set_contains", "eytzinger", "saga", sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            measure_set_contains(state, [](auto const &, auto const & snapshot, Value query)
+                                        { return snapshot.contains(query); });
+        }});
+
+        reg.add({"set_contains", "eytzinger", "flat_set", sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            measure_set_contains(state, [](auto const & set, auto const &, Value query)
+            {
+                auto const pos = std::lower_bound(set.begin(), set.end(), query);
+                return pos != set.end() && *pos == query;
+            });
+        }});
+
+        reg.add({"set_contains", "eytzinger", "std", sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            measure_set_contains(state, [](auto const & set, auto const &, Value query)
+            {
+                return std::binary_search(set.begin(), set.end(), query);
+            });
+        }});
+    }
+    /// @brief Упорядоченные без повторов данные, преобразованные в беззнаковые числа
+    std::vector<std::uint32_t> make_unsigned_set(std::size_t num, unsigned seed)
+    {
+        auto const data = saga::flat_set<Value>(saga_bench::make_data(num, "random", seed));
+
+        return std::vector<std::uint32_t>(data.begin(), data.end());
+    }
+
+    void register_compressed_integer_set(saga_bench::registry & reg)
+    {
+        // Размер каждого из множеств, число запросов -- всегда 10^6
+        auto const sizes = std::vector<std::size_t>{10'000, 1'000'000, 10'000'000};
+        auto const distributions = saga_bench::random_distribution_only();
+
+        using Set = saga::compressed_integer_set<std::uint32_t>;
+
+        reg.add({"compressed_integer_set", "contains", "saga", sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            auto const data = make_unsigned_set(state.size(), 1);
+            auto const queries = make_queries(state.size());
+
+            Set const set(saga::sorted_unique, data.begin(), data.end());
+
+            state.measure([&]
+            {
+                auto count = std::size_t(0);
+
+                for(auto const & query : queries)
+                {
+                    count += set.contains(static_cast<std::uint32_t>(query)) ? 1 : 0;
+                }
+
+                saga_bench::do_not_optimize(count);
+            });
+        }});
+
+        reg.add({"compressed_integer_set", "contains", "std", sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            auto const data = make_unsigned_set(state.size(), 1);
+            auto const queries = make_queries(state.size());
+
+            state.measure([&]
+            {
+                auto count = std::size_t(0);
+
+                for(auto const & query : queries)
+                {
+                    count += std::binary_search(data.begin(), data.end()
+                                                , static_cast<std::uint32_t>(query)) ? 1 : 0;
+                }
+
+                saga_bench::do_not_optimize(count);
+            });
+        }});
+
+        reg.add({"compressed_integer_set", "set_intersection", "saga", sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            auto const data1 = make_unsigned_set(state.size(), 1);
+            auto const data2 = make_unsigned_set(state.size(), 2);
+
+            Set const set1(saga::sorted_unique, data1.begin(), data1.end());
+            Set const set2(saga::sorted_unique, data2.begin(), data2.end());
+
+            std::vector<std::uint32_t> result;
+
+            state.measure([&]
+            {
+                result.clear();
+                set1.set_intersection(set2, saga::back_inserter(result));
+
+                saga_bench::do_not_optimize(result.data());
+            });
+        }});
+
+        reg.add({"compressed_integer_set", "set_intersection", "std", sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            auto const data1 = make_unsigned_set(state.size(), 1);
+            auto const data2 = make_unsigned_set(state.size(), 2);
+
+            std::vector<std::uint32_t> result;
+
+            state.measure([&]
+            {
+                result.clear();
+                std::set_intersection(data1.begin(), data1.end(), data2.begin(), data2.end()
+                                     , std::back_inserter(result));
+
+                saga_bench::do_not_optimize(result.data());
+            });
+        }});
+    }
+}
+// namespace
+
+void saga_bench::register_container_benchmarks(registry & reg)
+{
+    register_flat_set(reg);
+    register_flat_map(reg);
+    register_eytzinger_set(reg);
+    register_compressed_integer_set(reg);
+}
@@ -0,0 +1,233 @@
+/* (c) 2026 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки SAGA.
+
+SAGA -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+/** @file bench/main.cpp
+ @brief Запуск замеров производительности
+
+ Параметры командной строки:
+ --format=csv|json -- формат вывода (по умолчанию csv)
+ --output=FILE -- файл для вывода результатов (по умолчанию стандартный вывод)
+ --filter=TEXT -- выполнять только замеры, в названии группы или варианта которых есть TEXT
+ --repetitions=N -- количество повторений каждого замера (по умолчанию 7)
+ --quick -- использовать только наименьший размер данных
+ --baseline=FILE -- сравнить результаты с ранее полученными (в формате csv)
+ --threshold=X -- допустимое относительное замедление при сравнении (по умолчанию 0.1)
+ --hardware-counters -- измерять также аппаратные счётчики (только Linux, perf_event_open)
+
+ При сравнении с эталоном программа завершается с кодом 1, если обнаружены регрессии. Сравнение
+ имеет смысл только на одной и той же ненагруженной машине.
+*/
+
+// Подсчёт выделений памяти для всей программы
+#define SAGA_TEST_DEFINE_COUNTING_OPERATOR_NEW
+#include <saga/test/allocation_counter.hpp>
+
+#include "bench.hpp"
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+
+namespace
+{
+    struct bench_options
+    {
+        std::string format = "csv";
+        std::string output;
+        std::string filter;
+        std::string baseline;
+        std::size_t repetitions = 7;
+        double threshold = 0.1;
+        bool quick = false;
+        bool hardware_counters = false;
+    };
+
+    bool parse_option(std::string const & arg, std::string const & name, std::string & value)
+    {
+        auto const prefix = "--" + name + "=";
+
+        if(arg.compare(0, prefix.size(), prefix) != 0)
+        {
+            return false;
+        }
+
+        value = arg.substr(prefix.size());
+        return true;
+    }
+
+    bench_options parse_options(int argc, char * argv[])
+    {
+        bench_options options;
+
+        for(auto index = 1; index < argc; ++index)
+        {
+            std::string const arg = argv[index];
+            std::string value;
+
+            if(arg == "--quick")
+            {
+                options.quick = true;
+            }
+            else if(arg == "--hardware-counters")
+            {
+                options.hardware_counters = true;
+            }
+            else if(parse_option(arg, "format", value))
+            {
+                options.format = value;
+            }
+            else if(parse_option(arg, "output", value))
+            {
+                options.output = value;
+            }
+            else if(parse_option(arg, "filter", value))
+            {
+                options.filter = value;
+            }
+            else if(parse_option(arg, "baseline", value))
+            {
+                options.baseline = value;
+            }
+            else if(parse_option(arg, "repetitions", value))
+            {
+                options.repetitions = std::max<std::size_t>(1, std::stoul(value));
+            }
+            else if(parse_option(arg, "threshold", value))
+            {
+                options.threshold = std::stod(value);
+            }
+            else
+            {
+                throw std::invalid_argument("Unknown option: " + arg);
+            }
+        }
+
+        if(options.format != "csv" && options.format != "json")
+        {
+            throw std::invalid_argument("Unknown format: " + options.format);
+        }
+
+        return options;
+    }
+
+    bool matches(saga_bench::bench_case const & info, std::string const & filter)
+    {
+        return filter.empty()
+            || (info.group + '/' + info.name + '/' + info.impl).find(filter) != std::string::npos;
+    }
+}
+
+int main(int argc, char * argv[])
+try
+{
+    auto const options = parse_options(argc, argv);
+
+    saga_bench::registry reg;
+    saga_bench::register_algorithm_benchmarks(reg);
+    saga_bench::register_container_benchmarks(reg);
+    saga_bench::register_numeric_benchmarks(reg);
+    saga_bench::register_optimization_benchmarks(reg);
+
+    std::unique_ptr<saga::hardware_counters> hardware;
+
+    if(options.hardware_counters)
+    {
+        hardware = std::make_unique<saga::hardware_counters>();
+
+        if(!hardware->available())
+        {
+            std::clog << "Hardware counters are not available" << std::endl;
+            hardware.reset();
+        }
+    }
+
+    std::vector<saga_bench::bench_result> results;
+
+    for(auto const & info : reg.cases())
+    {
+        if(!matches(info, options.filter))
+        {
+            continue;
+        }
+
+        auto sizes = info.sizes;
+
+        if(options.quick && !sizes.empty())
+        {
+            sizes.assign(1, *std::min_element(sizes.begin(), sizes.end()));
+        }
+
+        for(auto const & distribution : info.distributions)
+        for(auto const & size : sizes)
+        {
+            std::clog << info.group << '/' << info.name << '/' << info.impl << ' '
+                      << distribution << ' ' << size << std::endl;
+
+            saga_bench::bench_state state(size, distribution, options.repetitions
+                                          , hardware.get());
+            info.body(state);
+
+            results.push_back(saga_bench::make_result(info, state));
+        }
+    }
+
+    std::ofstream file;
+
+    if(!options.output.empty())
+    {
+        file.open(options.output);
+    }
+
+    std::ostream & os = options.output.empty() ? std::cout : file;
+
+    if(options.format == "json")
+    {
+        saga_bench::write_json(os, results);
+    }
+    else
+    {
+        saga_bench::write_csv(os, results);
+    }
+
+    if(!options.baseline.empty())
+    {
+        std::ifstream baseline_file(options.baseline);
+
+        if(!baseline_file)
+        {
+            throw std::runtime_error("Cannot open baseline: " + options.baseline);
+        }
+
+        auto const baseline = saga_bench::read_csv(baseline_file);
+
+        auto const regressions
+            = saga_bench::compare_with_baseline(results, baseline, options.threshold, std::clog);
+
+        std::clog << "Regressions: " << regressions << std::endl;
+
+        return regressions == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
+catch(std::exception & error)
+{
+    std::cerr << error.what() << std::endl;
+    return EXIT_FAILURE;
+}
@@ -0,0 +1,833 @@
+/* (c) 2026 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки SAGA.
+
+SAGA -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+/** @file bench/numeric.cpp
+ @brief Замеры производительности алгоритмов из saga/numeric.hpp и разбора чисел из текста
+*/
+
+#include "bench.hpp"
+
+#include <saga/cursor/by_line.hpp>
+#include <saga/cursor/from_chars.hpp>
+#include <saga/cursor/istream_cursor.hpp>
+#include <saga/cursor/lines.hpp>
+#include <saga/cursor/subrange.hpp>
+#include <saga/memory/mapped_file.hpp>
+#include <saga/numeric.hpp>
+#include <saga/numeric/big_integer.hpp>
+#include <saga/numeric/factorize.hpp>
+#include <saga/numeric/is_prime.hpp>
+#include <saga/numeric/modular.hpp>
+#include <saga/numeric/parallel_sieve.hpp>
+#include <saga/numeric/polynomial.hpp>
+#include <saga/numeric/primes_cursor.hpp>
+#include <saga/numeric/segmented_sieve.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <numeric>
+#include <random>
+#include <sstream>
+#include <string>
+
+namespace
+{
+    using Value = long long;
+
+    std::vector<Value> make_values(saga_bench::bench_state const & state)
+    {
+        auto const src = saga_bench::make_data(state.size(), state.distribution());
+
+        return std::vector<Value>(src.begin(), src.end());
+    }
+
+    // Частичные суммы
+    void register_scans(saga_bench::registry & reg)
+    {
+        auto const sizes = saga_bench::default_sizes();
+        auto const distributions = saga_bench::random_distribution_only();
+
+        reg.add({"partial_sum", "int64", "saga", sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            auto const data = make_values(state);
+            std::vector<Value> out(data.size());
+
+            state.measure([&]
+            {
+                saga::partial_sum(saga::cursor::all(data), saga::cursor::all(out));
+                saga_bench::do_not_optimize(out.data());
+            });
+        }});
+
+        reg.add({"partial_sum", "int64", "std", sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            auto const data = make_values(state);
+            std::vector<Value> out(data.size());
+
+            state.measure([&]
+            {
+                std::partial_sum(data.begin(), data.end(), out.begin());
+                saga_bench::do_not_optimize(out.data());
+            });
+        }});
+
+        reg.add({"inclusive_scan", "int64", "saga", sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            auto const data = make_values(state);
+            std::vector<Value> out(data.size());
+
+            state.measure([&]
+            {
+                saga::inclusive_scan(saga::cursor::all(data), saga::cursor::all(out));
+                saga_bench::do_not_optimize(out.data());
+            });
+        }});
+
+        reg.add({"inclusive_scan", "int64", "std", sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            auto const data = make_values(state);
+            std::vector<Value> out(data.size());
+
+            state.measure([&]
+            {
+                std::inclusive_scan(data.begin(), data.end(), out.begin());
+                saga_bench::do_not_optimize(out.data());
+            });
+        }});
+
+        reg.add({"exclusive_scan", "int64", "saga", sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            auto const data = make_values(state);
+            std::vector<Value> out(data.size());
+
+            state.measure([&]
+            {
+                saga::exclusive_scan(saga::cursor::all(data), saga::cursor::all(out), Value(0));
+                saga_bench::do_not_optimize(out.data());
+            });
+        }});
+
+        reg.add({"exclusive_scan", "int64", "std", sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            auto const data = make_values(state);
+            std::vector<Value> out(data.size());
+
+            state.measure([&]
+            {
+                std::exclusive_scan(data.begin(), data.end(), out.begin(), Value(0));
+                saga_bench::do_not_optimize(out.data());
+            });
+        }});
+    }
+
+    // Решето Эратосфена
+    std::size_t reference_primes_below(std::size_t n_max)
+    {
+        if(n_max < 3)
+        {
+            return 0;
+        }
+
+        std::vector<bool> is_composite(n_max, false);
+        auto count = std::size_t(0);
+
+        for(auto num = std::size_t(2); num < n_max; ++num)
+        {
+            if(is_composite[num])
+            {
+                continue;
+            }
+
+            ++count;
+
+            for(auto multiple = num * num; multiple < n_max; multiple += num)
+            {
+                is_composite[multiple] = true;
+            }
+        }
+
+        return count;
+    }
+
+    // Первые num простых чисел методом пробного деления (прежняя реализация primes_cursor)
+    std::vector<std::size_t> first_primes_by_trial_division(std::size_t num)
+    {
+        std::vector<std::size_t> primes(1, 2);
+
+        for(; primes.size() < num;)
+        {
+            auto candidate = primes.back() + 1 + primes.back() % 2;
+
+            for(; !saga::is_prime_sorted(candidate, primes, saga::unsafe_tag_t{});)
+            {
+                candidate += ((candidate % 6 == 1) ? 4 : 2);
+            }
+
+            primes.push_back(candidate);
+        }
+
+        return primes;
+    }
+
+    // Функция Эйлера решетом Эратосфена (прежняя реализация euler_phi_below)
+    std::vector<std::size_t> euler_phi_by_eratosthenes(std::size_t n_max)
+    {
+        std::vector<std::size_t> result(n_max);
+        std::iota(result.begin(), result.end(), std::size_t(0));
+
+        for(auto cur = std::size_t(2); cur < n_max; ++cur)
+        {
+            if(cur == result[cur])
+            {
+                for(auto num = cur; num < n_max; num += cur)
+                {
+                    result[num] -= result[num] / cur;
+                }
+            }
+        }
+
+        return result;
+    }
+
+    void register_sieves(saga_bench::registry & reg)
+    {
+        auto const sizes = std::vector<std::size_t>{100'000, 1'000'000, 10'000'000};
+        auto const distributions = std::vector<std::string>{"-"};
+
+        reg.add({"primes_below", "sieve", "saga", sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            state.measure([&]
+            { saga_bench::do_not_optimize(saga::primes_below(state.size()).size()); });
+        }});
+
+        reg.add({"primes_below", "sieve", "raw", sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            state.measure([&]
+            { saga_bench::do_not_optimize(reference_primes_below(state.size())); });
+        }});
+
+        reg.add({"prime_count", "primes_in", "saga", sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            state.measure([&]
+            {
+                auto count = std::size_t(0);
+
+                for(auto cur = saga::cursor::primes_in(std::size_t(0), state.size()); !!cur; ++cur)
+                {
+                    ++count;
+                }
+
+                saga_bench::do_not_optimize(count);
+            });
+        }});
+
+        reg.add({"prime_count", "primes_in", "parallel", sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            state.measure([&]
+            { saga_bench::do_not_optimize(saga::prime_count(state.size() - 1)); });
+        }});
+
+        reg.add({"prime_count", "primes_in", "raw", sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            state.measure([&]
+            { saga_bench::do_not_optimize(reference_primes_below(state.size())); });
+        }});
+
+        reg.add({"euler_phi_below", "sieve", "saga", sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            state.measure([&]
+            { saga_bench::do_not_optimize(saga::euler_phi_below(state.size()).back()); });
+        }});
+
+        reg.add({"euler_phi_below", "sieve", "raw", sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            state.measure([&]
+            { saga_bench::do_not_optimize(euler_phi_by_eratosthenes(state.size()).back()); });
+        }});
+
+        auto const counts = std::vector<std::size_t>{1'000, 10'000, 100'000};
+
+        reg.add({"primes_cursor", "first_n", "saga", counts, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            state.measure([&]
+            {
+                auto cur = saga::primes_cursor<std::size_t>();
+
+                for(; cur->size() < state.size();)
+                {
+                    ++cur;
+                }
+
+                saga_bench::do_not_optimize(cur->back());
+            });
+        }});
+
+        reg.add({"primes_cursor", "first_n", "raw", counts, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            state.measure([&]
+            {
+                auto const primes = first_primes_by_trial_division(state.size());
+                saga_bench::do_not_optimize(primes.back());
+            });
+        }});
+    }
+
+    // Сублинейные алгоритмы для сумматорных функций
+    void register_summatory(saga_bench::registry & reg)
+    {
+        auto const sizes = std::vector<std::size_t>{1'000'000, 10'000'000, 100'000'000};
+        auto const distributions = std::vector<std::string>{"-"};
+
+        reg.add({"prime_count", "sublinear", "saga", sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            state.measure([&]
+            { saga_bench::do_not_optimize(saga::lucy_prime_count(state.size())); });
+        }});
+
+        reg.add({"prime_count", "sublinear", "raw", sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            state.measure([&]
+            { saga_bench::do_not_optimize(saga::prime_count(state.size(), 1)); });
+        }});
+
+        // Эталонные реализации требуют O(n) памяти
+        auto const table_sizes = std::vector<std::size_t>{1'000'000, 10'000'000};
+
+        reg.add({"mertens", "sublinear", "saga", table_sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            state.measure([&]
+            { saga_bench::do_not_optimize(saga::mertens(state.size())); });
+        }});
+
+        reg.add({"mertens", "sublinear", "raw", table_sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            state.measure([&]
+            {
+                auto const mu = saga::linear_sieve<>(state.size() + 1
+                                                    , saga::linear_sieve_tables::moebius).moebius();
+
+                saga_bench::do_not_optimize(std::accumulate(mu.begin(), mu.end(), 0L));
+            });
+        }});
+
+        reg.add({"euler_phi_sum", "sublinear", "saga", table_sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            state.measure([&]
+            { saga_bench::do_not_optimize(saga::euler_phi_sum(state.size())); });
+        }});
+
+        reg.add({"euler_phi_sum", "sublinear", "raw", table_sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            state.measure([&]
+            {
+                auto const phi = saga::euler_phi_below(state.size() + 1);
+
+                saga_bench::do_not_optimize(std::accumulate(phi.begin(), phi.end(), 0UL));
+            });
+        }});
+    }
+
+    // Проверка простоты и разложение на множители случайных 64-битных чисел
+    std::vector<std::uint64_t> make_random_u64(std::size_t num)
+    {
+        std::mt19937_64 rnd(20260101);
+
+        std::vector<std::uint64_t> result(num);
+        for(auto & value : result)
+        {
+            value = rnd() | 1;
+        }
+
+        return result;
+    }
+
+    void register_factorization(saga_bench::registry & reg)
+    {
+        auto const sizes = std::vector<std::size_t>{100, 1'000};
+        auto const distributions = saga_bench::random_distribution_only();
+
+        reg.add({"is_prime", "random_u64", "saga", sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            auto const data = make_random_u64(state.size());
+
+            state.measure([&]
+            {
+                auto count = std::size_t(0);
+
+                for(auto const & num : data)
+                {
+                    count += saga::is_prime(num);
+                }
+
+                saga_bench::do_not_optimize(count);
+            });
+        }});
+
+        reg.add({"factorize", "random_u64", "saga", sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            auto const data = make_random_u64(state.size());
+
+            state.measure([&]
+            {
+                auto count = std::size_t(0);
+
+                for(auto const & num : data)
+                {
+                    count += saga::factorize(num).size();
+                }
+
+                saga_bench::do_not_optimize(count);
+            });
+        }});
+    }
+    // Длинная арифметика
+    std::string make_random_decimal(std::size_t digits)
+    {
+        std::mt19937_64 rnd(20260101);
+
+        std::string result(digits, '0');
+        for(auto & digit : result)
+        {
+            digit = static_cast<char>('0' + rnd() % 10);
+        }
+
+        result.front() = '1';
+
+        return result;
+    }
+
+    void register_big_integer(saga_bench::registry & reg)
+    {
+        auto const sizes = std::vector<std::size_t>{100, 1'000, 10'000};
+        auto const distributions = saga_bench::random_distribution_only();
+
+        reg.add({"big_integer", "multiply", "saga", sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            auto const lhs = make_random_u64(state.size());
+            auto const rhs = make_random_u64(state.size() + 1);
+            std::vector<std::uint64_t> product(2 * state.size());
+
+            state.measure([&]
+            {
+                saga::detail::limbs_multiply(product.data(), lhs.data(), state.size()
+                                            , rhs.data() + 1, state.size());
+                saga_bench::do_not_optimize(product.back());
+            });
+        }});
+
+        reg.add({"big_integer", "multiply", "raw", sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            auto const lhs = make_random_u64(state.size());
+            auto const rhs = make_random_u64(state.size() + 1);
+            std::vector<std::uint64_t> product(2 * state.size());
+
+            state.measure([&]
+            {
+                saga::detail::limbs_mul_basecase(product.data(), lhs.data(), state.size()
+                                                , rhs.data() + 1, state.size());
+                saga_bench::do_not_optimize(product.back());
+            });
+        }});
+
+        // Размер -- количество десятичных цифр
+        auto const digits = std::vector<std::size_t>{1'000, 100'000, 1'000'000};
+
+        reg.add({"big_integer", "parse", "saga", digits, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            auto const str = make_random_decimal(state.size());
+
+            state.measure([&]
+            { saga_bench::do_not_optimize(saga::big_integer(str).limbs().size()); });
+        }});
+
+        reg.add({"big_integer", "to_string", "saga", digits, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            auto const value = saga::big_integer(make_random_decimal(state.size()));
+
+            state.measure([&]
+            { saga_bench::do_not_optimize(value.to_string().size()); });
+        }});
+    }
+    // Возведение в степень по модулю
+    template <class Modular>
+    void register_power_modulo(saga_bench::registry & reg, std::string const & name)
+    {
+        auto const sizes = std::vector<std::size_t>{1'000};
+        auto const distributions = saga_bench::random_distribution_only();
+
+        reg.add({"power_modulo", name, "saga", sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            auto const data = make_random_u64(state.size());
+
+            state.measure([&]
+            {
+                auto result = Modular(0);
+
+                for(auto const & num : data)
+                {
+                    result += Modular(num).power(num);
+                }
+
+                saga_bench::do_not_optimize(result.value());
+            });
+        }});
+
+        reg.add({"power_modulo", name, "raw", sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            auto const data = make_random_u64(state.size());
+            auto const mult = saga::multiplies_modulo<std::uint64_t>(Modular::modulus());
+
+            state.measure([&]
+            {
+                auto result = std::uint64_t(0);
+
+                for(auto const & num : data)
+                {
+                    result ^= saga::power_natural(num % Modular::modulus(), num, mult);
+                }
+
+                saga_bench::do_not_optimize(result);
+            });
+        }});
+    }
+    // Числа разбиений: обращение степенного ряда и рекуррентное соотношение Эйлера
+    using partition_modular = saga::static_modular_integer<998'244'353>;
+
+    std::vector<partition_modular> partitions_series(std::size_t num)
+    {
+        std::vector<partition_modular> euler(num);
+
+        for(auto k = std::size_t(0); k * (3 * k - 1) / 2 < num; ++k)
+        {
+            auto const sign = (k % 2 == 0) ? partition_modular(1) : partition_modular(-1);
+
+            euler[k * (3 * k - 1) / 2] = sign;
+
+            if(k > 0 && k * (3 * k + 1) / 2 < num)
+            {
+                euler[k * (3 * k + 1) / 2] = sign;
+            }
+        }
+
+        return saga::polynomial_inverse(euler, num);
+    }
+
+    std::vector<partition_modular> partitions_pentagonal(std::size_t num)
+    {
+        std::vector<partition_modular> ways(num);
+        ways[0] = partition_modular(1);
+
+        for(auto n = std::size_t(1); n < num; ++n)
+        {
+            for(auto k = std::size_t(1); k * (3 * k - 1) / 2 <= n; ++k)
+            {
+                auto term = ways[n - k * (3 * k - 1) / 2];
+
+                if(k * (3 * k + 1) / 2 <= n)
+                {
+                    term += ways[n - k * (3 * k + 1) / 2];
+                }
+
+                ways[n] += (k % 2 == 1) ? term : -term;
+            }
+        }
+
+        return ways;
+    }
+
+    void register_partitions(saga_bench::registry & reg)
+    {
+        auto const sizes = std::vector<std::size_t>{10'000, 100'000};
+        auto const distributions = std::vector<std::string>{"-"};
+
+        reg.add({"partitions", "series", "saga", sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            state.measure([&]
+            { saga_bench::do_not_optimize(partitions_series(state.size()).back().value()); });
+        }});
+
+        reg.add({"partitions", "series", "raw", sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            state.measure([&]
+            { saga_bench::do_not_optimize(partitions_pentagonal(state.size()).back().value()); });
+        }});
+    }
+
+    std::vector<double> make_random_doubles(std::size_t num)
+    {
+        std::mt19937_64 rnd(20260101);
+        std::uniform_real_distribution<double> distr(-1.0, 1.0);
+
+        std::vector<double> result(num);
+
+        for(auto & value : result)
+        {
+            value = distr(rnd);
+        }
+
+        return result;
+    }
+
+    void register_polynomial_horner(saga_bench::registry & reg, std::size_t num_coefficients)
+    {
+        auto const sizes = std::vector<std::size_t>{10'000, 1'000'000};
+        auto const distributions = saga_bench::random_distribution_only();
+        auto const name = "degree_" + std::to_string(num_coefficients - 1);
+
+        reg.add({"polynomial_horner", name, "saga", sizes, distributions
+                , [num_coefficients](saga_bench::bench_state & state)
+        {
+            auto const poly = make_random_doubles(num_coefficients);
+            auto const points = make_random_doubles(state.size());
+            std::vector<double> values(points.size());
+
+            state.measure([&]
+            {
+                saga::polynomial_horner(saga::cursor::all(poly), saga::cursor::all(points)
+                                       , saga::cursor::all(values));
+                saga_bench::do_not_optimize(values.back());
+            });
+        }});
+
+        reg.add({"polynomial_horner", name, "estrin", sizes, distributions
+                , [num_coefficients](saga_bench::bench_state & state)
+        {
+            auto const poly = make_random_doubles(num_coefficients);
+            auto const points = make_random_doubles(state.size());
+            std::vector<double> values(points.size());
+
+            state.measure([&]
+            {
+                saga::polynomial_estrin(saga::cursor::all(poly), saga::cursor::all(points)
+                                       , saga::cursor::all(values));
+                saga_bench::do_not_optimize(values.back());
+            });
+        }});
+
+        reg.add({"polynomial_horner", name, "raw", sizes, distributions
+                , [num_coefficients](saga_bench::bench_state & state)
+        {
+            auto const poly = make_random_doubles(num_coefficients);
+            auto const points = make_random_doubles(state.size());
+            std::vector<double> values(points.size());
+
+            state.measure([&]
+            {
+                for(auto index = std::size_t(0); index < points.size(); ++index)
+                {
+                    values[index] = saga::polynomial_horner(saga::cursor::all(poly)
+                                                           , points[index], 0.0);
+                }
+                saga_bench::do_not_optimize(values.back());
+            });
+        }});
+    }
+
+    // Разбор чисел из текста
+    std::string make_numbers_text(std::size_t num)
+    {
+        auto const values = saga_bench::make_data(num, "random");
+
+        std::ostringstream output;
+
+        for(auto index = std::size_t(0); index < values.size(); ++index)
+        {
+            output << values[index] << (index % 10 == 9 ? '\n' : ' ');
+        }
+
+        return output.str();
+    }
+
+    /// @brief Временный файл для замеров чтения, удаляемый в деструкторе
+    class bench_file
+    {
+    public:
+        explicit bench_file(std::string const & content)
+        {
+            std::ofstream(this->path_, std::ios::binary) << content;
+        }
+
+        ~bench_file()
+        {
+            std::remove(this->path_.c_str());
+        }
+
+        std::string const & path() const
+        {
+            return this->path_;
+        }
+
+    private:
+        std::string path_ = "saga_bench_numbers.tmp";
+    };
+
+    template <class InputCursor>
+    long long sum_of(InputCursor cur)
+    {
+        auto sum = 0LL;
+
+        for(; !!cur; ++cur)
+        {
+            sum += *cur;
+        }
+
+        return sum;
+    }
+
+    void register_parsing(saga_bench::registry & reg)
+    {
+        // Количество чисел: при 10^7 текст занимает около 85 МБ
+        auto const sizes = std::vector<std::size_t>{100'000, 10'000'000};
+        auto const distributions = saga_bench::random_distribution_only();
+
+        reg.add({"parse_numbers", "memory", "saga", sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            auto const text = make_numbers_text(state.size());
+
+            state.measure([&]
+            {
+                saga_bench::do_not_optimize(sum_of(saga::cursor::from_chars<int>(text)));
+            });
+        }});
+
+        reg.add({"parse_numbers", "memory", "std", sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            auto const text = make_numbers_text(state.size());
+
+            state.measure([&]
+            {
+                std::istringstream input(text);
+
+                saga_bench::do_not_optimize(sum_of(saga::make_istream_cursor<int>(input)));
+            });
+        }});
+
+        reg.add({"parse_numbers", "file", "saga", sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            bench_file const file(make_numbers_text(state.size()));
+
+            state.measure([&]
+            {
+                saga::mapped_file const mapped(file.path());
+
+                saga_bench::do_not_optimize(sum_of(saga::cursor::from_chars<int>(mapped.view())));
+            });
+        }});
+
+        reg.add({"parse_numbers", "file", "std", sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            bench_file const file(make_numbers_text(state.size()));
+
+            state.measure([&]
+            {
+                std::ifstream input(file.path());
+
+                saga_bench::do_not_optimize(sum_of(saga::make_istream_cursor<int>(input)));
+            });
+        }});
+
+        reg.add({"parse_numbers", "lines", "saga", sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            auto const text = make_numbers_text(state.size());
+
+            state.measure([&]
+            {
+                auto total = std::size_t(0);
+
+                for(auto cur = saga::cursor::lines(text); !!cur; ++cur)
+                {
+                    total += cur.front().size();
+                }
+
+                saga_bench::do_not_optimize(total);
+            });
+        }});
+
+        reg.add({"parse_numbers", "lines", "std", sizes, distributions
+                , [](saga_bench::bench_state & state)
+        {
+            auto const text = make_numbers_text(state.size());
+
+            state.measure([&]
+            {
+                std::istringstream input(text);
+
+                auto total = std::size_t(0);
+
+                for(auto cur = saga::cursor::by_line(input); !!cur; ++cur)
+                {
+                    total += cur.front().size();
+                }
+
+                saga_bench::do_not_optimize(total);
+            });
+        }});
+    }
+}
+// namespace
+
+void saga_bench::register_numeric_benchmarks(registry & reg)
+{
+    register_scans(reg);
+    register_sieves(reg);
+    register_summatory(reg);
+    register_factorization(reg);
+    register_big_integer(reg);
+    register_power_modulo<saga::static_modular_integer<1'000'000'007>>(reg, "prime_30");
+    register_power_modulo<saga::static_modular_integer<(std::uint64_t(1) << 61) - 1>>
+        (reg, "prime_61");
+    register_partitions(reg);
+    register_polynomial_horner(reg, 9);
+    register_polynomial_horner(reg, 65);
+    register_parsing(reg);
+}
@@ -0,0 +1,120 @@
+/* (c) 2026 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки SAGA.
+
+SAGA -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+/** @file bench/optimization.cpp
+ @brief Замеры производительности методов оптимизации
+*/
+
+#include "bench.hpp"
+
+#include <saga/optimization/ga.hpp>
+#include <saga/optimization/local_search.hpp>
+#include <saga/optimization/test_objectives.hpp>
+#include <saga/random/iid_distribution.hpp>
+
+#include <valarray>
+
+namespace
+{
+    using Genotype = std::valarray<bool>;
+
+    Genotype random_genotype(std::size_t dim, std::mt19937 & rnd)
+    {
+        saga::iid_distribution<std::bernoulli_distribution, Genotype> distr(dim);
+
+        return distr(rnd);
+    }
+
+    // Одно поколение генетического алгоритма
+    template <class Selection>
+    void bench_ga_generation(saga_bench::bench_state & state, Selection selection)
+    {
+        using Crossover = saga::ga_boolean_crossover_uniform_fn;
+
+        std::mt19937 rnd(20260101);
+
+        auto const dim = static_cast<int>(state.size());
+        auto const x_opt = random_genotype(state.size(), rnd);
+
+        auto const objective = [&x_opt](Genotype const & arg) -> double
+        {
+            return saga::boolean_manhattan_distance(arg, x_opt);
+        };
+
+        auto const problem = saga::make_optimization_problem_boolean(objective, dim);
+
+        saga::GA_settings<Genotype, Crossover, Selection> settings;
+        settings.population_size = 200;
+        settings.selection = std::move(selection);
+
+        using Individual = saga::evaluated_solution<Genotype, double>;
+        using Population = std::vector<Individual>;
+
+        auto const initial
+            = saga::ga_boolen_initial_population<Population>(settings.population_size, dim
+                                                             , problem.objective, rnd);
+        auto population = initial;
+
+        state.measure([&] { population = initial; }, [&]
+        {
+            saga::genetic_algorithm_boolean_cycle(population, problem, settings, rnd);
+            saga_bench::do_not_optimize(population.data());
+        });
+    }
+
+    // Локальный поиск из случайной точки
+    void bench_local_search(saga_bench::bench_state & state)
+    {
+        std::mt19937 rnd(20260101);
+
+        auto const x_opt = random_genotype(state.size(), rnd);
+        auto const x_init = random_genotype(state.size(), rnd);
+
+        auto const objective = [&x_opt](Genotype const & arg)
+        {
+            return saga::boolean_manhattan_distance(arg, x_opt);
+        };
+
+        state.measure([&]
+        {
+            auto const result = saga::local_search_boolean(objective, x_init);
+            saga_bench::do_not_optimize(result.objective_value);
+        });
+    }
+}
+// namespace
+
+void saga_bench::register_optimization_benchmarks(registry & reg)
+{
+    auto const sizes = std::vector<std::size_t>{50, 200, 1000};
+    auto const distributions = std::vector<std::string>{"-"};
+
+    reg.add({"ga_generation", "tournament", "saga", sizes, distributions
+            , [](bench_state & state)
+    {
+        bench_ga_generation(state, saga::selection_tournament(2));
+    }});
+
+    reg.add({"ga_generation", "ranking", "saga", sizes, distributions
+            , [](bench_state & state)
+    {
+        bench_ga_generation(state, saga::selection_ranking{});
+    }});
+
+    reg.add({"local_search", "boolean", "saga", std::vector<std::size_t>{50, 200}, distributions
+            , bench_local_search});
+}
@@ -29,6 +29,8 @@ SAGA -- это свободной программное обеспечение:
 #include <saga/compare.hpp>
 #include <saga/cursor/cursor_traits.hpp>
 #include <saga/cursor/reverse.hpp>
+#include <saga/detail/simd_bound.hpp>
+#include <saga/detail/simd_equal.hpp>
 #include <saga/functional.hpp>
 #include <saga/iterator.hpp>
 #include <saga/pipes/filter.hpp>
@@ -40,6 +42,7 @@ SAGA -- это свободной программное обеспечение:
 #include <algorithm>
 #include <functional>
 #include <random>
+#include <vector>
 
 namespace saga
 {
@@ -80,6 +83,58 @@ namespace saga
             return [&](auto && arg)
                       { return saga::invoke(bin_pred, std::forward<decltype(arg)>(arg), value); };
         }
+
+        // Векторизованные реализации для непрерывных курсоров
+        template <class Cursor, class SFINAE = void>
+        struct contiguous_element
+        {
+            using type = void;
+        };
+
+        template <class Cursor>
+        struct contiguous_element<Cursor, std::enable_if_t<saga::is_contiguous_cursor<Cursor>{}>>
+         : std::remove_cv<std::remove_pointer_t<decltype(std::declval<Cursor const &>().data())>>
+        {};
+
+        template <class Cursor>
+        using contiguous_element_t = typename contiguous_element<Cursor>::type;
+
+        template <class Cursor>
+        auto simd_data(Cursor const & cur)
+        {
+            return static_cast<contiguous_element_t<Cursor> const *>(cur.data());
+        }
+
+        template <template <class, class> class PredicateCheck, class BinaryPredicate
+                 , class Cursor1, class Cursor2 = Cursor1>
+        using use_simd_comparison
+            = std::conjunction<is_simd_equality_comparable<contiguous_element_t<Cursor1>>
+                              , std::is_same<contiguous_element_t<Cursor1>
+                                            , contiguous_element_t<Cursor2>>
+                              , PredicateCheck<BinaryPredicate, contiguous_element_t<Cursor1>>>;
+
+        template <class Cursor, class T, class BinaryPredicate>
+        using use_simd_equal_value
+            = std::conjunction<use_simd_comparison<is_equal_to_predicate, BinaryPredicate, Cursor>
+                              , std::is_same<T, contiguous_element_t<Cursor>>>;
+
+        template <class Cursor, class T, class Compare>
+        using use_simd_bound
+            = std::conjunction<is_simd_ordered<contiguous_element_t<Cursor>>
+                              , std::is_same<T, contiguous_element_t<Cursor>>
+                              , is_less_predicate<Compare, T>>;
+
+        template <bool Upper, class RandomAccessCursor, class T>
+        RandomAccessCursor simd_bound_cursor(RandomAccessCursor cur, T const & value)
+        {
+            auto const index = detail::simd_bound<Upper>(detail::simd_data(cur)
+                                                         , static_cast<std::size_t>(cur.size())
+                                                         , value);
+
+            cur.drop_front(static_cast<cursor_difference_t<RandomAccessCursor>>(index));
+
+            return cur;
+        }
     }
 
     // Немодифицирующие операции
@@ -98,7 +153,21 @@ namespace saga
         InputCursor
         operator()(InputCursor cur, T const & value, BinaryPredicate bin_pred = {}) const
         {
-            return find_if_fn{}(std::move(cur), detail::bind_back_ref(bin_pred, value));
+            if constexpr (detail::use_simd_equal_value<InputCursor, T, BinaryPredicate>{})
+            {
+                auto const index
+                    = detail::simd_find_first_equal<true>(detail::simd_data(cur)
+                                                          , detail::simd_broadcast<T>{value}
+                                                          , static_cast<std::size_t>(cur.size()));
+
+                cur.drop_front(static_cast<cursor_difference_t<InputCursor>>(index));
+
+                return cur;
+            }
+            else
+            {
+                return find_if_fn{}(std::move(cur), detail::bind_back_ref(bin_pred, value));
+            }
         }
     };
 
@@ -189,7 +258,19 @@ namespace saga
         cursor_difference_t<InputCursor>
         operator()(InputCursor cur, T const & value, BinaryPredicate bin_pred = {}) const
         {
-            return count_if_fn{}(std::move(cur), detail::bind_back_ref(bin_pred, value));
+            if constexpr (detail::use_simd_equal_value<InputCursor, T, BinaryPredicate>{})
+            {
+                auto const result
+                    = detail::simd_count_equal(detail::simd_data(cur)
+                                               , detail::simd_broadcast<T>{value}
+                                               , static_cast<std::size_t>(cur.size()));
+
+                return static_cast<cursor_difference_t<InputCursor>>(result);
+            }
+            else
+            {
+                return count_if_fn{}(std::move(cur), detail::bind_back_ref(bin_pred, value));
+            }
         }
     };
 
@@ -202,6 +283,25 @@ namespace saga
         constexpr mismatch_result<InputCursor1, InputCursor2>
         operator()(InputCursor1 in1, InputCursor2 in2, BinaryPredicate bin_pred = {}) const
         {
+            if constexpr (detail::use_simd_comparison<detail::is_equal_to_predicate
+                                                      , BinaryPredicate
+                                                      , InputCursor1, InputCursor2>{})
+            {
+                if(!detail::may_be_constant_evaluated())
+                {
+                    auto const num = std::min(static_cast<std::size_t>(in1.size())
+                                             , static_cast<std::size_t>(in2.size()));
+
+                    auto const index = detail::simd_find_first_equal<false>
+                                        (detail::simd_data(in1), detail::simd_data(in2), num);
+
+                    in1.drop_front(static_cast<cursor_difference_t<InputCursor1>>(index));
+                    in2.drop_front(static_cast<cursor_difference_t<InputCursor2>>(index));
+
+                    return {std::move(in1), std::move(in2)};
+                }
+            }
+
             for(; !!in1 && !!in2; void(++in1), ++in2)
             {
                 if(!saga::invoke(bin_pred, *in1, *in2))
@@ -833,7 +933,7 @@ namespace saga
         drop_front_n_guarded_impl(ForwardCursor cur
                                   , saga::cursor_difference_t<ForwardCursor> num
                                   , std::input_iterator_tag
-                                  , saga::finite_cursor_cardinality_tag)
+                                  , saga::any_cursor_cardinality_tag)
         {
             for(; !!cur && num > 0; cur.drop_front(), void(--num))
             {}
@@ -1545,8 +1645,16 @@ namespace saga
 
             using Distance = saga::cursor_difference_t<RandomAccessCursor>;
 
-            auto pos_first = Distance{0};
-            auto pos_last = Distance{num - 1};
+            /* Опорный элемент переставляется в начало, а первый элемент -- на его место. Если
+            брать образцы из первого и последнего элементов, то для упорядоченной
+            последовательности наименьший элемент окажется в конце левой части и на следующем
+            уровне будет выбран заведомо плохой опорный элемент, что приводит к квадратичной
+            сложности. Поэтому для достаточно длинных интервалов используются квартили.
+            */
+            auto const offset = (num < Distance{8}) ? Distance{0} : Distance{num / 4};
+
+            auto pos_first = Distance{offset};
+            auto pos_last = Distance{num - 1 - offset};
 
             if(saga::out_of_order(cur[pos_first], cur[pos_last], cmp))
             {
@@ -1702,10 +1810,17 @@ namespace saga
         template <class ForwardCursor, class T, class Compare = std::less<>>
         ForwardCursor operator()(ForwardCursor cur, T const & value, Compare cmp = {}) const
         {
-            auto pred = [&](auto && arg)
-                { return saga::out_of_order(value, std::forward<decltype(arg)>(arg), cmp); };
+            if constexpr (detail::use_simd_bound<ForwardCursor, T, Compare>{})
+            {
+                return detail::simd_bound_cursor<false>(std::move(cur), value);
+            }
+            else
+            {
+                auto pred = [&](auto && arg)
+                    { return saga::out_of_order(value, std::forward<decltype(arg)>(arg), cmp); };
 
-            return saga::partition_point_fn{}(std::move(cur), std::move(pred));
+                return saga::partition_point_fn{}(std::move(cur), std::move(pred));
+            }
         }
     };
 
@@ -1714,10 +1829,17 @@ namespace saga
         template <class ForwardCursor, class T, class Compare = std::less<>>
         ForwardCursor operator()(ForwardCursor cur, T const & value, Compare cmp = {}) const
         {
-            auto pred = [&](auto && arg)
-                { return saga::in_order(std::forward<decltype(arg)>(arg), value, cmp); };
+            if constexpr (detail::use_simd_bound<ForwardCursor, T, Compare>{})
+            {
+                return detail::simd_bound_cursor<true>(std::move(cur), value);
+            }
+            else
+            {
+                auto pred = [&](auto && arg)
+                    { return saga::in_order(std::forward<decltype(arg)>(arg), value, cmp); };
 
-            return saga::partition_point_fn{}(std::move(cur), std::move(pred));
+                return saga::partition_point_fn{}(std::move(cur), std::move(pred));
+            }
         }
     };
 
@@ -2013,6 +2135,290 @@ namespace saga
         }
     };
 
+    // Адаптивные операции над множествами
+    namespace detail
+    {
+        /** @brief Шаг, с которого начинается экспоненциальный поиск: для непрерывных курсоров
+        арифметических значений сразу проверяется блок, который просматривается векторными
+        командами
+        */
+        template <class RandomAccessCursor, class T, class Compare>
+        constexpr cursor_difference_t<RandomAccessCursor> gallop_initial_step()
+        {
+            if constexpr (detail::use_simd_bound<RandomAccessCursor, T, Compare>{})
+            {
+                return detail::bound_window<T>;
+            }
+            else
+            {
+                return 1;
+            }
+        }
+
+        /** @brief Экспоненциальный («галопирующий») поиск: аналог lower_bound (или upper_bound,
+        если @c Upper равно @b true), требующий O(log k) сравнений, где k -- результат
+        @return Количество начальных элементов @c cur, предшествующих @c value
+        */
+        template <bool Upper, class RandomAccessCursor, class T, class Compare>
+        cursor_difference_t<RandomAccessCursor>
+        gallop_bound(RandomAccessCursor const & cur, T const & value, Compare & cmp)
+        {
+            using Difference = cursor_difference_t<RandomAccessCursor>;
+
+            auto const before = [&](auto const & elem)
+            {
+                return Upper ? !saga::invoke(cmp, value, elem) : saga::invoke(cmp, elem, value);
+            };
+
+            auto const num = saga::cursor::size(cur);
+
+            // Элементы с индексами из [0, first) предшествуют значению, результат не больше last
+            auto first = Difference(0);
+            auto last = num;
+
+            for(auto step = detail::gallop_initial_step<RandomAccessCursor, T, Compare>();
+                ; step *= 2)
+            {
+                auto const probe = first + step - 1;
+
+                if(probe >= num)
+                {
+                    break;
+                }
+
+                if(!before(cur[probe]))
+                {
+                    last = probe;
+                    break;
+                }
+
+                first = probe + 1;
+            }
+
+            auto window = saga::cursor::drop_front_n(cur, first);
+            window = saga::cursor::drop_back_n(std::move(window), num - last);
+
+            auto const rest = Upper ? saga::upper_bound_fn{}(window, value, std::ref(cmp))
+                                    : saga::lower_bound_fn{}(window, value, std::ref(cmp));
+
+            return last - saga::cursor::size(rest);
+        }
+
+        /// @brief Копирование не более @c num начальных элементов @c in
+        template <class RandomAccessCursor, class OutputCursor>
+        void copy_front_n(RandomAccessCursor & in, cursor_difference_t<RandomAccessCursor> num
+                         , OutputCursor & out)
+        {
+            auto const size = saga::cursor::size(in);
+
+            auto result = saga::copy_fn{}(saga::cursor::drop_back_n(in, size - num)
+                                          , std::move(out));
+
+            in.drop_front(num - saga::cursor::size(result.in));
+            out = std::move(result.out);
+        }
+    }
+    // namespace detail
+
+    /** @brief Аналог includes, использующий экспоненциальный поиск в @c in1
+    @details Требует O(m log(n/m)) сравнений, где n и m -- размеры @c in1 и @c in2
+    */
+    struct includes_adaptive_fn
+    {
+        template <class RandomAccessCursor1, class InputCursor2, class Compare = std::less<>>
+        bool operator()(RandomAccessCursor1 in1, InputCursor2 in2, Compare cmp = {}) const
+        {
+            for(; !!in2; ++in2)
+            {
+                in1.drop_front(detail::gallop_bound<false>(in1, *in2, cmp));
+
+                if(!in1 || saga::invoke(cmp, *in2, *in1))
+                {
+                    return false;
+                }
+
+                ++ in1;
+            }
+
+            return true;
+        }
+    };
+
+    /** @brief Аналог set_difference, копирующий элементы @c in1 сериями и пропускающий элементы
+    @c in2 с помощью экспоненциального поиска
+    */
+    struct set_difference_adaptive_fn
+    {
+        template <class RandomAccessCursor1, class RandomAccessCursor2, class OutputCursor
+                 , class Compare = std::less<>>
+        set_difference_result<RandomAccessCursor1, OutputCursor>
+        operator()(RandomAccessCursor1 in1, RandomAccessCursor2 in2, OutputCursor out
+                  , Compare cmp = {}) const
+        {
+            for(; !!in1 && !!in2 && !!out;)
+            {
+                if(saga::invoke(cmp, *in1, *in2))
+                {
+                    auto const num = detail::gallop_bound<false>(in1, *in2, cmp);
+
+                    detail::copy_front_n(in1, num, out);
+                }
+                else if(saga::invoke(cmp, *in2, *in1))
+                {
+                    ++ in2;
+                    in2.drop_front(detail::gallop_bound<false>(in2, *in1, cmp));
+                }
+                else
+                {
+                    ++ in1;
+                    ++ in2;
+                }
+            }
+
+            return saga::copy_fn{}(std::move(in1), std::move(out));
+        }
+    };
+
+    /** @brief Аналог set_intersection, пропускающий элементы с помощью экспоненциального поиска
+    @details Требует O(m log(n/m)) сравнений, где m и n -- размеры меньшего и большего из
+    курсоров
+    */
+    struct set_intersection_adaptive_fn
+    {
+        template <class RandomAccessCursor1, class RandomAccessCursor2, class OutputCursor
+                 , class Compare = std::less<>>
+        set_intersection_result<RandomAccessCursor1, RandomAccessCursor2, OutputCursor>
+        operator()(RandomAccessCursor1 in1, RandomAccessCursor2 in2, OutputCursor out
+                  , Compare cmp = {}) const
+        {
+            for(; !!in1 && !!in2 && !!out;)
+            {
+                if(saga::invoke(cmp, *in1, *in2))
+                {
+                    ++ in1;
+                    in1.drop_front(detail::gallop_bound<false>(in1, *in2, cmp));
+                }
+                else if(saga::invoke(cmp, *in2, *in1))
+                {
+                    ++ in2;
+                    in2.drop_front(detail::gallop_bound<false>(in2, *in1, cmp));
+                }
+                else
+                {
+                    out << *in1;
+                    ++ in1;
+                    ++ in2;
+                }
+            }
+
+            return {std::move(in1), std::move(in2), std::move(out)};
+        }
+    };
+
+    /// @brief Аналог set_union, копирующий серии элементов каждого из курсоров целиком
+    struct set_union_adaptive_fn
+    {
+        template <class RandomAccessCursor1, class RandomAccessCursor2, class OutputCursor
+                 , class Compare = std::less<>>
+        set_union_result<RandomAccessCursor1, RandomAccessCursor2, OutputCursor>
+        operator()(RandomAccessCursor1 in1, RandomAccessCursor2 in2, OutputCursor out
+                  , Compare cmp = {}) const
+        {
+            for(; !!in1 && !!in2 && !!out;)
+            {
+                if(saga::invoke(cmp, *in1, *in2))
+                {
+                    auto const num = detail::gallop_bound<false>(in1, *in2, cmp);
+
+                    detail::copy_front_n(in1, num, out);
+                }
+                else if(saga::invoke(cmp, *in2, *in1))
+                {
+                    auto const num = detail::gallop_bound<false>(in2, *in1, cmp);
+
+                    detail::copy_front_n(in2, num, out);
+                }
+                else
+                {
+                    out << *in1;
+                    ++ in1;
+                    ++ in2;
+                }
+            }
+
+            auto result1 = saga::copy_fn{}(std::move(in1), std::move(out));
+            auto result2 = saga::copy_fn{}(std::move(in2), std::move(result1.out));
+
+            return {std::move(result1.in), std::move(result2.in), std::move(result2.out)};
+        }
+    };
+
+    /** @brief Пересечение произвольного количества упорядоченных курсоров
+
+    Кандидаты берутся из самого короткого курсора и ищутся в остальных (в порядке возрастания
+    их размеров) экспоненциальным поиском. Если кандидат не найден, то самый короткий курсор
+    продвигается к первому элементу, который не меньше встреченного большего элемента.
+    Эквивалентный элемент выводится столько раз, сколько раз он встречается в курсоре, где он
+    встречается реже всего.
+
+    @param inputs интервал курсоров произвольного доступа
+    */
+    struct set_intersection_k_fn
+    {
+        template <class ForwardRange, class OutputCursor, class Compare = std::less<>>
+        OutputCursor operator()(ForwardRange && inputs, OutputCursor out, Compare cmp = {}) const
+        {
+            using Cursor = saga::remove_cvref_t<decltype(*saga::begin(inputs))>;
+
+            std::vector<Cursor> cursors(saga::begin(inputs), saga::end(inputs));
+
+            if(cursors.empty())
+            {
+                return out;
+            }
+
+            std::stable_sort(cursors.begin(), cursors.end()
+                            , [](Cursor const & lhs, Cursor const & rhs)
+                                { return saga::cursor::size(lhs) < saga::cursor::size(rhs); });
+
+            auto & smallest = cursors.front();
+
+            for(; !!smallest && !!out;)
+            {
+                auto found = true;
+
+                for(auto pos = std::next(cursors.begin()); pos != cursors.end(); ++pos)
+                {
+                    pos->drop_front(detail::gallop_bound<false>(*pos, *smallest, cmp));
+
+                    if(!*pos)
+                    {
+                        return out;
+                    }
+
+                    if(saga::invoke(cmp, *smallest, **pos))
+                    {
+                        smallest.drop_front(detail::gallop_bound<false>(smallest, **pos, cmp));
+                        found = false;
+                        break;
+                    }
+                }
+
+                if(found)
+                {
+                    out << *smallest;
+
+                    for(auto & cur : cursors)
+                    {
+                        ++ cur;
+                    }
+                }
+            }
+
+            return out;
+        }
+    };
+
     namespace detail
     {
         template <class IntType>
@@ -2715,6 +3121,24 @@ namespace saga
                 return result;
             }
 
+            constexpr auto use_simd_equal
+                = detail::use_simd_comparison<detail::is_equal_to_predicate
+                                             , BinaryPredicate, ForwardCursor>{};
+            constexpr auto use_simd_not_equal
+                = detail::use_simd_comparison<detail::is_not_equal_to_predicate
+                                             , BinaryPredicate, ForwardCursor>{};
+
+            if constexpr (use_simd_equal || use_simd_not_equal)
+            {
+                auto const data = detail::simd_data(cur);
+                auto const num = static_cast<std::size_t>(cur.size() - 1);
+
+                auto const n_equal = detail::simd_count_equal(data, data + 1, num);
+
+                return static_cast<cursor_difference_t<ForwardCursor>>(use_simd_equal ? n_equal
+                                                                       : num - n_equal);
+            }
+
             auto cur_2 = cur;
             ++ cur_2;
 
@@ -2813,6 +3237,12 @@ namespace saga
     inline constexpr auto const set_symmetric_difference = set_symmetric_difference_fn{};
     inline constexpr auto const set_union = set_union_fn{};
 
+    inline constexpr auto const includes_adaptive = includes_adaptive_fn{};
+    inline constexpr auto const set_difference_adaptive = set_difference_adaptive_fn{};
+    inline constexpr auto const set_intersection_adaptive = set_intersection_adaptive_fn{};
+    inline constexpr auto const set_union_adaptive = set_union_adaptive_fn{};
+    inline constexpr auto const set_intersection_k = set_intersection_k_fn{};
+
     inline constexpr auto const is_heap = is_heap_fn{};
     inline constexpr auto const is_heap_until = is_heap_until_fn{};
     inline constexpr auto const make_heap = make_heap_fn{};
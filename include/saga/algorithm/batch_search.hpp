@@ -0,0 +1,325 @@
+/* (c) 2026 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки SAGA.
+
+SAGA -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#ifndef Z_SAGA_ALGORITHM_BATCH_SEARCH_HPP_INCLUDED
+#define Z_SAGA_ALGORITHM_BATCH_SEARCH_HPP_INCLUDED
+
+/** @file saga/algorithm/batch_search.hpp
+ @brief Двоичный поиск сразу многих значений в одной упорядоченной последовательности
+
+ При поиске значений по одному каждое следующее обращение к памяти зависит от предыдущего, поэтому
+ для больших последовательностей время поиска определяется задержкой памяти. Здесь поиск ведётся
+ группами: двоичные поиски нескольких значений выполняются поочерёдно по одному шагу, так что их
+ обращения к памяти перекрываются, а для непрерывных последовательностей элементы, нужные на
+ следующем шаге, загружаются в кэш заранее. Каждый шаг выполняется без ветвлений.
+
+ Если искомые значения упорядочены, то вместо этого выполняется слияние с экспоненциальным
+ («галопирующим») поиском от позиции предыдущего значения: O(m log(n/m)) сравнений для m значений.
+*/
+
+#include <saga/algorithm/result_types.hpp>
+#include <saga/cursor/cursor_traits.hpp>
+#include <saga/functional.hpp>
+
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <type_traits>
+
+namespace saga
+{
+    namespace detail
+    {
+        /// @brief Количество значений, поиск которых выполняется одновременно
+        inline constexpr std::size_t batch_search_group = 16;
+
+        template <class T, class Size>
+        void batch_search_prefetch(T const * base, Size index)
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            __builtin_prefetch(base + index);
+#else
+            static_cast<void>(base);
+            static_cast<void>(index);
+#endif
+        }
+
+        template <class Base, class Size>
+        void batch_search_prefetch(Base const &, Size)
+        {}
+
+        /** @brief Индекс первого элемента <tt>base[0..num)</tt>, для которого
+        <tt>before(base[i], value)</tt> ложно, для значений, упорядоченных по @c cmp
+        */
+        template <class Base, class Size, class QueryCursor, class Before, class Sink>
+        QueryCursor batch_search_sorted(Base const & base, Size num, QueryCursor queries
+                                       , Before & before, Sink & sink)
+        {
+            auto pos = Size(0);
+
+            for(; !!queries; ++queries)
+            {
+                auto const & value = *queries;
+
+                if(pos < num && before(base[pos], value))
+                {
+                    // Индексы меньше first заведомо подходят, ответ не больше last
+                    auto first = pos + 1;
+                    auto last = num;
+
+                    for(auto step = Size(1); first + step - 1 < num; step *= 2)
+                    {
+                        auto const probe = first + step - 1;
+
+                        if(!before(base[probe], value))
+                        {
+                            last = probe;
+                            break;
+                        }
+
+                        first = probe + 1;
+                    }
+
+                    for(; first < last;)
+                    {
+                        auto const middle = first + (last - first) / 2;
+
+                        if(before(base[middle], value))
+                        {
+                            first = middle + 1;
+                        }
+                        else
+                        {
+                            last = middle;
+                        }
+                    }
+
+                    pos = first;
+                }
+
+                sink(pos);
+            }
+
+            return queries;
+        }
+
+        /** @brief Поиск групп значений: двоичные поиски выполняются поочерёдно по одному шагу
+        */
+        template <class Base, class Size, class QueryCursor, class Before, class Sink>
+        QueryCursor batch_search_interleaved(Base const & base, Size num, QueryCursor queries
+                                            , Before & before, Sink & sink)
+        {
+            using Value = std::remove_reference_t<cursor_reference_t<QueryCursor>>;
+
+            constexpr auto group = detail::batch_search_group;
+
+            Value const * values[group];
+            Size positions[group];
+
+            for(; !!queries;)
+            {
+                auto count = std::size_t(0);
+
+                for(; count < group && !!queries; ++count, ++queries)
+                {
+                    values[count] = std::addressof(*queries);
+                    positions[count] = 0;
+                }
+
+                if(num > 0)
+                {
+                    auto len = num;
+
+                    for(; len > 1;)
+                    {
+                        auto const half = len / 2;
+                        len -= half;
+
+                        for(auto index = std::size_t(0); index < count; ++index)
+                        {
+                            auto const is_before = before(base[positions[index] + half - 1]
+                                                         , *values[index]);
+
+                            positions[index] += is_before ? half : Size(0);
+
+                            // Элемент, который будет проверен на следующем шаге
+                            detail::batch_search_prefetch(base, positions[index]
+                                                          + (len > 1 ? len / 2 - 1 : Size(0)));
+                        }
+                    }
+
+                    for(auto index = std::size_t(0); index < count; ++index)
+                    {
+                        positions[index] += before(base[positions[index]], *values[index])
+                                          ? Size(1) : Size(0);
+                    }
+                }
+
+                for(auto index = std::size_t(0); index < count; ++index)
+                {
+                    sink(positions[index]);
+                }
+            }
+
+            return queries;
+        }
+
+        template <class RandomAccessCursor, class ForwardCursor, class Before, class Sink>
+        ForwardCursor batch_search(RandomAccessCursor const & haystack, ForwardCursor queries
+                                  , Before before, bool queries_sorted, Sink sink)
+        {
+            static_assert(std::is_lvalue_reference<cursor_reference_t<ForwardCursor>>{}
+                          , "Values must be addressable");
+
+            auto const num = saga::cursor::size(haystack);
+
+            if constexpr(saga::is_contiguous_cursor<RandomAccessCursor>{})
+            {
+                auto const * const base = haystack.data();
+
+                if(queries_sorted)
+                {
+                    return detail::batch_search_sorted(base, num, std::move(queries)
+                                                      , before, sink);
+                }
+
+                return detail::batch_search_interleaved(base, num, std::move(queries)
+                                                       , before, sink);
+            }
+            else
+            {
+                if(queries_sorted)
+                {
+                    return detail::batch_search_sorted(haystack, num, std::move(queries)
+                                                      , before, sink);
+                }
+
+                return detail::batch_search_interleaved(haystack, num, std::move(queries)
+                                                       , before, sink);
+            }
+        }
+
+        template <class ForwardCursor, class Compare>
+        bool batch_search_is_sorted(ForwardCursor cur, Compare & cmp)
+        {
+            if(!cur)
+            {
+                return true;
+            }
+
+            auto prev = cur;
+            ++cur;
+
+            for(; !!cur; ++cur, ++prev)
+            {
+                if(saga::invoke(cmp, *cur, *prev))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+    }
+    // namespace detail
+
+    /** @brief Поиск многих значений: аналог lower_bound для каждого из значений @c queries
+    @param haystack курсор произвольного доступа, упорядоченный по @c cmp
+    @param queries искомые значения, ссылка на элемент должна быть lvalue
+    @param out курсор вывода, в который записываются индексы позиций (от начала @c haystack) в
+    порядке следования значений
+    */
+    struct lower_bound_batch_fn
+    {
+        template <class RandomAccessCursor, class ForwardCursor, class OutputCursor
+                 , class Compare = std::less<>>
+        in_out_result<ForwardCursor, OutputCursor>
+        operator()(RandomAccessCursor const & haystack, ForwardCursor queries, OutputCursor out
+                  , Compare cmp = {}) const
+        {
+            auto const before = [&cmp](auto const & elem, auto const & value)
+                { return saga::invoke(cmp, elem, value); };
+
+            auto const sorted = detail::batch_search_is_sorted(queries, cmp);
+
+            auto result = detail::batch_search(haystack, std::move(queries), before, sorted
+                                              , [&out](auto index) { out << index; });
+
+            return {std::move(result), std::move(out)};
+        }
+    };
+
+    /// @brief Поиск многих значений: аналог upper_bound для каждого из значений @c queries
+    struct upper_bound_batch_fn
+    {
+        template <class RandomAccessCursor, class ForwardCursor, class OutputCursor
+                 , class Compare = std::less<>>
+        in_out_result<ForwardCursor, OutputCursor>
+        operator()(RandomAccessCursor const & haystack, ForwardCursor queries, OutputCursor out
+                  , Compare cmp = {}) const
+        {
+            auto const before = [&cmp](auto const & elem, auto const & value)
+                { return !saga::invoke(cmp, value, elem); };
+
+            auto const sorted = detail::batch_search_is_sorted(queries, cmp);
+
+            auto result = detail::batch_search(haystack, std::move(queries), before, sorted
+                                              , [&out](auto index) { out << index; });
+
+            return {std::move(result), std::move(out)};
+        }
+    };
+
+    /// @brief Поиск многих значений: аналог binary_search для каждого из значений @c queries
+    struct binary_search_batch_fn
+    {
+        template <class RandomAccessCursor, class ForwardCursor, class OutputCursor
+                 , class Compare = std::less<>>
+        in_out_result<ForwardCursor, OutputCursor>
+        operator()(RandomAccessCursor const & haystack, ForwardCursor queries, OutputCursor out
+                  , Compare cmp = {}) const
+        {
+            auto const before = [&cmp](auto const & elem, auto const & value)
+                { return saga::invoke(cmp, elem, value); };
+
+            auto const sorted = detail::batch_search_is_sorted(queries, cmp);
+            auto const num = saga::cursor::size(haystack);
+
+            auto value_pos = queries;
+
+            auto sink = [&](auto index)
+            {
+                out << (index != num && !saga::invoke(cmp, *value_pos, haystack[index]));
+                ++value_pos;
+            };
+
+            auto result = detail::batch_search(haystack, std::move(queries), before, sorted
+                                              , std::move(sink));
+
+            return {std::move(result), std::move(out)};
+        }
+    };
+
+    inline constexpr auto const lower_bound_batch = lower_bound_batch_fn{};
+    inline constexpr auto const upper_bound_batch = upper_bound_batch_fn{};
+    inline constexpr auto const binary_search_batch = binary_search_batch_fn{};
+}
+// namespace saga
+
+#endif
+// Z_SAGA_ALGORITHM_BATCH_SEARCH_HPP_INCLUDED
@@ -23,21 +23,69 @@ SAGA -- это свободной программное обеспечение:
 */
 
 #include <saga/algorithm/result_types.hpp>
+#include <saga/cursor/cursor_traits.hpp>
 
+#include <algorithm>
 #include <utility>
 
 namespace saga
 {
     struct copy_fn
     {
+    private:
+        // Копирует не более чем segment.size() элементов, возвращает количество скопированных
+        template <class Segment, class OutputCursor>
+        static constexpr auto copy_segment(Segment segment, OutputCursor & out)
+        {
+            using Difference = decltype(segment.size());
+
+            auto num = segment.size();
+
+            if constexpr (saga::detail::is_sized_cursor<OutputCursor>{})
+            {
+                num = std::min(num, Difference(out.size()));
+
+                for(auto rest = num; rest > 0; --rest)
+                {
+                    out << segment.front();
+                    segment.drop_front();
+                }
+
+                return num;
+            }
+            else
+            {
+                auto count = Difference(0);
+
+                for(; count < num && !!out; ++count)
+                {
+                    out << segment.front();
+                    segment.drop_front();
+                }
+
+                return count;
+            }
+        }
+
+    public:
         template <class InputCursor, class OutputCursor>
         constexpr
         in_out_result<InputCursor, OutputCursor>
         operator()(InputCursor in, OutputCursor out) const
         {
-            for(; !!in && !!out; ++in)
+            if constexpr (saga::is_segmented_cursor<InputCursor>{})
+            {
+                while(!!in && !!out)
+                {
+                    in.drop_front_segment(copy_fn::copy_segment(in.front_segment(), out));
+                }
+            }
+            else
             {
-                out << *in;
+                for(; !!in && !!out; ++in)
+                {
+                    out << *in;
+                }
             }
 
             return {std::move(in), std::move(out)};
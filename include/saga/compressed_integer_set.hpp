@@ -0,0 +1,616 @@
+/* (c) 2026 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки SAGA.
+
+SAGA -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#ifndef Z_SAGA_COMPRESSED_INTEGER_SET_HPP_INCLUDED
+#define Z_SAGA_COMPRESSED_INTEGER_SET_HPP_INCLUDED
+
+/** @file saga/compressed_integer_set.hpp
+ @brief Неизменяемое сжатое множество беззнаковых целых чисел
+
+ Элементы хранятся блоками по 128: для каждого блока сохраняются разности соседних элементов,
+ уменьшенные на единицу, упакованные в наименьшее достаточное для них количество битов. Первый
+ элемент блока отсчитывается от максимума предыдущего блока. Максимумы блоков образуют индекс,
+ поэтому для поиска распаковывается только один блок, а при вычислении пересечения и разности
+ блоки, не пересекающиеся с другим множеством, пропускаются без распаковки.
+
+ Для плотных множеств (например, 10^9 идентификаторов из 2^32 возможных) разности занимают
+ несколько битов, и на элемент приходится 1-2 байта вместо 4-8. Изменять множество нельзя: оно
+ создаётся за O(n) из flat_set или упорядоченного интервала без повторяющихся элементов.
+*/
+
+#include <saga/algorithm.hpp>
+#include <saga/cursor/subrange.hpp>
+#include <saga/detail/simd_bitpack.hpp>
+#include <saga/flat_set.hpp>
+#include <saga/utility/operators.hpp>
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace saga
+{
+    template <class UInt>
+    class compressed_integer_set;
+
+    /** @brief Итератор compressed_integer_set: элементы распаковываются по одному при
+    продвижении
+    @details Разыменование возвращает значение, а не ссылку
+    */
+    template <class UInt>
+    class compressed_integer_set_iterator
+     : operators::incrementable<compressed_integer_set_iterator<UInt>
+     , operators::equality_comparable<compressed_integer_set_iterator<UInt>>>
+    {
+        friend bool operator==(compressed_integer_set_iterator const & lhs
+                              , compressed_integer_set_iterator const & rhs)
+        {
+            assert(lhs.set_ == rhs.set_);
+
+            return lhs.block_ == rhs.block_ && lhs.pos_ == rhs.pos_;
+        }
+
+    public:
+        // Типы
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = UInt;
+        using difference_type = std::ptrdiff_t;
+        using pointer = UInt const *;
+        using reference = UInt;
+
+        // Создание, копирование, уничтожение
+        compressed_integer_set_iterator() = default;
+
+        /** @brief Итератор, указывающий на элемент с номером @c pos в блоке @c block
+        @param value значение этого элемента
+        */
+        compressed_integer_set_iterator(compressed_integer_set<UInt> const & set
+                                       , std::size_t block, std::size_t pos, UInt value)
+         : set_(std::addressof(set))
+         , block_(block)
+         , pos_(pos)
+         , value_(value)
+        {}
+
+        // Итератор
+        reference operator*() const
+        {
+            assert(this->block_ < this->set_->block_count_private());
+
+            return this->value_;
+        }
+
+        pointer operator->() const
+        {
+            return std::addressof(this->value_);
+        }
+
+        compressed_integer_set_iterator & operator++()
+        {
+            ++ this->pos_;
+
+            if(this->pos_ == this->set_->block_size_private(this->block_))
+            {
+                ++ this->block_;
+                this->pos_ = 0;
+
+                if(this->block_ < this->set_->block_count_private())
+                {
+                    this->value_ = this->set_->block_first_private(this->block_)
+                                 + this->set_->delta_private(this->block_, 0);
+                }
+            }
+            else
+            {
+                this->value_ += this->set_->delta_private(this->block_, this->pos_) + 1;
+            }
+
+            return *this;
+        }
+
+    private:
+        compressed_integer_set<UInt> const * set_ = nullptr;
+        std::size_t block_ = 0;
+        std::size_t pos_ = 0;
+        UInt value_ = 0;
+    };
+
+    /** @brief Неизменяемое множество беззнаковых целых чисел, хранящее упакованные разности
+    @tparam UInt std::uint32_t или std::uint64_t
+    */
+    template <class UInt = std::uint32_t>
+    class compressed_integer_set
+    {
+        friend class compressed_integer_set_iterator<UInt>;
+
+        using Traits = detail::bitpack_traits<UInt>;
+
+    public:
+        // Типы
+        using key_type        = UInt;
+        using value_type      = UInt;
+        using key_compare     = std::less<UInt>;
+        using value_compare   = std::less<UInt>;
+        using reference       = value_type;
+        using const_reference = value_type;
+        using size_type       = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using iterator        = compressed_integer_set_iterator<UInt>;
+        using const_iterator  = compressed_integer_set_iterator<UInt>;
+
+        /// @brief Количество элементов в блоке
+        static constexpr size_type block_size = detail::bitpack_block_size;
+
+        // Создание, копирование, уничтожение
+        compressed_integer_set() = default;
+
+        /// @brief Создание по элементам @c src за O(n)
+        template <class Compare, class KeyContainer>
+        explicit compressed_integer_set(saga::flat_set<UInt, Compare, KeyContainer> const & src)
+         : compressed_integer_set(saga::sorted_unique, src.begin(), src.end())
+        {
+            static_assert(detail::is_less_predicate<Compare, UInt>{}
+                          , "Elements must be sorted in ascending order");
+        }
+
+        /** @brief Создание по упорядоченному интервалу за O(n)
+        @pre Интервал <tt>[first, last)</tt> строго возрастает
+        */
+        template <class InputIterator>
+        compressed_integer_set(sorted_unique_t, InputIterator first, InputIterator last)
+        {
+            std::array<UInt, block_size> values;
+            auto num = size_type(0);
+
+            for(; first != last; ++first)
+            {
+                values[num] = *first;
+                ++ num;
+
+                if(num == block_size)
+                {
+                    this->append_block_private(values, num);
+                    num = 0;
+                }
+            }
+
+            if(num > 0)
+            {
+                this->append_block_private(values, num);
+            }
+        }
+
+        // Итераторы
+        const_iterator begin() const
+        {
+            if(this->empty())
+            {
+                return this->end();
+            }
+
+            return const_iterator(*this, 0, 0, this->delta_private(0, 0));
+        }
+
+        const_iterator end() const
+        {
+            return const_iterator(*this, this->block_count_private(), 0, 0);
+        }
+
+        const_iterator cbegin() const
+        {
+            return this->begin();
+        }
+
+        const_iterator cend() const
+        {
+            return this->end();
+        }
+
+        // Размер
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return this->size_ == 0;
+        }
+
+        size_type size() const noexcept
+        {
+            return this->size_;
+        }
+
+        /// @brief Объём памяти (в байтах), занимаемый упакованными элементами и индексом блоков
+        size_type memory_size() const noexcept
+        {
+            return this->packed_.size() * sizeof(UInt)
+                   + this->block_max_.size() * sizeof(UInt)
+                   + this->block_offset_.size() * sizeof(size_type);
+        }
+
+        // Немодифицирующие операции
+        key_compare key_comp() const
+        {
+            return key_compare();
+        }
+
+        value_compare value_comp() const
+        {
+            return value_compare();
+        }
+
+        // Операции множества
+        /// @brief Итератор на первый элемент, не меньший @c key, или end()
+        const_iterator lower_bound(key_type const & key) const
+        {
+            auto const block = this->find_block_private(0, key);
+
+            if(block == this->block_count_private())
+            {
+                return this->end();
+            }
+
+            std::array<UInt, block_size> values;
+            this->decode_private(block, values.data());
+
+            // Фиктивные значения в конце последнего блока не упорядочены
+            auto const cur = saga::make_subrange_cursor(values.begin()
+                                                       , values.begin()
+                                                         + this->block_size_private(block)
+                                                       , unsafe_tag_t{});
+
+            auto const pos = saga::lower_bound(cur, key).begin();
+            auto const index = static_cast<size_type>(pos - values.begin());
+
+            return const_iterator(*this, block, index, *pos);
+        }
+
+        /// @brief Итератор на первый элемент, больший @c key, или end()
+        const_iterator upper_bound(key_type const & key) const
+        {
+            if(key == std::numeric_limits<UInt>::max())
+            {
+                return this->end();
+            }
+
+            return this->lower_bound(key + 1);
+        }
+
+        const_iterator find(key_type const & key) const
+        {
+            auto const pos = this->lower_bound(key);
+
+            return (pos != this->end() && *pos == key) ? pos : this->end();
+        }
+
+        bool contains(key_type const & key) const
+        {
+            return this->find(key) != this->end();
+        }
+
+        size_type count(key_type const & key) const
+        {
+            return this->contains(key) ? 1 : 0;
+        }
+
+        std::pair<const_iterator, const_iterator> equal_range(key_type const & key) const
+        {
+            return {this->lower_bound(key), this->upper_bound(key)};
+        }
+
+        // Теоретико-множественные операции
+        /// @brief Проверка того, что все элементы @c other содержатся в данном множестве
+        bool includes(compressed_integer_set const & other) const
+        {
+            block_reader lhs(*this);
+
+            for(block_reader rhs(other); !!rhs; rhs.drop_front())
+            {
+                lhs.seek(rhs.front());
+
+                if(!lhs || lhs.front() != rhs.front())
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        /// @brief Вывод элементов, содержащихся в обоих множествах, в порядке возрастания
+        template <class OutputCursor>
+        OutputCursor set_intersection(compressed_integer_set const & other, OutputCursor out) const
+        {
+            block_reader lhs(*this);
+            block_reader rhs(other);
+
+            for(; !!lhs && !!rhs && !!out;)
+            {
+                if(lhs.front() < rhs.front())
+                {
+                    lhs.seek(rhs.front());
+                }
+                else if(rhs.front() < lhs.front())
+                {
+                    rhs.seek(lhs.front());
+                }
+                else
+                {
+                    out << lhs.front();
+                    lhs.drop_front();
+                    rhs.drop_front();
+                }
+            }
+
+            return out;
+        }
+
+        /// @brief Вывод элементов, не содержащихся в @c other, в порядке возрастания
+        template <class OutputCursor>
+        OutputCursor set_difference(compressed_integer_set const & other, OutputCursor out) const
+        {
+            block_reader lhs(*this);
+            block_reader rhs(other);
+
+            for(; !!lhs && !!out;)
+            {
+                if(!!rhs && rhs.front() < lhs.front())
+                {
+                    rhs.seek(lhs.front());
+                }
+                else if(!rhs || lhs.front() < rhs.front())
+                {
+                    out << lhs.front();
+                    lhs.drop_front();
+                }
+                else
+                {
+                    lhs.drop_front();
+                    rhs.drop_front();
+                }
+            }
+
+            return out;
+        }
+
+        /// @brief Вывод элементов, содержащихся хотя бы в одном из множеств, в порядке возрастания
+        template <class OutputCursor>
+        OutputCursor set_union(compressed_integer_set const & other, OutputCursor out) const
+        {
+            block_reader lhs(*this);
+            block_reader rhs(other);
+
+            for(; (!!lhs || !!rhs) && !!out;)
+            {
+                if(!rhs || (!!lhs && lhs.front() < rhs.front()))
+                {
+                    out << lhs.front();
+                    lhs.drop_front();
+                }
+                else if(!lhs || rhs.front() < lhs.front())
+                {
+                    out << rhs.front();
+                    rhs.drop_front();
+                }
+                else
+                {
+                    out << lhs.front();
+                    lhs.drop_front();
+                    rhs.drop_front();
+                }
+            }
+
+            return out;
+        }
+
+        friend bool operator==(compressed_integer_set const & lhs
+                              , compressed_integer_set const & rhs)
+        {
+            // Представление однозначно определяется элементами
+            return lhs.size_ == rhs.size_
+                   && lhs.block_max_ == rhs.block_max_
+                   && lhs.packed_ == rhs.packed_;
+        }
+
+        friend bool operator!=(compressed_integer_set const & lhs
+                              , compressed_integer_set const & rhs)
+        {
+            return !(lhs == rhs);
+        }
+
+    private:
+        /** @brief Последовательный просмотр с распаковкой блоков целиком и пропуском блоков,
+        все элементы которых меньше заданного значения
+        */
+        class block_reader
+        {
+        public:
+            explicit block_reader(compressed_integer_set const & set)
+             : set_(set)
+            {
+                this->load(0);
+            }
+
+            bool operator!() const
+            {
+                return this->block_ == this->set_.block_count_private();
+            }
+
+            UInt front() const
+            {
+                assert(!!*this);
+
+                return this->values_[this->pos_];
+            }
+
+            void drop_front()
+            {
+                assert(!!*this);
+
+                ++ this->pos_;
+
+                if(this->pos_ == this->num_)
+                {
+                    this->load(this->block_ + 1);
+                }
+            }
+
+            /// @brief Переход к первому элементу, не меньшему @c value
+            void seek(UInt value)
+            {
+                if(!*this || !(this->front() < value))
+                {
+                    return;
+                }
+
+                if(this->set_.block_max_[this->block_] < value)
+                {
+                    this->load(this->set_.find_block_private(this->block_ + 1, value));
+
+                    if(!*this)
+                    {
+                        return;
+                    }
+                }
+
+                // В блоке есть элемент, не меньший value: граница не нужна
+                for(; this->values_[this->pos_] < value;)
+                {
+                    ++ this->pos_;
+                }
+            }
+
+        private:
+            void load(size_type block)
+            {
+                this->block_ = block;
+                this->pos_ = 0;
+
+                if(!!*this)
+                {
+                    this->num_ = this->set_.block_size_private(block);
+                    this->set_.decode_private(block, this->values_.data());
+                }
+            }
+
+            compressed_integer_set const & set_;
+            size_type block_ = 0;
+            size_type pos_ = 0;
+            size_type num_ = 0;
+            std::array<UInt, block_size> values_;
+        };
+
+        size_type block_count_private() const
+        {
+            return this->block_max_.size();
+        }
+
+        size_type block_size_private(size_type block) const
+        {
+            assert(block < this->block_count_private());
+
+            return (block + 1 < this->block_count_private())
+                   ? block_size : this->size_ - block * block_size;
+        }
+
+        unsigned block_width_private(size_type block) const
+        {
+            auto const words = this->block_offset_[block + 1] - this->block_offset_[block];
+
+            return static_cast<unsigned>(words / Traits::lanes);
+        }
+
+        /// @brief Наименьшее значение, которое может быть первым элементом блока
+        UInt block_first_private(size_type block) const
+        {
+            return (block == 0) ? UInt(0) : static_cast<UInt>(this->block_max_[block - 1] + 1);
+        }
+
+        UInt delta_private(size_type block, size_type pos) const
+        {
+            return detail::bitpack_get(this->packed_.data() + this->block_offset_[block]
+                                      , this->block_width_private(block), pos);
+        }
+
+        /// @brief Распаковка блока: записывается block_size значений, в том числе фиктивных
+        void decode_private(size_type block, UInt * out) const
+        {
+            detail::bitpack_decode(this->packed_.data() + this->block_offset_[block]
+                                  , this->block_width_private(block)
+                                  , this->block_first_private(block), out);
+        }
+
+        /// @brief Номер первого блока, начиная с @c first, максимум которого не меньше @c key
+        size_type find_block_private(size_type first, UInt key) const
+        {
+            if(first == this->block_count_private())
+            {
+                return first;
+            }
+
+            auto const cur = saga::make_subrange_cursor(this->block_max_.begin() + first
+                                                       , this->block_max_.end(), unsafe_tag_t{});
+
+            auto const pos = saga::lower_bound(cur, key).begin();
+
+            return static_cast<size_type>(pos - this->block_max_.begin());
+        }
+
+        void append_block_private(std::array<UInt, block_size> const & values, size_type num)
+        {
+            assert(0 < num && num <= block_size);
+            assert(this->block_max_.empty() || this->block_max_.back() < values[0]);
+
+            auto const first = this->block_first_private(this->block_count_private());
+
+            std::array<UInt, block_size> deltas{};
+            deltas[0] = values[0] - first;
+
+            auto bits = deltas[0];
+
+            for(auto index = size_type(1); index < num; ++index)
+            {
+                assert(values[index - 1] < values[index]);
+
+                deltas[index] = values[index] - values[index - 1] - 1;
+                bits |= deltas[index];
+            }
+
+            auto const width = detail::bitpack_width(bits);
+            auto const old_size = this->packed_.size();
+
+            this->packed_.resize(old_size + width * Traits::lanes);
+            detail::bitpack_pack(deltas.data(), width, this->packed_.data() + old_size);
+
+            this->block_offset_.push_back(this->packed_.size());
+            this->block_max_.push_back(values[num - 1]);
+            this->size_ += num;
+        }
+
+        size_type size_ = 0;
+        std::vector<UInt> block_max_;
+        std::vector<size_type> block_offset_ = std::vector<size_type>(1, 0);
+        std::vector<UInt> packed_;
+    };
+}
+// namespace saga
+
+#endif
+// Z_SAGA_COMPRESSED_INTEGER_SET_HPP_INCLUDED
@@ -0,0 +1,860 @@
+/* (c) 2026 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки SAGA.
+
+SAGA -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#ifndef Z_SAGA_CONTAINER_SMALL_VECTOR_HPP_INCLUDED
+#define Z_SAGA_CONTAINER_SMALL_VECTOR_HPP_INCLUDED
+
+/** @file saga/container/small_vector.hpp
+ @brief Вектор, хранящий до N элементов внутри объекта, без обращения к динамической памяти
+
+ Пока количество элементов не превосходит N, они размещаются во встроенном буфере. При большем
+ размере элементы переносятся в память, выделенную распределителем памяти, как у std::vector.
+ Обратно во встроенный буфер они возвращаются только при shrink_to_fit.
+*/
+
+#include <saga/algorithm.hpp>
+#include <saga/cursor/subrange.hpp>
+#include <saga/iterator.hpp>
+#include <saga/iterator/reverse.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace saga
+{
+    namespace detail
+    {
+        template <class Iterator>
+        using require_input_iterator
+            = std::enable_if_t<std::is_base_of<std::input_iterator_tag
+                                              , saga::iterator_category_t<Iterator>>{}>;
+    }
+    // namespace detail
+
+    /** @brief Последовательный контейнер со встроенным буфером на @c N элементов
+    @tparam T тип элементов
+    @tparam N количество элементов, размещаемых без выделения динамической памяти
+    @tparam Allocator распределитель памяти, используемый при размере, большем @c N
+    */
+    template <class T, std::size_t N, class Allocator = std::allocator<T>>
+    class small_vector
+     : private Allocator
+    {
+        using alloc_traits = std::allocator_traits<Allocator>;
+
+        static_assert(std::is_same<T, typename alloc_traits::value_type>{});
+        static_assert(std::is_same<T *, typename alloc_traits::pointer>{}
+                      , "Allocator must use raw pointers");
+
+    public:
+        // Типы
+        using value_type             = T;
+        using allocator_type         = Allocator;
+        using size_type              = std::size_t;
+        using difference_type        = std::ptrdiff_t;
+        using reference              = value_type &;
+        using const_reference        = value_type const &;
+        using pointer                = value_type *;
+        using const_pointer          = value_type const *;
+        using iterator               = pointer;
+        using const_iterator         = const_pointer;
+        using reverse_iterator       = saga::reverse_iterator<iterator>;
+        using const_reverse_iterator = saga::reverse_iterator<const_iterator>;
+
+        /// @brief Количество элементов, размещаемых во встроенном буфере
+        static constexpr size_type inline_capacity = N;
+
+        // Создание, копирование, уничтожение
+        small_vector() noexcept(noexcept(Allocator()))
+         : small_vector(Allocator())
+        {}
+
+        explicit small_vector(Allocator const & alloc) noexcept
+         : Allocator(alloc)
+        {}
+
+        explicit small_vector(size_type num, Allocator const & alloc = Allocator())
+         : small_vector(alloc)
+        {
+            this->resize(num);
+        }
+
+        small_vector(size_type num, value_type const & value
+                    , Allocator const & alloc = Allocator())
+         : small_vector(alloc)
+        {
+            this->assign(num, value);
+        }
+
+        template <class InputIterator
+                 , class = detail::require_input_iterator<InputIterator>>
+        small_vector(InputIterator first, InputIterator last
+                    , Allocator const & alloc = Allocator())
+         : small_vector(alloc)
+        {
+            this->assign(std::move(first), std::move(last));
+        }
+
+        small_vector(std::initializer_list<value_type> values
+                    , Allocator const & alloc = Allocator())
+         : small_vector(values.begin(), values.end(), alloc)
+        {}
+
+        small_vector(small_vector const & other)
+         : small_vector(other
+                       , alloc_traits::select_on_container_copy_construction(other.alloc_ref()))
+        {}
+
+        small_vector(small_vector const & other, Allocator const & alloc)
+         : small_vector(other.begin(), other.end(), alloc)
+        {}
+
+        small_vector(small_vector && other)
+        noexcept(std::is_nothrow_move_constructible<value_type>{})
+         : small_vector(other.alloc_ref())
+        {
+            this->steal_or_move_private(other);
+        }
+
+        small_vector(small_vector && other, Allocator const & alloc)
+         : small_vector(alloc)
+        {
+            if(other.is_inline_private() || this->alloc_ref() == other.alloc_ref())
+            {
+                this->steal_or_move_private(other);
+            }
+            else
+            {
+                this->assign(std::make_move_iterator(other.begin())
+                            , std::make_move_iterator(other.end()));
+                other.clear();
+            }
+        }
+
+        ~small_vector()
+        {
+            this->clear();
+            this->deallocate_private();
+        }
+
+        small_vector & operator=(small_vector const & other)
+        {
+            if(this == &other)
+            {
+                return *this;
+            }
+
+            if constexpr(alloc_traits::propagate_on_container_copy_assignment::value)
+            {
+                if(this->alloc_ref() != other.alloc_ref())
+                {
+                    this->clear();
+                    this->deallocate_private();
+                }
+
+                this->alloc_ref() = other.alloc_ref();
+            }
+
+            this->assign(other.begin(), other.end());
+
+            return *this;
+        }
+
+        small_vector & operator=(small_vector && other)
+        noexcept((alloc_traits::propagate_on_container_move_assignment::value
+                  || alloc_traits::is_always_equal::value)
+                 && std::is_nothrow_move_constructible<value_type>{})
+        {
+            if(this == &other)
+            {
+                return *this;
+            }
+
+            constexpr auto propagate = alloc_traits::propagate_on_container_move_assignment::value;
+
+            if(propagate || this->alloc_ref() == other.alloc_ref())
+            {
+                this->clear();
+                this->deallocate_private();
+
+                if constexpr(propagate)
+                {
+                    this->alloc_ref() = std::move(other.alloc_ref());
+                }
+
+                this->steal_or_move_private(other);
+            }
+            else
+            {
+                this->assign(std::make_move_iterator(other.begin())
+                            , std::make_move_iterator(other.end()));
+                other.clear();
+            }
+
+            return *this;
+        }
+
+        small_vector & operator=(std::initializer_list<value_type> values)
+        {
+            this->assign(values.begin(), values.end());
+
+            return *this;
+        }
+
+        void assign(size_type num, value_type const & value)
+        {
+            this->clear();
+            this->reserve(num);
+
+            for(; num > 0; --num)
+            {
+                this->emplace_back(value);
+            }
+        }
+
+        template <class InputIterator
+                 , class = detail::require_input_iterator<InputIterator>>
+        void assign(InputIterator first, InputIterator last)
+        {
+            this->clear();
+            this->append_private(std::move(first), std::move(last));
+        }
+
+        void assign(std::initializer_list<value_type> values)
+        {
+            this->assign(values.begin(), values.end());
+        }
+
+        allocator_type get_allocator() const noexcept
+        {
+            return this->alloc_ref();
+        }
+
+        // Итераторы
+        iterator begin() noexcept
+        {
+            return this->data_;
+        }
+
+        const_iterator begin() const noexcept
+        {
+            return this->data_;
+        }
+
+        iterator end() noexcept
+        {
+            return this->data_ + this->size_;
+        }
+
+        const_iterator end() const noexcept
+        {
+            return this->data_ + this->size_;
+        }
+
+        reverse_iterator rbegin() noexcept
+        {
+            return reverse_iterator(this->end());
+        }
+
+        const_reverse_iterator rbegin() const noexcept
+        {
+            return const_reverse_iterator(this->end());
+        }
+
+        reverse_iterator rend() noexcept
+        {
+            return reverse_iterator(this->begin());
+        }
+
+        const_reverse_iterator rend() const noexcept
+        {
+            return const_reverse_iterator(this->begin());
+        }
+
+        const_iterator cbegin() const noexcept
+        {
+            return this->begin();
+        }
+
+        const_iterator cend() const noexcept
+        {
+            return this->end();
+        }
+
+        const_reverse_iterator crbegin() const noexcept
+        {
+            return this->rbegin();
+        }
+
+        const_reverse_iterator crend() const noexcept
+        {
+            return this->rend();
+        }
+
+        // Размер и ёмкость
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return this->size_ == 0;
+        }
+
+        size_type size() const noexcept
+        {
+            return this->size_;
+        }
+
+        size_type max_size() const noexcept
+        {
+            return alloc_traits::max_size(this->alloc_ref());
+        }
+
+        size_type capacity() const noexcept
+        {
+            return this->capacity_;
+        }
+
+        void reserve(size_type new_capacity)
+        {
+            if(new_capacity > this->capacity_)
+            {
+                this->reallocate_private(new_capacity);
+            }
+        }
+
+        /** @brief Освобождение лишней памяти
+        @details При size() <= N элементы возвращаются во встроенный буфер, если их перемещение не
+        порождает исключений, иначе запрос игнорируется
+        */
+        void shrink_to_fit()
+        {
+            if(this->is_inline_private() || this->size_ == this->capacity_)
+            {
+                return;
+            }
+
+            if(this->size_ > N || std::is_nothrow_move_constructible<value_type>{})
+            {
+                this->reallocate_private(this->size_);
+            }
+        }
+
+        void resize(size_type new_size)
+        {
+            this->resize_private(new_size);
+        }
+
+        void resize(size_type new_size, value_type const & value)
+        {
+            if(new_size <= this->size_)
+            {
+                return this->resize_private(new_size);
+            }
+
+            // value может ссылаться на элемент, который переместится при выделении памяти
+            value_type const copy(value);
+
+            this->resize_private(new_size, copy);
+        }
+
+        // Доступ к элементам
+        reference operator[](size_type index)
+        {
+            assert(index < this->size());
+
+            return this->data_[index];
+        }
+
+        const_reference operator[](size_type index) const
+        {
+            assert(index < this->size());
+
+            return this->data_[index];
+        }
+
+        reference at(size_type index)
+        {
+            this->check_index_private(index);
+
+            return this->data_[index];
+        }
+
+        const_reference at(size_type index) const
+        {
+            this->check_index_private(index);
+
+            return this->data_[index];
+        }
+
+        reference front()
+        {
+            assert(!this->empty());
+
+            return this->data_[0];
+        }
+
+        const_reference front() const
+        {
+            assert(!this->empty());
+
+            return this->data_[0];
+        }
+
+        reference back()
+        {
+            assert(!this->empty());
+
+            return this->data_[this->size_ - 1];
+        }
+
+        const_reference back() const
+        {
+            assert(!this->empty());
+
+            return this->data_[this->size_ - 1];
+        }
+
+        pointer data() noexcept
+        {
+            return this->data_;
+        }
+
+        const_pointer data() const noexcept
+        {
+            return this->data_;
+        }
+
+        // Модифицирующие операции
+        template <class... Args>
+        reference emplace_back(Args &&... args)
+        {
+            if(this->size_ == this->capacity_)
+            {
+                // Аргументы могут ссылаться на элементы: создаём новый элемент до переноса старых
+                auto const new_capacity = this->grown_capacity_private(this->size_ + 1);
+                auto * const new_data = alloc_traits::allocate(this->alloc_ref(), new_capacity);
+
+                try
+                {
+                    alloc_traits::construct(this->alloc_ref(), new_data + this->size_
+                                           , std::forward<Args>(args)...);
+                }
+                catch(...)
+                {
+                    alloc_traits::deallocate(this->alloc_ref(), new_data, new_capacity);
+                    throw;
+                }
+
+                this->relocate_private(new_data, new_capacity, this->size_ + 1);
+            }
+            else
+            {
+                alloc_traits::construct(this->alloc_ref(), this->end()
+                                       , std::forward<Args>(args)...);
+            }
+
+            ++ this->size_;
+
+            return this->back();
+        }
+
+        void push_back(value_type const & value)
+        {
+            this->emplace_back(value);
+        }
+
+        void push_back(value_type && value)
+        {
+            this->emplace_back(std::move(value));
+        }
+
+        void pop_back()
+        {
+            assert(!this->empty());
+
+            -- this->size_;
+            alloc_traits::destroy(this->alloc_ref(), this->end());
+        }
+
+        template <class... Args>
+        iterator emplace(const_iterator pos, Args &&... args)
+        {
+            auto const index = static_cast<size_type>(pos - this->begin());
+
+            this->emplace_back(std::forward<Args>(args)...);
+
+            std::rotate(this->begin() + index, this->end() - 1, this->end());
+
+            return this->begin() + index;
+        }
+
+        iterator insert(const_iterator pos, value_type const & value)
+        {
+            return this->emplace(pos, value);
+        }
+
+        iterator insert(const_iterator pos, value_type && value)
+        {
+            return this->emplace(pos, std::move(value));
+        }
+
+        iterator insert(const_iterator pos, size_type num, value_type const & value)
+        {
+            auto const index = static_cast<size_type>(pos - this->begin());
+            auto const old_size = this->size_;
+
+            if(num > 0)
+            {
+                // value может ссылаться на элемент, который переместится при выделении памяти
+                value_type const copy(value);
+
+                this->reserve(old_size + num);
+
+                for(; num > 0; --num)
+                {
+                    this->emplace_back(copy);
+                }
+            }
+
+            std::rotate(this->begin() + index, this->begin() + old_size, this->end());
+
+            return this->begin() + index;
+        }
+
+        template <class InputIterator
+                 , class = detail::require_input_iterator<InputIterator>>
+        iterator insert(const_iterator pos, InputIterator first, InputIterator last)
+        {
+            auto const index = static_cast<size_type>(pos - this->begin());
+            auto const old_size = this->size_;
+
+            this->append_private(std::move(first), std::move(last));
+
+            std::rotate(this->begin() + index, this->begin() + old_size, this->end());
+
+            return this->begin() + index;
+        }
+
+        iterator insert(const_iterator pos, std::initializer_list<value_type> values)
+        {
+            return this->insert(pos, values.begin(), values.end());
+        }
+
+        iterator erase(const_iterator pos)
+        {
+            assert(pos != this->end());
+
+            return this->erase(pos, pos + 1);
+        }
+
+        iterator erase(const_iterator first, const_iterator last)
+        {
+            auto const index = first - this->cbegin();
+            auto const num = last - first;
+
+            // Перемещение элемента в самого себя может оставить его в неопределённом состоянии
+            if(num == 0)
+            {
+                return this->begin() + index;
+            }
+
+            auto const out = std::move(this->begin() + index + num, this->end()
+                                      , this->begin() + index);
+
+            this->destroy_tail_private(static_cast<size_type>(out - this->begin()));
+
+            return this->begin() + index;
+        }
+
+        void clear() noexcept
+        {
+            this->destroy_tail_private(0);
+        }
+
+        void swap(small_vector & other)
+        {
+            if(!this->is_inline_private() && !other.is_inline_private())
+            {
+                if constexpr(alloc_traits::propagate_on_container_swap::value)
+                {
+                    using std::swap;
+                    swap(this->alloc_ref(), other.alloc_ref());
+                }
+
+                std::swap(this->data_, other.data_);
+                std::swap(this->size_, other.size_);
+                std::swap(this->capacity_, other.capacity_);
+            }
+            else
+            {
+                small_vector tmp(std::move(other));
+                other = std::move(*this);
+                *this = std::move(tmp);
+            }
+        }
+
+        // Сравнение
+        friend bool operator==(small_vector const & lhs, small_vector const & rhs)
+        {
+            return saga::equal(saga::cursor::all(lhs), saga::cursor::all(rhs));
+        }
+
+        friend bool operator<(small_vector const & lhs, small_vector const & rhs)
+        {
+            return saga::lexicographical_compare(saga::cursor::all(lhs), saga::cursor::all(rhs));
+        }
+
+        friend bool operator!=(small_vector const & lhs, small_vector const & rhs)
+        {
+            return !(lhs == rhs);
+        }
+
+        friend bool operator>(small_vector const & lhs, small_vector const & rhs)
+        {
+            return rhs < lhs;
+        }
+
+        friend bool operator<=(small_vector const & lhs, small_vector const & rhs)
+        {
+            return !(rhs < lhs);
+        }
+
+        friend bool operator>=(small_vector const & lhs, small_vector const & rhs)
+        {
+            return !(lhs < rhs);
+        }
+
+        friend void swap(small_vector & lhs, small_vector & rhs)
+        {
+            lhs.swap(rhs);
+        }
+
+    private:
+        allocator_type & alloc_ref() noexcept
+        {
+            return *this;
+        }
+
+        allocator_type const & alloc_ref() const noexcept
+        {
+            return *this;
+        }
+
+        pointer buffer_private() noexcept
+        {
+            return reinterpret_cast<pointer>(this->buffer_);
+        }
+
+        bool is_inline_private() const noexcept
+        {
+            return this->data_ == reinterpret_cast<const_pointer>(this->buffer_);
+        }
+
+        void check_index_private(size_type index) const
+        {
+            if(index >= this->size())
+            {
+                throw std::out_of_range("saga::small_vector: index is out of range");
+            }
+        }
+
+        size_type grown_capacity_private(size_type required) const
+        {
+            if(required > this->max_size())
+            {
+                throw std::length_error("saga::small_vector: size is too large");
+            }
+
+            return std::max(required, std::min(2 * this->capacity_, this->max_size()));
+        }
+
+        void destroy_tail_private(size_type new_size) noexcept
+        {
+            for(; this->size_ > new_size;)
+            {
+                -- this->size_;
+                alloc_traits::destroy(this->alloc_ref(), this->data_ + this->size_);
+            }
+        }
+
+        void deallocate_private() noexcept
+        {
+            assert(this->empty());
+
+            if(!this->is_inline_private())
+            {
+                alloc_traits::deallocate(this->alloc_ref(), this->data_, this->capacity_);
+
+                this->data_ = this->buffer_private();
+                this->capacity_ = N;
+            }
+        }
+
+        /** @brief Перенос элементов в выделенную память @c new_data ёмкостью @c new_capacity
+        @param constructed количество элементов, уже созданных в @c new_data после переносимых:
+        в случае исключения они уничтожаются, а память освобождается
+        */
+        void relocate_private(pointer new_data, size_type new_capacity, size_type constructed)
+        {
+            auto num = size_type(0);
+
+            try
+            {
+                for(; num < this->size_; ++num)
+                {
+                    alloc_traits::construct(this->alloc_ref(), new_data + num
+                                           , std::move_if_noexcept(this->data_[num]));
+                }
+            }
+            catch(...)
+            {
+                for(auto index = size_type(0); index < num; ++index)
+                {
+                    alloc_traits::destroy(this->alloc_ref(), new_data + index);
+                }
+
+                for(auto index = this->size_; index < constructed; ++index)
+                {
+                    alloc_traits::destroy(this->alloc_ref(), new_data + index);
+                }
+
+                alloc_traits::deallocate(this->alloc_ref(), new_data, new_capacity);
+
+                throw;
+            }
+
+            auto const old_size = this->size_;
+            this->clear();
+            this->deallocate_private();
+
+            this->data_ = new_data;
+            this->size_ = old_size;
+            this->capacity_ = new_capacity;
+        }
+
+        void reallocate_private(size_type new_capacity)
+        {
+            assert(new_capacity >= this->size_);
+            assert(!this->is_inline_private() || new_capacity > N);
+
+            if(new_capacity <= N)
+            {
+                // Возврат во встроенный буфер, перемещение не порождает исключений
+                auto * const old_data = this->data_;
+                auto const old_capacity = this->capacity_;
+                auto const old_size = this->size_;
+
+                this->data_ = this->buffer_private();
+                this->capacity_ = N;
+                this->size_ = 0;
+
+                for(; this->size_ < old_size; ++ this->size_)
+                {
+                    alloc_traits::construct(this->alloc_ref(), this->data_ + this->size_
+                                           , std::move(old_data[this->size_]));
+                }
+
+                for(auto index = size_type(0); index < old_size; ++index)
+                {
+                    alloc_traits::destroy(this->alloc_ref(), old_data + index);
+                }
+
+                alloc_traits::deallocate(this->alloc_ref(), old_data, old_capacity);
+            }
+            else
+            {
+                auto * const new_data = alloc_traits::allocate(this->alloc_ref(), new_capacity);
+
+                this->relocate_private(new_data, new_capacity, this->size_);
+            }
+        }
+
+        /// @brief Перенос элементов @c other: забирает память или перемещает элементы из буфера
+        void steal_or_move_private(small_vector & other)
+        {
+            assert(this->empty() && this->is_inline_private());
+
+            if(other.is_inline_private())
+            {
+                for(; this->size_ < other.size_; ++ this->size_)
+                {
+                    alloc_traits::construct(this->alloc_ref(), this->data_ + this->size_
+                                           , std::move(other.data_[this->size_]));
+                }
+
+                other.clear();
+            }
+            else
+            {
+                this->data_ = std::exchange(other.data_, other.buffer_private());
+                this->size_ = std::exchange(other.size_, 0);
+                this->capacity_ = std::exchange(other.capacity_, N);
+            }
+        }
+
+        template <class InputIterator>
+        void append_private(InputIterator first, InputIterator last)
+        {
+            if constexpr(std::is_base_of<std::forward_iterator_tag
+                                        , saga::iterator_category_t<InputIterator>>{})
+            {
+                auto const num = static_cast<size_type>(std::distance(first, last));
+
+                if(this->size_ + num > this->capacity_)
+                {
+                    this->reallocate_private(this->grown_capacity_private(this->size_ + num));
+                }
+            }
+
+            for(; first != last; ++first)
+            {
+                this->emplace_back(*first);
+            }
+        }
+
+        template <class... Args>
+        void resize_private(size_type new_size, Args const &... args)
+        {
+            if(new_size <= this->size_)
+            {
+                this->destroy_tail_private(new_size);
+                return;
+            }
+
+            this->reserve(new_size);
+
+            for(; this->size_ < new_size; ++ this->size_)
+            {
+                alloc_traits::construct(this->alloc_ref(), this->data_ + this->size_, args...);
+            }
+        }
+
+        pointer data_ = this->buffer_private();
+        size_type size_ = 0;
+        size_type capacity_ = N;
+        alignas(T) unsigned char buffer_[(N > 0 ? N : 1) * sizeof(T)];
+    };
+}
+// namespace saga
+
+#endif
+// Z_SAGA_CONTAINER_SMALL_VECTOR_HPP_INCLUDED
@@ -20,6 +20,7 @@ SAGA -- это свободной программное обеспечение:
 
 #include <cassert>
 #include <iterator>
+#include <type_traits>
 
 namespace saga
 {
@@ -209,6 +210,74 @@ namespace saga
     template <class Type>
     using is_random_access_cursor
         = detail::is_cursor_atleast<Type, std::random_access_iterator_tag>;
+
+    namespace detail
+    {
+        template <class Type, class SFINAE = void>
+        struct has_cursor_data
+         : std::false_type
+        {};
+
+        template <class Type>
+        struct has_cursor_data<Type, std::void_t<decltype(std::declval<Type const &>().data())>>
+         : std::is_pointer<decltype(std::declval<Type const &>().data())>
+        {};
+    }
+    // namespace detail
+
+    /** @brief Проверка того, что курсор является непрерывным, то есть курсором произвольного
+    доступа, элементы которого расположены в памяти подряд, начиная с адреса @c cur.data()
+    */
+    template <class Type>
+    using is_contiguous_cursor
+        = std::conjunction<is_random_access_cursor<Type>, detail::has_cursor_data<Type>>;
+
+    namespace detail
+    {
+        template <class Type, class SFINAE = void>
+        struct is_infinite_cursor
+         : std::false_type
+        {};
+
+        template <class Type>
+        struct is_infinite_cursor<Type, std::void_t<saga::cursor_cardinality_t<Type>>>
+         : std::is_base_of<infinite_cursor_cardinality_tag, saga::cursor_cardinality_t<Type>>
+        {};
+
+        // Курсор произвольного доступа, размер которого можно получить при помощи size()
+        template <class Type>
+        using is_sized_cursor
+            = std::conjunction<is_random_access_cursor<Type>
+                              , std::negation<is_infinite_cursor<Type>>>;
+
+        template <class Type, class SFINAE = void>
+        struct is_segmented_cursor_impl
+         : std::false_type
+        {};
+
+        template <class Type>
+        struct is_segmented_cursor_impl
+            <Type, std::void_t<decltype(std::declval<Type const &>().front_segment())>>
+         : std::true_type
+        {};
+    }
+    // namespace detail
+
+    /** @brief Проверка того, что курсор является сегментированным
+
+    Элементы сегментированного курсора можно обходить отрезками (сегментами). Функция-член
+    @c front_segment() возвращает курсор, проходящий начальную часть ещё не пройденных элементов
+    курсора (непустую, если курсор не пуст). Этот курсор поддерживает операции @c front(),
+    @c drop_front() и @c size(), а его обход обходится существенно дешевле обхода исходного курсора:
+    в частности, не требуется проверять, пуст ли он, перед каждым шагом. Функция-член
+    @c drop_front_segment(num) пропускает первые @c num элементов курсора, где @c num не больше
+    размера сегмента, возвращённого @c front_segment().
+    */
+    template <class Type>
+    using is_segmented_cursor = detail::is_segmented_cursor_impl<Type>;
+
+    template <class Cursor>
+    using cursor_segment_t = decltype(std::declval<Cursor const &>().front_segment());
 }
 // namespace saga
 
@@ -26,6 +26,7 @@ SAGA -- это свободной программное обеспечение:
 
 #include <cassert>
 
+#include <iterator>
 #include <utility>
 
 namespace saga
@@ -35,7 +36,11 @@ namespace saga
     {
     public:
         // Типы
+        using cursor_category = std::input_iterator_tag;
+        using cursor_cardinality = saga::any_cursor_cardinality_tag;
         using reference = cursor_reference_t<ForwardCursor>;
+        using difference_type = cursor_difference_t<ForwardCursor>;
+        using value_type = cursor_value_t<ForwardCursor>;
 
         // Создание, копирование, уничтожение
         /** @brief Если у @cur есть передняя пройденная часть, то после завершения первого прохода
@@ -52,7 +57,7 @@ namespace saga
             return !this->cur_;
         }
 
-        cycled_cursor & operator++()
+        void drop_front()
         {
             assert(!!*this);
 
@@ -62,15 +67,45 @@ namespace saga
             {
                 this->cur_ = this->cur_.dropped_front();
             }
+        }
+
+        reference front() const
+        {
+            assert(!!*this);
+
+            return *this->cur_;
+        }
+
+        cycled_cursor & operator++()
+        {
+            this->drop_front();
 
             return *this;
         }
 
         reference operator*() const
+        {
+            return this->front();
+        }
+
+        // Сегментированный курсор
+        template <class BaseCursor = ForwardCursor
+                 , std::enable_if_t<saga::is_segmented_cursor<BaseCursor>{}> * = nullptr>
+        auto front_segment() const
         {
             assert(!!*this);
 
-            return *this->cur_;
+            return this->cur_.front_segment();
+        }
+
+        void drop_front_segment(difference_type num)
+        {
+            this->cur_.drop_front_segment(num);
+
+            if(!this->cur_)
+            {
+                this->cur_ = this->cur_.dropped_front();
+            }
         }
 
     private:
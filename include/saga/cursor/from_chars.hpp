@@ -0,0 +1,183 @@
+/* (c) 2026 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки SAGA.
+
+SAGA -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#ifndef Z_SAGA_CURSOR_FROM_CHARS_HPP_INCLUDED
+#define Z_SAGA_CURSOR_FROM_CHARS_HPP_INCLUDED
+
+/** @file saga/cursor/from_chars.hpp
+ @brief Курсор, последовательно разбирающий числа из текста в памяти с помощью std::from_chars
+
+ Числа разделяются пробельными символами, запятыми или точками с запятой. В отличие от
+ saga::istream_cursor, не используются ни потоки, ни локали, ни промежуточные буферы.
+
+ Разбор чисел с плавающей точкой доступен, только если стандартная библиотека предоставляет
+ соответствующие перегрузки std::from_chars (о чём сообщает макрос SAGA_HAS_FLOATING_FROM_CHARS):
+ в частности, их нет в libstdc++ из GCC 9 и 10 и в libc++ для macOS.
+*/
+
+#include <saga/cursor/cursor_facade.hpp>
+
+#include <cassert>
+#include <charconv>
+#include <cstddef>
+#include <iterator>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+#define SAGA_HAS_FLOATING_FROM_CHARS 1
+#endif
+// SAGA_HAS_FLOATING_FROM_CHARS
+
+namespace saga
+{
+    namespace detail
+    {
+        template <class Number>
+        constexpr bool is_from_chars_number()
+        {
+#ifdef SAGA_HAS_FLOATING_FROM_CHARS
+            return std::is_arithmetic<Number>{} && !std::is_same<Number, bool>{};
+#else
+            return std::is_integral<Number>{} && !std::is_same<Number, bool>{};
+#endif
+        }
+    }
+    // namespace detail
+
+    template <class Number, class Difference = std::ptrdiff_t>
+    class from_chars_cursor
+     : saga::cursor_facade<from_chars_cursor<Number, Difference>, Number const &>
+    {
+        static_assert(saga::detail::is_from_chars_number<Number>()
+                      , "Number must be integral type (or floating point, if supported)");
+
+    public:
+        // Типы
+        using cursor_category = std::input_iterator_tag;
+        using difference_type = Difference;
+        using value_type = Number;
+        using reference = Number const &;
+
+        // Создание, копирование, уничтожение
+        /** @brief Конструктор
+        @param text текст, который должен существовать, пока используется курсор
+        */
+        explicit from_chars_cursor(std::string_view text)
+         : first_(text.data())
+         , last_(text.data() + text.size())
+        {
+            this->drop_front();
+        }
+
+        // Курсор ввода
+        bool operator!() const
+        {
+            return this->done_;
+        }
+
+        void drop_front()
+        {
+            assert(!this->done_);
+
+            for(; this->first_ != this->last_ && is_separator(*this->first_); ++this->first_)
+            {}
+
+            if(this->first_ == this->last_)
+            {
+                this->done_ = true;
+                return;
+            }
+
+            auto const result = std::from_chars(this->first_, this->last_, this->value_);
+
+            if(result.ec != std::errc{})
+            {
+                this->done_ = true;
+                return;
+            }
+
+            this->first_ = result.ptr;
+        }
+
+        reference front() const
+        {
+            assert(!this->done_);
+
+            return this->value_;
+        }
+
+        // Диагностика
+        /** @brief Неразобранный остаток текста
+        @return Пустая строка, если текст разобран полностью, иначе -- текст, начиная с первого
+        символа, который не удалось разобрать как число или разделитель
+        */
+        std::string_view rest() const
+        {
+            auto const num = static_cast<std::size_t>(this->last_ - this->first_);
+
+            return std::string_view(this->first_, num);
+        }
+
+    private:
+        static constexpr bool is_separator(char c)
+        {
+            switch(c)
+            {
+            case ' ':
+            case '\t':
+            case '\n':
+            case '\r':
+            case '\v':
+            case '\f':
+            case ',':
+            case ';':
+                return true;
+
+            default:
+                return false;
+            }
+        }
+
+    private:
+        char const * first_ = nullptr;
+        char const * last_ = nullptr;
+        Number value_ {};
+        bool done_ = false;
+    };
+
+    namespace cursor
+    {
+        /** @brief Курсор чисел типа @c Number, записанных в тексте @c text
+
+        Разбор прекращается в конце текста или на первой последовательности символов, которая не
+        является числом: её можно получить с помощью функции-члена @c rest.
+        */
+        template <class Number>
+        saga::from_chars_cursor<Number>
+        from_chars(std::string_view text)
+        {
+            return saga::from_chars_cursor<Number>(text);
+        }
+    }
+    // namespace cursor
+}
+// namespace saga
+
+#endif
+// Z_SAGA_CURSOR_FROM_CHARS_HPP_INCLUDED
@@ -0,0 +1,137 @@
+/* (c) 2026 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки SAGA.
+
+SAGA -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#ifndef Z_SAGA_CURSOR_LINES_HPP_INCLUDED
+#define Z_SAGA_CURSOR_LINES_HPP_INCLUDED
+
+/** @file saga/cursor/lines.hpp
+ @brief Курсор, разбивающий текст в памяти на строки без копирования
+
+ В отличие от saga::by_line_cursor, строки не копируются в std::string, а возвращаются как
+ std::basic_string_view, ссылающиеся на исходный текст (например, на saga::mapped_file).
+*/
+
+#include <saga/cursor/cursor_facade.hpp>
+
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <string_view>
+
+namespace saga
+{
+    template <class CharT, class Traits = std::char_traits<CharT>
+             , class Difference = std::ptrdiff_t>
+    class lines_cursor
+     : saga::cursor_facade<lines_cursor<CharT, Traits, Difference>
+                          , std::basic_string_view<CharT, Traits> const &>
+    {
+    public:
+        // Типы
+        using char_type = CharT;
+
+        using cursor_category = std::input_iterator_tag;
+        using difference_type = Difference;
+        using value_type = std::basic_string_view<CharT, Traits>;
+        using reference = value_type const &;
+
+        // Создание, копирование, уничтожение
+        /** @brief Конструктор
+        @param text текст, который должен существовать, пока используется курсор
+        @param delim разделитель строк
+        */
+        explicit lines_cursor(value_type text, char_type delim)
+         : first_(text.data())
+         , last_(text.data() + text.size())
+         , delim_(delim)
+        {
+            this->drop_front();
+        }
+
+        // Курсор ввода
+        bool operator!() const
+        {
+            return this->done_;
+        }
+
+        void drop_front()
+        {
+            assert(!this->done_);
+
+            if(this->first_ == this->last_)
+            {
+                this->done_ = true;
+                return;
+            }
+
+            auto const num = static_cast<std::size_t>(this->last_ - this->first_);
+            auto const pos = Traits::find(this->first_, num, this->delim_);
+
+            if(pos == nullptr)
+            {
+                this->line_ = value_type(this->first_, num);
+                this->first_ = this->last_;
+            }
+            else
+            {
+                auto const length = static_cast<std::size_t>(pos - this->first_);
+
+                this->line_ = value_type(this->first_, length);
+                this->first_ = pos + 1;
+            }
+        }
+
+        reference front() const
+        {
+            assert(!this->done_);
+
+            return this->line_;
+        }
+
+    private:
+        char_type const * first_ = nullptr;
+        char_type const * last_ = nullptr;
+        value_type line_;
+        char_type delim_ = '\n';
+        bool done_ = false;
+    };
+
+    namespace cursor
+    {
+        /** @brief Курсор строк текста @c text, разделённых символом @c delim
+
+        Как и при использовании std::getline, последний разделитель не порождает пустую строку.
+        */
+        template <class CharT, class Traits>
+        saga::lines_cursor<CharT, Traits>
+        lines(std::basic_string_view<CharT, Traits> text, CharT delim = '\n')
+        {
+            return saga::lines_cursor<CharT, Traits>(text, delim);
+        }
+
+        inline saga::lines_cursor<char>
+        lines(std::string_view text, char delim = '\n')
+        {
+            return saga::lines_cursor<char>(text, delim);
+        }
+    }
+    // namespace cursor
+}
+// namespace saga
+
+#endif
+// Z_SAGA_CURSOR_LINES_HPP_INCLUDED
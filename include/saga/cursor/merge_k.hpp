@@ -0,0 +1,218 @@
+/* (c) 2026 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки SAGA.
+
+SAGA -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#ifndef Z_SAGA_CURSOR_MERGE_K_HPP_INCLUDED
+#define Z_SAGA_CURSOR_MERGE_K_HPP_INCLUDED
+
+/** @file saga/cursor/merge_k.hpp
+ @brief Курсор, представляющий слияние произвольного количества упорядоченных базовых курсоров.
+
+ Выбор очередного элемента производится с помощью дерева проигравших (турнирного дерева), поэтому
+ на каждый элемент приходится не более ceil(log2(k)) сравнений, где k -- количество базовых
+ курсоров.
+*/
+
+#include <saga/cursor/cursor_facade.hpp>
+#include <saga/cursor/cursor_traits.hpp>
+#include <saga/functional.hpp>
+#include <saga/ranges.hpp>
+#include <saga/type_traits.hpp>
+
+#include <cassert>
+#include <functional>
+#include <iterator>
+#include <vector>
+
+namespace saga
+{
+    /** @brief Курсор, представляющий устойчивое слияние упорядоченных курсоров
+
+    Эквивалентные элементы разных курсоров следуют в порядке возрастания номеров курсоров, внутри
+    одного курсора их порядок сохраняется. Базовые курсоры продвигаются лениво, поэтому их можно
+    использовать для потоковой обработки без предварительного сохранения элементов.
+    */
+    template <class InputCursor, class Compare = std::less<>>
+    class merge_k_cursor
+     : saga::cursor_facade<merge_k_cursor<InputCursor, Compare>
+                          , saga::cursor_reference_t<InputCursor>>
+    {
+    public:
+        // Типы
+        using cursor_category = std::input_iterator_tag;
+        using reference = saga::cursor_reference_t<InputCursor>;
+        using value_type = saga::cursor_value_t<InputCursor>;
+        using difference_type = saga::cursor_difference_t<InputCursor>;
+
+        // Создание, копирование, уничтожение
+        explicit merge_k_cursor(std::vector<InputCursor> inputs, Compare cmp = Compare())
+         : inputs_(std::move(inputs))
+         , tree_(this->inputs_.size())
+         , cmp_(std::move(cmp))
+        {
+            this->build();
+        }
+
+        // Курсор ввода
+        bool operator!() const
+        {
+            return this->inputs_.empty() || !this->inputs_[this->tree_[0]];
+        }
+
+        reference front() const
+        {
+            assert(!!*this);
+
+            return this->inputs_[this->tree_[0]].front();
+        }
+
+        void drop_front()
+        {
+            assert(!!*this);
+
+            auto winner = this->tree_[0];
+            this->inputs_[winner].drop_front();
+
+            for(auto node = (winner + this->inputs_.size()) / 2; node > 0; node /= 2)
+            {
+                if(this->beats(this->tree_[node], winner))
+                {
+                    std::swap(this->tree_[node], winner);
+                }
+            }
+
+            this->tree_[0] = winner;
+        }
+
+        // Слияние
+        /// @brief Номер базового курсора, которому принадлежит текущий элемент
+        std::size_t front_index() const
+        {
+            assert(!!*this);
+
+            return this->tree_[0];
+        }
+
+    private:
+        /* Дерево хранится неявно: листьям соответствуют позиции k .. 2k-1, внутреннему узлу n --
+        позиция n, его потомкам -- 2n и 2n+1. В tree_[n] хранится номер проигравшего в узле n, а в
+        tree_[0] -- номер победителя всего турнира.
+        */
+        void build()
+        {
+            auto const num = this->inputs_.size();
+
+            if(num == 0)
+            {
+                return;
+            }
+
+            std::vector<std::size_t> winners(2 * num);
+
+            for(auto index = std::size_t(0); index < num; ++index)
+            {
+                winners[num + index] = index;
+            }
+
+            for(auto node = num - 1; node > 0; --node)
+            {
+                auto const lhs = winners[2 * node];
+                auto const rhs = winners[2 * node + 1];
+
+                auto const lhs_wins = this->beats(lhs, rhs);
+
+                winners[node] = lhs_wins ? lhs : rhs;
+                this->tree_[node] = lhs_wins ? rhs : lhs;
+            }
+
+            this->tree_[0] = winners[1];
+        }
+
+        /* Исчерпанный курсор проигрывает всем остальным, при равенстве побеждает курсор с меньшим
+        номером. Благодаря этому достаточно одного сравнения элементов.
+        */
+        bool beats(std::size_t lhs, std::size_t rhs) const
+        {
+            auto const & lhs_in = this->inputs_[lhs];
+            auto const & rhs_in = this->inputs_[rhs];
+
+            if(!rhs_in)
+            {
+                return !!lhs_in || lhs < rhs;
+            }
+            else if(!lhs_in)
+            {
+                return false;
+            }
+            else if(lhs < rhs)
+            {
+                return !saga::invoke(this->cmp_, rhs_in.front(), lhs_in.front());
+            }
+            else
+            {
+                return saga::invoke(this->cmp_, lhs_in.front(), rhs_in.front());
+            }
+        }
+
+        std::vector<InputCursor> inputs_;
+        std::vector<std::size_t> tree_;
+        Compare cmp_;
+    };
+
+    namespace detail
+    {
+        template <class InputRange>
+        using range_cursor_t
+            = saga::remove_cvref_t<decltype(*saga::begin(std::declval<InputRange &>()))>;
+
+        template <class InputRange>
+        std::vector<range_cursor_t<InputRange>>
+        make_cursor_vector(InputRange && inputs)
+        {
+            using Cursor = range_cursor_t<InputRange>;
+
+            if constexpr (std::is_lvalue_reference<InputRange>{})
+            {
+                return std::vector<Cursor>(saga::begin(inputs), saga::end(inputs));
+            }
+            else
+            {
+                return std::vector<Cursor>(std::make_move_iterator(saga::begin(inputs))
+                                          , std::make_move_iterator(saga::end(inputs)));
+            }
+        }
+    }
+    // namespace detail
+
+    namespace cursor
+    {
+        template <class InputRange, class Compare = std::less<>>
+        merge_k_cursor<saga::detail::range_cursor_t<InputRange>, Compare>
+        merge_k(InputRange && inputs, Compare cmp = Compare())
+        {
+            using Cursor = saga::detail::range_cursor_t<InputRange>;
+
+            return merge_k_cursor<Cursor, Compare>
+                (saga::detail::make_cursor_vector(std::forward<InputRange>(inputs))
+                 , std::move(cmp));
+        }
+    }
+    // namespace cursor
+}
+// namespace saga
+
+#endif
+// Z_SAGA_CURSOR_MERGE_K_HPP_INCLUDED
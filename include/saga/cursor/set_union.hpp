@@ -19,11 +19,16 @@ SAGA -- это свободной программное обеспечение:
 #define Z_SAGA_CURSOR_SET_UNION_HPP_INCLUDED
 
 /** @file saga/cursor/set_union.hpp
- @brief Курсор, представляющий теоретико-множественное объединение элементов двух базовых курсоров.
+ @brief Курсоры, представляющие теоретико-множественное объединение элементов базовых курсоров.
 */
 
 #include <saga/cursor/cursor_facade.hpp>
 #include <saga/cursor/cursor_traits.hpp>
+#include <saga/cursor/merge_k.hpp>
+#include <saga/functional.hpp>
+
+#include <cassert>
+#include <optional>
 
 namespace saga
 {
@@ -102,8 +107,23 @@ namespace saga
 
         constexpr void adjust_state()
         {
-            if(this->state_ == State::always_first || this->state_ == State::always_second)
+            if(this->state_ == State::always_first)
             {
+                if(!in1_)
+                {
+                    this->state_ = State::empty;
+                }
+
+                return;
+            }
+
+            if(this->state_ == State::always_second)
+            {
+                if(!in2_)
+                {
+                    this->state_ = State::empty;
+                }
+
                 return;
             }
 
@@ -138,6 +158,94 @@ namespace saga
         State state_ = State::empty;
     };
 
+    /** @brief Курсор, представляющий объединение произвольного количества упорядоченных курсоров
+
+    Как и для двух курсоров, элемент, входящий в i-ый курсор m_i раз, входит в объединение
+    max(m_i) раз. Элементы выбираются из устойчивого слияния базовых курсоров, в котором
+    эквивалентные элементы одного курсора идут подряд: элемент пропускается, если в текущей группе
+    эквивалентных элементов уже было выбрано не меньше элементов, чем его номер в своём курсоре.
+    */
+    template <class InputCursor, class Compare = std::less<>>
+    class set_union_k_cursor
+     : saga::cursor_facade<set_union_k_cursor<InputCursor, Compare>
+                          , saga::cursor_reference_t<InputCursor>>
+    {
+        using Base = merge_k_cursor<InputCursor, Compare>;
+
+    public:
+        // Типы
+        using cursor_category = std::input_iterator_tag;
+        using reference = saga::cursor_reference_t<InputCursor>;
+        using value_type = saga::cursor_value_t<InputCursor>;
+        using difference_type = saga::cursor_difference_t<InputCursor>;
+
+        // Создание, копирование, уничтожение
+        explicit set_union_k_cursor(std::vector<InputCursor> inputs, Compare cmp = Compare())
+         : base_(std::move(inputs), cmp)
+         , cmp_(std::move(cmp))
+        {
+            this->skip_repeated();
+        }
+
+        // Курсор ввода
+        bool operator!() const
+        {
+            return !this->base_;
+        }
+
+        reference front() const
+        {
+            assert(!!*this);
+
+            return this->base_.front();
+        }
+
+        void drop_front()
+        {
+            assert(!!*this);
+
+            this->base_.drop_front();
+            this->skip_repeated();
+        }
+
+    private:
+        void skip_repeated()
+        {
+            for(; !!this->base_; this->base_.drop_front())
+            {
+                auto const index = this->base_.front_index();
+
+                if(!this->last_ || saga::invoke(this->cmp_, *this->last_, this->base_.front()))
+                {
+                    this->last_.emplace(this->base_.front());
+                    this->selected_ = 0;
+                    this->input_ = index;
+                    this->position_ = 0;
+                }
+                else if(index != this->input_)
+                {
+                    this->input_ = index;
+                    this->position_ = 0;
+                }
+
+                ++this->position_;
+
+                if(this->position_ > this->selected_)
+                {
+                    this->selected_ = this->position_;
+                    return;
+                }
+            }
+        }
+
+        Base base_;
+        Compare cmp_;
+        std::optional<value_type> last_;
+        std::size_t input_ = 0;
+        std::size_t position_ = 0;
+        std::size_t selected_ = 0;
+    };
+
     namespace cursor
     {
         template <class InputCursor1, class InputCursor2>
@@ -146,6 +254,17 @@ namespace saga
         {
             return set_union_cursor<InputCursor1, InputCursor2>(std::move(in1), std::move(in2));
         }
+
+        template <class InputRange, class Compare = std::less<>>
+        set_union_k_cursor<saga::detail::range_cursor_t<InputRange>, Compare>
+        set_union_k(InputRange && inputs, Compare cmp = Compare())
+        {
+            using Cursor = saga::detail::range_cursor_t<InputRange>;
+
+            return set_union_k_cursor<Cursor, Compare>
+                (saga::detail::make_cursor_vector(std::forward<InputRange>(inputs))
+                 , std::move(cmp));
+        }
     }
     // namespace cursor
 }
@@ -38,6 +38,7 @@ namespace saga
         using difference_type = saga::cursor_difference_t<InputCursor>;
         using reference = saga::cursor_reference_t<InputCursor>;
         using value_type = saga::cursor_value_t<InputCursor>;
+        using cursor_category = std::input_iterator_tag;
 
         // Создание, копирование, уничтожение
         constexpr explicit stride_cursor(InputCursor cur, difference_type step)
@@ -61,6 +62,44 @@ namespace saga
             this->cur_ = detail::drop_front_n_guarded(std::move(this->cur_), this->step_);
         }
 
+        // Размер (если базовый курсор знает свой размер)
+        template <class BaseCursor = InputCursor
+                 , class = decltype(std::declval<BaseCursor const &>().size())>
+        constexpr difference_type size() const
+        {
+            auto const base_size = difference_type(this->cur_.size());
+
+            return base_size == 0 ? 0 : (base_size - 1) / this->step_ + 1;
+        }
+
+        // Сегментированный курсор
+        template <class BaseCursor = InputCursor
+                 , std::enable_if_t<saga::is_segmented_cursor<BaseCursor>{}> * = nullptr>
+        constexpr auto front_segment() const
+        {
+            using Segment = saga::cursor_segment_t<BaseCursor>;
+
+            return stride_cursor<Segment>(this->cur_.front_segment(), this->step_);
+        }
+
+        /** @brief Пропуск первых @c num элементов
+        Последний шаг может выйти за пределы текущего сегмента базового курсора, поэтому
+        пропуск может затрагивать несколько его сегментов.
+        */
+        constexpr void drop_front_segment(difference_type num)
+        {
+            auto rest = num * this->step_;
+
+            while(rest > 0 && !!this->cur_)
+            {
+                auto const available = difference_type(this->cur_.front_segment().size());
+                auto const skip = std::min(rest, available);
+
+                this->cur_.drop_front_segment(skip);
+                rest -= skip;
+            }
+        }
+
     private:
         InputCursor cur_;
         difference_type step_ = 0;
@@ -205,6 +205,40 @@ namespace saga
             return this->first_.value()[index];
         }
 
+        // Непрерывный курсор
+        template <class Iterator = ForwardIterator
+                 , std::enable_if_t<saga::is_contiguous_iterator<Iterator>{}
+                                    && std::is_same<Iterator, Sentinel>{}> * = nullptr>
+        constexpr auto data() const
+        {
+            if constexpr (std::is_pointer<Iterator>{})
+            {
+                return this->first_.value();
+            }
+            else
+            {
+                // Итератор пустого интервала может указывать за последний элемент
+                using Pointer = decltype(saga::to_address(this->first_.value()));
+
+                return !*this ? Pointer(nullptr) : saga::to_address(this->first_.value());
+            }
+        }
+
+        // Сегментированный курсор
+        template <class Iterator = ForwardIterator
+                 , std::enable_if_t<std::is_base_of<std::random_access_iterator_tag
+                                                   , saga::iterator_category_t<Iterator>>{}
+                                    && std::is_same<Iterator, Sentinel>{}> * = nullptr>
+        constexpr subrange_cursor front_segment() const
+        {
+            return subrange_cursor(this->begin(), this->end(), unsafe_tag_t{});
+        }
+
+        constexpr void drop_front_segment(difference_type num)
+        {
+            this->drop_front(num);
+        }
+
     private:
         constexpr void tweak_back()
         {
@@ -100,6 +100,26 @@ namespace saga
             count_ -= num;
         }
 
+        // Сегментированный курсор
+        template <class BaseCursor = Cursor
+                 , std::enable_if_t<saga::is_segmented_cursor<BaseCursor>{}> * = nullptr>
+        constexpr auto front_segment() const
+        {
+            assert(!!*this);
+
+            using Segment = saga::cursor_segment_t<BaseCursor>;
+
+            return take_cursor<Segment, Difference>(this->base_.front_segment(), this->count_);
+        }
+
+        constexpr void drop_front_segment(difference_type num)
+        {
+            assert(0 <= num && num <= this->count_);
+
+            this->base_.drop_front_segment(num);
+            this->count_ -= num;
+        }
+
         // Адаптер курсора
         Cursor const & base() const
         {
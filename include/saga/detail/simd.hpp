@@ -0,0 +1,94 @@
+/* (c) 2026 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки SAGA.
+
+SAGA -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#ifndef Z_SAGA_DETAIL_SIMD_HPP_INCLUDED
+#define Z_SAGA_DETAIL_SIMD_HPP_INCLUDED
+
+/** @file saga/detail/simd.hpp
+ @brief Общие средства для векторизованных (SIMD) реализаций алгоритмов
+
+ Векторизованные реализации используются только при компиляции GCC или Clang для x86/x86-64.
+ Наборы команд AVX2 и FMA выбираются во время выполнения, SSE2 -- во время компиляции. Определение
+ макроса SAGA_NO_SIMD отключает векторизованные реализации.
+*/
+
+#include <type_traits>
+
+#if !defined(SAGA_NO_SIMD) && (defined(__GNUC__) || defined(__clang__)) \
+    && (defined(__x86_64__) || defined(__i386__)) && defined(__SSE2__)
+#define SAGA_SIMD_X86 1
+#include <immintrin.h>
+#define SAGA_TARGET_AVX2 __attribute__((target("avx2,popcnt")))
+#define SAGA_TARGET_AVX2_INLINE __attribute__((target("avx2,popcnt"), always_inline)) inline
+#define SAGA_TARGET_AVX2_FMA __attribute__((target("avx2,fma")))
+#define SAGA_TARGET_AVX2_FMA_INLINE __attribute__((target("avx2,fma"), always_inline)) inline
+#endif
+// SAGA_SIMD_X86
+
+namespace saga
+{
+    namespace detail
+    {
+        /** @brief Проверка того, что вычисление может происходить во время компиляции
+        @return @b false, если точно известно, что вычисление происходит во время выполнения. Если
+        компилятор не позволяет это определить, то возвращается @b true: тогда в constexpr-функциях
+        всегда будет использоваться обобщённая реализация вместо векторизованной.
+        */
+        constexpr bool may_be_constant_evaluated() noexcept
+        {
+#if defined(__cpp_lib_is_constant_evaluated) && __cpp_lib_is_constant_evaluated >= 201811L
+            return std::is_constant_evaluated();
+#elif defined(__GNUC__) && __GNUC__ >= 9
+            return __builtin_is_constant_evaluated();
+#elif defined(__clang__) && defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+            return __builtin_is_constant_evaluated();
+#else
+            return true;
+#endif
+#else
+            return true;
+#endif
+        }
+
+#ifdef SAGA_SIMD_X86
+        /// @brief Поддерживает ли процессор, на котором выполняется программа, команды AVX2
+        inline bool cpu_has_avx2()
+        {
+            static bool const result
+                = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt");
+
+            return result;
+        }
+
+        /// @brief Поддерживает ли процессор команды AVX2 и FMA (умножение со сложением)
+        inline bool cpu_has_avx2_fma()
+        {
+            static bool const result
+                = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+
+            return result;
+        }
+#endif
+// SAGA_SIMD_X86
+    }
+    // namespace detail
+}
+// namespace saga
+
+#endif
+// Z_SAGA_DETAIL_SIMD_HPP_INCLUDED
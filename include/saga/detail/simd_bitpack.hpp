@@ -0,0 +1,349 @@
+/* (c) 2026 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки SAGA.
+
+SAGA -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#ifndef Z_SAGA_DETAIL_SIMD_BITPACK_HPP_INCLUDED
+#define Z_SAGA_DETAIL_SIMD_BITPACK_HPP_INCLUDED
+
+/** @file saga/detail/simd_bitpack.hpp
+ @brief Упаковка блоков из 128 беззнаковых целых чисел в заданное количество битов
+
+ Блок хранится «вертикально»: слово делится на L = 16 / sizeof(UInt) дорожек, элемент с номером i
+ относится к дорожке i % L и строке i / L. Каждая дорожка -- это поток из 128 / L значений по w
+ битов, занимающий ровно w слов; k-е слово дорожки l имеет номер k * L + l. Поэтому одна строка
+ блока распаковывается для всех дорожек сразу одними и теми же сдвигами, то есть векторными
+ командами SSE2 без перестановок.
+
+ При распаковке хранимые значения считаются разностями соседних элементов, уменьшенными на
+ единицу, и сразу суммируются: так восстанавливается строго возрастающая последовательность.
+*/
+
+#include <saga/detail/simd.hpp>
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace saga
+{
+    namespace detail
+    {
+        /// @brief Количество элементов в упакованном блоке
+        inline constexpr std::size_t bitpack_block_size = 128;
+
+        template <class UInt>
+        struct bitpack_traits
+        {
+            static_assert(std::is_same<UInt, std::uint32_t>{}
+                          || std::is_same<UInt, std::uint64_t>{});
+
+            static constexpr unsigned bits = std::numeric_limits<UInt>::digits;
+            static constexpr std::size_t lanes = 16 / sizeof(UInt);
+            static constexpr std::size_t rows = bitpack_block_size / lanes;
+
+            static constexpr UInt mask(unsigned width)
+            {
+                return (width == bits) ? ~UInt(0) : (UInt(1) << width) - 1;
+            }
+        };
+
+        /// @brief Количество битов, необходимое для записи @c value
+        template <class UInt>
+        unsigned bitpack_width(UInt value)
+        {
+            auto result = 0u;
+
+            for(; value != 0; value >>= 1)
+            {
+                ++result;
+            }
+
+            return result;
+        }
+
+        /** @brief Значение с номером @c index из блока @c in, упакованного по @c width битов
+        */
+        template <class UInt>
+        UInt bitpack_get(UInt const * in, unsigned width, std::size_t index)
+        {
+            using Traits = bitpack_traits<UInt>;
+
+            assert(index < bitpack_block_size);
+
+            if(width == 0)
+            {
+                return 0;
+            }
+
+            auto const lane = index % Traits::lanes;
+            auto const bit_pos = (index / Traits::lanes) * width;
+            auto const offset = static_cast<unsigned>(bit_pos % Traits::bits);
+            auto const * const word = in + (bit_pos / Traits::bits) * Traits::lanes + lane;
+
+            auto result = word[0] >> offset;
+
+            if(offset + width > Traits::bits)
+            {
+                result |= word[Traits::lanes] << (Traits::bits - offset);
+            }
+
+            return result & Traits::mask(width);
+        }
+
+        // Обобщённые реализации
+        template <class UInt>
+        void bitpack_pack_scalar(UInt const * values, unsigned width, UInt * out)
+        {
+            using Traits = bitpack_traits<UInt>;
+
+            for(auto index = std::size_t(0); index < Traits::lanes * width; ++index)
+            {
+                out[index] = 0;
+            }
+
+            for(auto row = std::size_t(0); row < Traits::rows && width > 0; ++row)
+            {
+                auto const bit_pos = row * width;
+                auto const offset = static_cast<unsigned>(bit_pos % Traits::bits);
+                auto * const word = out + (bit_pos / Traits::bits) * Traits::lanes;
+
+                for(auto lane = std::size_t(0); lane < Traits::lanes; ++lane)
+                {
+                    auto const value = values[row * Traits::lanes + lane];
+
+                    assert(value <= Traits::mask(width));
+
+                    word[lane] |= value << offset;
+
+                    if(offset + width > Traits::bits)
+                    {
+                        word[Traits::lanes + lane] |= value >> (Traits::bits - offset);
+                    }
+                }
+            }
+        }
+
+        template <class UInt>
+        void bitpack_decode_scalar(UInt const * in, unsigned width, UInt first, UInt * out)
+        {
+            // first - 1 может быть равно максимальному значению: арифметика по модулю 2^bits
+            auto value = static_cast<UInt>(first - 1);
+
+            for(auto index = std::size_t(0); index < bitpack_block_size; ++index)
+            {
+                value += detail::bitpack_get(in, width, index) + 1;
+                out[index] = value;
+            }
+        }
+
+#ifdef SAGA_SIMD_X86
+        template <class UInt>
+        struct simd_sse2_bitpack_ops;
+
+        template <>
+        struct simd_sse2_bitpack_ops<std::uint32_t>
+        {
+            static __m128i broadcast(std::uint32_t value)
+            {
+                return _mm_set1_epi32(static_cast<int>(value));
+            }
+
+            static __m128i shift_right(__m128i value, unsigned num)
+            {
+                return _mm_srl_epi32(value, _mm_cvtsi32_si128(static_cast<int>(num)));
+            }
+
+            static __m128i shift_left(__m128i value, unsigned num)
+            {
+                return _mm_sll_epi32(value, _mm_cvtsi32_si128(static_cast<int>(num)));
+            }
+
+            static __m128i add(__m128i lhs, __m128i rhs)
+            {
+                return _mm_add_epi32(lhs, rhs);
+            }
+
+            static __m128i prefix_sum(__m128i value)
+            {
+                value = _mm_add_epi32(value, _mm_slli_si128(value, 4));
+                return _mm_add_epi32(value, _mm_slli_si128(value, 8));
+            }
+
+            static __m128i broadcast_last(__m128i value)
+            {
+                return _mm_shuffle_epi32(value, 0xFF);
+            }
+        };
+
+        template <>
+        struct simd_sse2_bitpack_ops<std::uint64_t>
+        {
+            static __m128i broadcast(std::uint64_t value)
+            {
+                return _mm_set1_epi64x(static_cast<long long>(value));
+            }
+
+            static __m128i shift_right(__m128i value, unsigned num)
+            {
+                return _mm_srl_epi64(value, _mm_cvtsi32_si128(static_cast<int>(num)));
+            }
+
+            static __m128i shift_left(__m128i value, unsigned num)
+            {
+                return _mm_sll_epi64(value, _mm_cvtsi32_si128(static_cast<int>(num)));
+            }
+
+            static __m128i add(__m128i lhs, __m128i rhs)
+            {
+                return _mm_add_epi64(lhs, rhs);
+            }
+
+            static __m128i prefix_sum(__m128i value)
+            {
+                return _mm_add_epi64(value, _mm_slli_si128(value, 8));
+            }
+
+            static __m128i broadcast_last(__m128i value)
+            {
+                return _mm_shuffle_epi32(value, 0xEE);
+            }
+        };
+
+        template <class UInt>
+        __m128i bitpack_load(UInt const * ptr)
+        {
+            return _mm_loadu_si128(reinterpret_cast<__m128i const *>(ptr));
+        }
+
+        template <class UInt>
+        void bitpack_store(UInt * ptr, __m128i value)
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(ptr), value);
+        }
+
+        template <class UInt>
+        void bitpack_pack_sse2(UInt const * values, unsigned width, UInt * out)
+        {
+            using Traits = bitpack_traits<UInt>;
+            using Ops = simd_sse2_bitpack_ops<UInt>;
+
+            for(auto index = std::size_t(0); index < width; ++index)
+            {
+                detail::bitpack_store(out + index * Traits::lanes, _mm_setzero_si128());
+            }
+
+            for(auto row = std::size_t(0); row < Traits::rows && width > 0; ++row)
+            {
+                auto const bit_pos = row * width;
+                auto const offset = static_cast<unsigned>(bit_pos % Traits::bits);
+                auto * const word = out + (bit_pos / Traits::bits) * Traits::lanes;
+
+                auto const value = detail::bitpack_load(values + row * Traits::lanes);
+
+                detail::bitpack_store(word, _mm_or_si128(detail::bitpack_load(word)
+                                                        , Ops::shift_left(value, offset)));
+
+                if(offset + width > Traits::bits)
+                {
+                    auto * const next = word + Traits::lanes;
+                    auto const high = Ops::shift_right(value, Traits::bits - offset);
+
+                    detail::bitpack_store(next, _mm_or_si128(detail::bitpack_load(next), high));
+                }
+            }
+        }
+
+        template <class UInt>
+        void bitpack_decode_sse2(UInt const * in, unsigned width, UInt first, UInt * out)
+        {
+            using Traits = bitpack_traits<UInt>;
+            using Ops = simd_sse2_bitpack_ops<UInt>;
+
+            auto const mask = Ops::broadcast(Traits::mask(width));
+            auto const one = Ops::broadcast(1);
+
+            auto carry = Ops::broadcast(static_cast<UInt>(first - 1));
+
+            for(auto row = std::size_t(0); row < Traits::rows; ++row)
+            {
+                auto value = one;
+
+                if(width > 0)
+                {
+                    auto const bit_pos = row * width;
+                    auto const offset = static_cast<unsigned>(bit_pos % Traits::bits);
+                    auto const * const word = in + (bit_pos / Traits::bits) * Traits::lanes;
+
+                    auto delta = Ops::shift_right(detail::bitpack_load(word), offset);
+
+                    if(offset + width > Traits::bits)
+                    {
+                        auto const high = detail::bitpack_load(word + Traits::lanes);
+
+                        delta = _mm_or_si128(delta, Ops::shift_left(high, Traits::bits - offset));
+                    }
+
+                    value = Ops::add(_mm_and_si128(delta, mask), one);
+                }
+
+                value = Ops::add(Ops::prefix_sum(value), carry);
+
+                detail::bitpack_store(out + row * Traits::lanes, value);
+
+                carry = Ops::broadcast_last(value);
+            }
+        }
+#endif
+// SAGA_SIMD_X86
+
+        // Выбор реализации
+        /** @brief Упаковка @c bitpack_block_size значений по @c width битов в
+        <tt>width * bitpack_traits<UInt>::lanes</tt> слов
+        @pre Каждое значение записывается не более чем @c width битами
+        */
+        template <class UInt>
+        void bitpack_pack(UInt const * values, unsigned width, UInt * out)
+        {
+#ifdef SAGA_SIMD_X86
+            detail::bitpack_pack_sse2(values, width, out);
+#else
+            detail::bitpack_pack_scalar(values, width, out);
+#endif
+// SAGA_SIMD_X86
+        }
+
+        /** @brief Распаковка блока разностей: <tt>out[0] = first + in[0]</tt>,
+        <tt>out[i] = out[i-1] + in[i] + 1</tt>
+        */
+        template <class UInt>
+        void bitpack_decode(UInt const * in, unsigned width, UInt first, UInt * out)
+        {
+#ifdef SAGA_SIMD_X86
+            detail::bitpack_decode_sse2(in, width, first, out);
+#else
+            detail::bitpack_decode_scalar(in, width, first, out);
+#endif
+// SAGA_SIMD_X86
+        }
+    }
+    // namespace detail
+}
+// namespace saga
+
+#endif
+// Z_SAGA_DETAIL_SIMD_BITPACK_HPP_INCLUDED
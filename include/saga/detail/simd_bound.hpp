@@ -0,0 +1,311 @@
+/* (c) 2026 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки SAGA.
+
+SAGA -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#ifndef Z_SAGA_DETAIL_SIMD_BOUND_HPP_INCLUDED
+#define Z_SAGA_DETAIL_SIMD_BOUND_HPP_INCLUDED
+
+/** @file saga/detail/simd_bound.hpp
+ @brief Двоичный поиск без ветвлений в непрерывных последовательностях арифметических значений
+
+ Пока интервал поиска велик, он делится пополам с помощью условной пересылки, а не перехода, и оба
+ элемента, которые могут понадобиться на следующем шаге, заранее загружаются в кэш. Оставшееся
+ небольшое окно просматривается линейно: элементы, предшествующие значению, подсчитываются
+ векторными командами.
+*/
+
+#include <saga/detail/simd.hpp>
+#include <saga/detail/simd_equal.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <type_traits>
+
+namespace saga
+{
+    namespace detail
+    {
+        /// @brief Можно ли упорядочивать значения данного типа векторными командами
+        template <class T>
+        struct is_simd_ordered
+         : std::conjunction<std::is_arithmetic<T>, std::negation<std::is_same<T, bool>>
+                           , is_simd_element_size<T>>
+        {};
+
+        template <class Compare, class T>
+        struct is_less_predicate
+         : std::bool_constant<std::is_same<Compare, std::less<>>{}
+                              || std::is_same<Compare, std::less<T>>{}>
+        {};
+
+        template <class Compare, class T>
+        struct is_less_predicate<std::reference_wrapper<Compare>, T>
+         : is_less_predicate<std::remove_const_t<Compare>, T>
+        {};
+
+        /// @brief Размер окна (в элементах), которое просматривается линейно
+        template <class T>
+        inline constexpr std::size_t bound_window = 64 / sizeof(T);
+
+        template <bool Upper, class T>
+        bool bound_before(T const & elem, T const & value)
+        {
+            return Upper ? !(value < elem) : (elem < value);
+        }
+
+        template <class T>
+        void bound_prefetch(T const * ptr)
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            __builtin_prefetch(ptr);
+#else
+            static_cast<void>(ptr);
+#endif
+        }
+
+        /** @brief Сужение интервала поиска до окна, не превосходящего bound_window<T>
+        @post Искомая позиция лежит в <tt>[result, result + num]</tt>
+        */
+        template <bool Upper, class T>
+        T const * bound_narrow(T const * base, std::size_t & num, T const & value)
+        {
+            for(; num > bound_window<T>;)
+            {
+                auto const half = num / 2;
+                auto const next = (num - half) / 2;
+
+                detail::bound_prefetch(base + next);
+                detail::bound_prefetch(base + half + next);
+
+                base = detail::bound_before<Upper>(base[half], value) ? base + half : base;
+                num -= half;
+            }
+
+            return base;
+        }
+
+        template <bool Upper, class T>
+        std::size_t bound_count_scalar(T const * ptr, std::size_t num, T const & value)
+        {
+            auto result = std::size_t(0);
+
+            for(auto index = std::size_t(0); index < num; ++ index)
+            {
+                result += detail::bound_before<Upper>(ptr[index], value);
+            }
+
+            return result;
+        }
+
+        template <bool Upper, class T>
+        std::size_t bound_scalar(T const * data, std::size_t num, T const & value)
+        {
+            auto const base = detail::bound_narrow<Upper>(data, num, value);
+
+            return static_cast<std::size_t>(base - data)
+                   + detail::bound_count_scalar<Upper>(base, num, value);
+        }
+
+#ifdef SAGA_SIMD_X86
+        template <std::size_t Size>
+        struct simd_avx2_signed_ops;
+
+        template <>
+        struct simd_avx2_signed_ops<1>
+        {
+            SAGA_TARGET_AVX2_INLINE static __m256i broadcast(char value)
+            {
+                return _mm256_set1_epi8(value);
+            }
+
+            SAGA_TARGET_AVX2_INLINE static __m256i greater(__m256i lhs, __m256i rhs)
+            {
+                return _mm256_cmpgt_epi8(lhs, rhs);
+            }
+        };
+
+        template <>
+        struct simd_avx2_signed_ops<2>
+        {
+            SAGA_TARGET_AVX2_INLINE static __m256i broadcast(short value)
+            {
+                return _mm256_set1_epi16(value);
+            }
+
+            SAGA_TARGET_AVX2_INLINE static __m256i greater(__m256i lhs, __m256i rhs)
+            {
+                return _mm256_cmpgt_epi16(lhs, rhs);
+            }
+        };
+
+        template <>
+        struct simd_avx2_signed_ops<4>
+        {
+            SAGA_TARGET_AVX2_INLINE static __m256i broadcast(int value)
+            {
+                return _mm256_set1_epi32(value);
+            }
+
+            SAGA_TARGET_AVX2_INLINE static __m256i greater(__m256i lhs, __m256i rhs)
+            {
+                return _mm256_cmpgt_epi32(lhs, rhs);
+            }
+        };
+
+        template <>
+        struct simd_avx2_signed_ops<8>
+        {
+            SAGA_TARGET_AVX2_INLINE static __m256i broadcast(long long value)
+            {
+                return _mm256_set1_epi64x(value);
+            }
+
+            SAGA_TARGET_AVX2_INLINE static __m256i greater(__m256i lhs, __m256i rhs)
+            {
+                return _mm256_cmpgt_epi64(lhs, rhs);
+            }
+        };
+
+        /// @brief Векторные операции упорядочения: маска элементов, для которых lhs < rhs
+        template <class T, class SFINAE = void>
+        struct simd_avx2_order_ops
+        {
+            using Signed = simd_avx2_signed_ops<sizeof(T)>;
+
+            SAGA_TARGET_AVX2_INLINE static __m256i bias()
+            {
+                // Беззнаковые значения сравниваются как знаковые после инверсии старшего бита
+                using Int = std::make_signed_t<T>;
+
+                return Signed::broadcast(std::is_signed<T>{} ? Int(0)
+                                         : std::numeric_limits<Int>::min());
+            }
+
+            SAGA_TARGET_AVX2_INLINE static __m256i broadcast(T value)
+            {
+                return _mm256_xor_si256(Signed::broadcast(static_cast<std::make_signed_t<T>>(value))
+                                        , bias());
+            }
+
+            SAGA_TARGET_AVX2_INLINE static __m256i load(T const * ptr)
+            {
+                auto const result = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(ptr));
+
+                return _mm256_xor_si256(result, bias());
+            }
+
+            SAGA_TARGET_AVX2_INLINE static __m256i less(__m256i lhs, __m256i rhs)
+            {
+                return Signed::greater(rhs, lhs);
+            }
+        };
+
+        template <>
+        struct simd_avx2_order_ops<float>
+        {
+            SAGA_TARGET_AVX2_INLINE static __m256 broadcast(float value)
+            {
+                return _mm256_set1_ps(value);
+            }
+
+            SAGA_TARGET_AVX2_INLINE static __m256 load(float const * ptr)
+            {
+                return _mm256_loadu_ps(ptr);
+            }
+
+            SAGA_TARGET_AVX2_INLINE static __m256i less(__m256 lhs, __m256 rhs)
+            {
+                return _mm256_castps_si256(_mm256_cmp_ps(lhs, rhs, _CMP_LT_OQ));
+            }
+        };
+
+        template <>
+        struct simd_avx2_order_ops<double>
+        {
+            SAGA_TARGET_AVX2_INLINE static __m256d broadcast(double value)
+            {
+                return _mm256_set1_pd(value);
+            }
+
+            SAGA_TARGET_AVX2_INLINE static __m256d load(double const * ptr)
+            {
+                return _mm256_loadu_pd(ptr);
+            }
+
+            SAGA_TARGET_AVX2_INLINE static __m256i less(__m256d lhs, __m256d rhs)
+            {
+                return _mm256_castpd_si256(_mm256_cmp_pd(lhs, rhs, _CMP_LT_OQ));
+            }
+        };
+
+        template <bool Upper, class T>
+        SAGA_TARGET_AVX2
+        std::size_t bound_avx2(T const * data, std::size_t num, T const & value)
+        {
+            using Ops = simd_avx2_order_ops<T>;
+            constexpr auto step = sizeof(__m256i) / sizeof(T);
+
+            auto const base = detail::bound_narrow<Upper>(data, num, value);
+            auto const value_prepared = Ops::broadcast(value);
+
+            auto bits = std::size_t(0);
+            auto index = std::size_t(0);
+
+            for(; num - index >= step; index += step)
+            {
+                auto const elems = Ops::load(base + index);
+                auto const mask = Upper ? Ops::less(value_prepared, elems)
+                                        : Ops::less(elems, value_prepared);
+
+                bits += __builtin_popcount(static_cast<unsigned>(_mm256_movemask_epi8(mask)));
+            }
+
+            // Для upper_bound подсчитаны элементы, которые больше значения
+            auto const count = Upper ? index - bits / sizeof(T) : bits / sizeof(T);
+
+            return static_cast<std::size_t>(base - data) + count
+                   + detail::bound_count_scalar<Upper>(base + index, num - index, value);
+        }
+#endif
+// SAGA_SIMD_X86
+
+        // Выбор реализации
+        /** @brief Индекс первого элемента @c data, который не меньше (если @c Upper равно
+        @b false) или больше (если @c Upper равно @b true), чем @c value
+        */
+        template <bool Upper, class T>
+        std::size_t simd_bound(T const * data, std::size_t num, T const & value)
+        {
+            static_assert(is_simd_ordered<T>{});
+
+#ifdef SAGA_SIMD_X86
+            if(detail::cpu_has_avx2())
+            {
+                return detail::bound_avx2<Upper>(data, num, value);
+            }
+#endif
+// SAGA_SIMD_X86
+
+            return detail::bound_scalar<Upper>(data, num, value);
+        }
+    }
+    // namespace detail
+}
+// namespace saga
+
+#endif
+// Z_SAGA_DETAIL_SIMD_BOUND_HPP_INCLUDED
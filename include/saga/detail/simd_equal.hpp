@@ -0,0 +1,476 @@
+/* (c) 2026 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки SAGA.
+
+SAGA -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#ifndef Z_SAGA_DETAIL_SIMD_EQUAL_HPP_INCLUDED
+#define Z_SAGA_DETAIL_SIMD_EQUAL_HPP_INCLUDED
+
+/** @file saga/detail/simd_equal.hpp
+ @brief Векторизованные реализации подсчёта и поиска равных элементов в непрерывных массивах
+
+ Левый операнд сравнения всегда задаётся указателем, а правый -- либо указателем на другой массив
+ (поэлементное сравнение), либо значением simd_broadcast (сравнение с одним значением).
+*/
+
+#include <saga/detail/simd.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+
+namespace saga
+{
+    namespace detail
+    {
+        template <class T>
+        struct is_simd_element_size
+         : std::bool_constant<sizeof(T) == 1 || sizeof(T) == 2
+                              || sizeof(T) == 4 || sizeof(T) == 8>
+        {};
+
+        /** @brief Может ли равенство значений данного типа проверяться побитовым сравнением
+        векторными командами
+        */
+        template <class T>
+        struct is_simd_equality_comparable
+         : std::conjunction<std::is_integral<T>, is_simd_element_size<T>>
+        {};
+
+        template <class BinaryPredicate, class T>
+        struct is_equal_to_predicate
+         : std::bool_constant<std::is_same<BinaryPredicate, std::equal_to<>>{}
+                              || std::is_same<BinaryPredicate, std::equal_to<T>>{}>
+        {};
+
+        template <class BinaryPredicate, class T>
+        struct is_not_equal_to_predicate
+         : std::bool_constant<std::is_same<BinaryPredicate, std::not_equal_to<>>{}
+                              || std::is_same<BinaryPredicate, std::not_equal_to<T>>{}>
+        {};
+
+        template <class T>
+        struct simd_broadcast
+        {
+            T value;
+        };
+
+        template <class T>
+        T const * simd_advance(T const * ptr, std::size_t num)
+        {
+            return ptr + num;
+        }
+
+        template <class T>
+        simd_broadcast<T> const & simd_advance(simd_broadcast<T> const & rhs, std::size_t)
+        {
+            return rhs;
+        }
+
+        // Обобщённые реализации
+        template <class T>
+        T const & simd_scalar_element(T const * ptr, std::size_t index)
+        {
+            return ptr[index];
+        }
+
+        template <class T>
+        T const & simd_scalar_element(simd_broadcast<T> const & rhs, std::size_t)
+        {
+            return rhs.value;
+        }
+
+        template <class T, class Rhs>
+        std::size_t count_equal_scalar(T const * lhs, Rhs const & rhs, std::size_t num)
+        {
+            auto result = std::size_t(0);
+
+            for(auto index = std::size_t(0); index < num; ++ index)
+            {
+                result += (lhs[index] == detail::simd_scalar_element(rhs, index));
+            }
+
+            return result;
+        }
+
+        /** @brief Поиск первой позиции, в которой результат сравнения на равенство совпадает с
+        @c Equal
+        @return Индекс найденной позиции или @c num, если такой позиции нет
+        */
+        template <bool Equal, class T, class Rhs>
+        std::size_t find_first_equal_scalar(T const * lhs, Rhs const & rhs, std::size_t num)
+        {
+            auto index = std::size_t(0);
+
+            for(; index < num; ++ index)
+            {
+                if((lhs[index] == detail::simd_scalar_element(rhs, index)) == Equal)
+                {
+                    break;
+                }
+            }
+
+            return index;
+        }
+
+#ifdef SAGA_SIMD_X86
+        // SSE2
+        template <std::size_t Size>
+        struct simd_sse2_ops;
+
+        template <>
+        struct simd_sse2_ops<1>
+        {
+            template <class T>
+            static __m128i broadcast(T value)
+            {
+                return _mm_set1_epi8(static_cast<char>(value));
+            }
+
+            static __m128i equal(__m128i lhs, __m128i rhs)
+            {
+                return _mm_cmpeq_epi8(lhs, rhs);
+            }
+        };
+
+        template <>
+        struct simd_sse2_ops<2>
+        {
+            template <class T>
+            static __m128i broadcast(T value)
+            {
+                return _mm_set1_epi16(static_cast<short>(value));
+            }
+
+            static __m128i equal(__m128i lhs, __m128i rhs)
+            {
+                return _mm_cmpeq_epi16(lhs, rhs);
+            }
+        };
+
+        template <>
+        struct simd_sse2_ops<4>
+        {
+            template <class T>
+            static __m128i broadcast(T value)
+            {
+                return _mm_set1_epi32(static_cast<int>(value));
+            }
+
+            static __m128i equal(__m128i lhs, __m128i rhs)
+            {
+                return _mm_cmpeq_epi32(lhs, rhs);
+            }
+        };
+
+        template <>
+        struct simd_sse2_ops<8>
+        {
+            template <class T>
+            static __m128i broadcast(T value)
+            {
+                return _mm_set1_epi64x(static_cast<long long>(value));
+            }
+
+            // В SSE2 нет сравнения 64-битных целых: объединяем результаты для половин
+            static __m128i equal(__m128i lhs, __m128i rhs)
+            {
+                auto const halves = _mm_cmpeq_epi32(lhs, rhs);
+
+                return _mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+            }
+        };
+
+        template <class T>
+        __m128i simd_sse2_prepare(T const *, simd_broadcast<T> const & rhs)
+        {
+            return simd_sse2_ops<sizeof(T)>::broadcast(rhs.value);
+        }
+
+        template <class T>
+        T const * simd_sse2_prepare(T const *, T const * rhs)
+        {
+            return rhs;
+        }
+
+        template <class T>
+        __m128i simd_sse2_load(T const * ptr, std::size_t index)
+        {
+            return _mm_loadu_si128(reinterpret_cast<__m128i const *>(ptr + index));
+        }
+
+        inline __m128i simd_sse2_load(__m128i value, std::size_t)
+        {
+            return value;
+        }
+
+        template <class T, class Rhs>
+        std::size_t count_equal_sse2(T const * lhs, Rhs const & rhs, std::size_t num)
+        {
+            using Ops = simd_sse2_ops<sizeof(T)>;
+            constexpr auto step = sizeof(__m128i) / sizeof(T);
+
+            auto const rhs_prepared = detail::simd_sse2_prepare(lhs, rhs);
+
+            auto bits = std::size_t(0);
+            auto index = std::size_t(0);
+
+            for(; num - index >= step; index += step)
+            {
+                auto const mask = Ops::equal(detail::simd_sse2_load(lhs, index)
+                                            , detail::simd_sse2_load(rhs_prepared, index));
+
+                bits += __builtin_popcount(_mm_movemask_epi8(mask));
+            }
+
+            return bits / sizeof(T)
+                   + detail::count_equal_scalar(lhs + index, detail::simd_advance(rhs, index)
+                                                , num - index);
+        }
+
+        template <bool Equal, class T, class Rhs>
+        std::size_t find_first_equal_sse2(T const * lhs, Rhs const & rhs, std::size_t num)
+        {
+            using Ops = simd_sse2_ops<sizeof(T)>;
+            constexpr auto step = sizeof(__m128i) / sizeof(T);
+
+            auto const rhs_prepared = detail::simd_sse2_prepare(lhs, rhs);
+
+            auto index = std::size_t(0);
+
+            for(; num - index >= step; index += step)
+            {
+                auto const mask = Ops::equal(detail::simd_sse2_load(lhs, index)
+                                            , detail::simd_sse2_load(rhs_prepared, index));
+
+                auto bits = static_cast<unsigned>(_mm_movemask_epi8(mask));
+
+                if(!Equal)
+                {
+                    bits ^= 0xFFFFu;
+                }
+
+                if(bits != 0)
+                {
+                    return index + static_cast<std::size_t>(__builtin_ctz(bits)) / sizeof(T);
+                }
+            }
+
+            return index + detail::find_first_equal_scalar<Equal>(lhs + index
+                                                                   , detail::simd_advance(rhs, index)
+                                                                   , num - index);
+        }
+
+        // AVX2
+        template <std::size_t Size>
+        struct simd_avx2_ops;
+
+        template <>
+        struct simd_avx2_ops<1>
+        {
+            template <class T>
+            SAGA_TARGET_AVX2_INLINE static __m256i broadcast(T value)
+            {
+                return _mm256_set1_epi8(static_cast<char>(value));
+            }
+
+            SAGA_TARGET_AVX2_INLINE static __m256i equal(__m256i lhs, __m256i rhs)
+            {
+                return _mm256_cmpeq_epi8(lhs, rhs);
+            }
+        };
+
+        template <>
+        struct simd_avx2_ops<2>
+        {
+            template <class T>
+            SAGA_TARGET_AVX2_INLINE static __m256i broadcast(T value)
+            {
+                return _mm256_set1_epi16(static_cast<short>(value));
+            }
+
+            SAGA_TARGET_AVX2_INLINE static __m256i equal(__m256i lhs, __m256i rhs)
+            {
+                return _mm256_cmpeq_epi16(lhs, rhs);
+            }
+        };
+
+        template <>
+        struct simd_avx2_ops<4>
+        {
+            template <class T>
+            SAGA_TARGET_AVX2_INLINE static __m256i broadcast(T value)
+            {
+                return _mm256_set1_epi32(static_cast<int>(value));
+            }
+
+            SAGA_TARGET_AVX2_INLINE static __m256i equal(__m256i lhs, __m256i rhs)
+            {
+                return _mm256_cmpeq_epi32(lhs, rhs);
+            }
+        };
+
+        template <>
+        struct simd_avx2_ops<8>
+        {
+            template <class T>
+            SAGA_TARGET_AVX2_INLINE static __m256i broadcast(T value)
+            {
+                return _mm256_set1_epi64x(static_cast<long long>(value));
+            }
+
+            SAGA_TARGET_AVX2_INLINE static __m256i equal(__m256i lhs, __m256i rhs)
+            {
+                return _mm256_cmpeq_epi64(lhs, rhs);
+            }
+        };
+
+        template <class T>
+        SAGA_TARGET_AVX2_INLINE
+        __m256i simd_avx2_prepare(T const *, simd_broadcast<T> const & rhs)
+        {
+            return simd_avx2_ops<sizeof(T)>::broadcast(rhs.value);
+        }
+
+        template <class T>
+        SAGA_TARGET_AVX2_INLINE
+        T const * simd_avx2_prepare(T const *, T const * rhs)
+        {
+            return rhs;
+        }
+
+        template <class T>
+        SAGA_TARGET_AVX2_INLINE
+        __m256i simd_avx2_load(T const * ptr, std::size_t index)
+        {
+            return _mm256_loadu_si256(reinterpret_cast<__m256i const *>(ptr + index));
+        }
+
+        SAGA_TARGET_AVX2_INLINE
+        __m256i simd_avx2_load(__m256i value, std::size_t)
+        {
+            return value;
+        }
+
+        template <class T, class Rhs>
+        SAGA_TARGET_AVX2
+        std::size_t count_equal_avx2(T const * lhs, Rhs const & rhs, std::size_t num)
+        {
+            using Ops = simd_avx2_ops<sizeof(T)>;
+            constexpr auto step = sizeof(__m256i) / sizeof(T);
+
+            auto const rhs_prepared = detail::simd_avx2_prepare(lhs, rhs);
+
+            auto bits = std::size_t(0);
+            auto index = std::size_t(0);
+
+            for(; num - index >= step; index += step)
+            {
+                auto const mask = Ops::equal(detail::simd_avx2_load(lhs, index)
+                                            , detail::simd_avx2_load(rhs_prepared, index));
+
+                bits += __builtin_popcount(static_cast<unsigned>(_mm256_movemask_epi8(mask)));
+            }
+
+            return bits / sizeof(T)
+                   + detail::count_equal_scalar(lhs + index, detail::simd_advance(rhs, index)
+                                                , num - index);
+        }
+
+        template <bool Equal, class T, class Rhs>
+        SAGA_TARGET_AVX2
+        std::size_t find_first_equal_avx2(T const * lhs, Rhs const & rhs, std::size_t num)
+        {
+            using Ops = simd_avx2_ops<sizeof(T)>;
+            constexpr auto step = sizeof(__m256i) / sizeof(T);
+
+            auto const rhs_prepared = detail::simd_avx2_prepare(lhs, rhs);
+
+            auto index = std::size_t(0);
+
+            for(; num - index >= step; index += step)
+            {
+                auto const mask = Ops::equal(detail::simd_avx2_load(lhs, index)
+                                            , detail::simd_avx2_load(rhs_prepared, index));
+
+                auto bits = static_cast<unsigned>(_mm256_movemask_epi8(mask));
+
+                if(!Equal)
+                {
+                    bits = ~bits;
+                }
+
+                if(bits != 0)
+                {
+                    return index + static_cast<std::size_t>(__builtin_ctz(bits)) / sizeof(T);
+                }
+            }
+
+            return index + detail::find_first_equal_scalar<Equal>(lhs + index
+                                                                   , detail::simd_advance(rhs, index)
+                                                                   , num - index);
+        }
+#endif
+// SAGA_SIMD_X86
+
+        // Выбор реализации
+        /** @brief Количество позиций, в которых элементы @c lhs равны соответствующим элементам
+        @c rhs
+        */
+        template <class T, class Rhs>
+        std::size_t simd_count_equal(T const * lhs, Rhs const & rhs, std::size_t num)
+        {
+            static_assert(is_simd_equality_comparable<T>{});
+
+#ifdef SAGA_SIMD_X86
+            if(detail::cpu_has_avx2())
+            {
+                return detail::count_equal_avx2(lhs, rhs, num);
+            }
+
+            return detail::count_equal_sse2(lhs, rhs, num);
+#else
+            return detail::count_equal_scalar(lhs, rhs, num);
+#endif
+// SAGA_SIMD_X86
+        }
+
+        /** @brief Индекс первой позиции, в которой результат сравнения элементов @c lhs и @c rhs
+        на равенство совпадает с @c Equal, или @c num, если такой позиции нет
+        */
+        template <bool Equal, class T, class Rhs>
+        std::size_t simd_find_first_equal(T const * lhs, Rhs const & rhs, std::size_t num)
+        {
+            static_assert(is_simd_equality_comparable<T>{});
+
+#ifdef SAGA_SIMD_X86
+            if(detail::cpu_has_avx2())
+            {
+                return detail::find_first_equal_avx2<Equal>(lhs, rhs, num);
+            }
+
+            return detail::find_first_equal_sse2<Equal>(lhs, rhs, num);
+#else
+            return detail::find_first_equal_scalar<Equal>(lhs, rhs, num);
+#endif
+// SAGA_SIMD_X86
+        }
+    }
+    // namespace detail
+}
+// namespace saga
+
+#endif
+// Z_SAGA_DETAIL_SIMD_EQUAL_HPP_INCLUDED
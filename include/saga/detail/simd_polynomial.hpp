@@ -0,0 +1,392 @@
+/* (c) 2026 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки SAGA.
+
+SAGA -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#ifndef Z_SAGA_DETAIL_SIMD_POLYNOMIAL_HPP_INCLUDED
+#define Z_SAGA_DETAIL_SIMD_POLYNOMIAL_HPP_INCLUDED
+
+/** @file saga/detail/simd_polynomial.hpp
+ @brief Вычисление значений многочлена сразу в нескольких точках
+
+ Схема Горнера для одной точки -- это цепочка зависимых умножений со сложением, поэтому её
+ скорость ограничена задержкой этих операций, а не их пропускной способностью. Здесь вычисляются
+ несколько независимых цепочек одновременно. Для float и double на процессорах с AVX2 и FMA
+ каждая цепочка обрабатывает вектор точек, а умножение со сложением выполняется одной командой
+ (с одним округлением), поэтому результат может отличаться от вычисленного для отдельной точки в
+ последних битах.
+
+ Схема Эстрина вычисляет многочлен по уровням: a_0 + a_1 x, a_2 + a_3 x, ... затем попарно
+ с множителем x^2, x^4 и т.д. Глубина цепочки зависимостей логарифмическая, что полезно для
+ многочленов высокой степени.
+*/
+
+#include <saga/detail/simd.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+namespace saga
+{
+    namespace detail
+    {
+        // Переносимые реализации
+        /** @brief Схема Горнера с четырьмя независимыми цепочками
+        @param coefficients коэффициенты, начиная со старшего
+        @pre <tt>num_coefficients > 0</tt>
+        */
+        template <class T>
+        void polynomial_horner_scalar(T const * coefficients, std::size_t num_coefficients
+                                     , T const * points, std::size_t num, T * result)
+        {
+            auto index = std::size_t(0);
+
+            for(; num - index >= 4; index += 4)
+            {
+                T const x0 = points[index];
+                T const x1 = points[index + 1];
+                T const x2 = points[index + 2];
+                T const x3 = points[index + 3];
+
+                T acc0 = coefficients[0];
+                T acc1 = coefficients[0];
+                T acc2 = coefficients[0];
+                T acc3 = coefficients[0];
+
+                for(auto pos = std::size_t(1); pos < num_coefficients; ++pos)
+                {
+                    acc0 = acc0 * x0 + coefficients[pos];
+                    acc1 = acc1 * x1 + coefficients[pos];
+                    acc2 = acc2 * x2 + coefficients[pos];
+                    acc3 = acc3 * x3 + coefficients[pos];
+                }
+
+                result[index] = acc0;
+                result[index + 1] = acc1;
+                result[index + 2] = acc2;
+                result[index + 3] = acc3;
+            }
+
+            for(; index < num; ++index)
+            {
+                T const x = points[index];
+                T acc = coefficients[0];
+
+                for(auto pos = std::size_t(1); pos < num_coefficients; ++pos)
+                {
+                    acc = acc * x + coefficients[pos];
+                }
+
+                result[index] = acc;
+            }
+        }
+
+        /** @brief Схема Эстрина
+        @param coefficients коэффициенты, начиная с младшего
+        @param scratch буфер не менее чем из <tt>(num_coefficients + 1) / 2</tt> элементов
+        @pre <tt>num_coefficients > 0</tt>
+        */
+        template <class T>
+        void polynomial_estrin_scalar(T const * coefficients, std::size_t num_coefficients
+                                     , T const * points, std::size_t num, T * result
+                                     , T * scratch)
+        {
+            for(auto index = std::size_t(0); index < num; ++index)
+            {
+                T const x = points[index];
+
+                auto size = (num_coefficients + 1) / 2;
+
+                for(auto pos = std::size_t(0); pos < size; ++pos)
+                {
+                    scratch[pos] = (2 * pos + 1 < num_coefficients)
+                                 ? coefficients[2 * pos] + coefficients[2 * pos + 1] * x
+                                 : coefficients[2 * pos];
+                }
+
+                for(T power = x * x; size > 1; power = power * power)
+                {
+                    auto const old_size = size;
+                    size = (size + 1) / 2;
+
+                    for(auto pos = std::size_t(0); pos < size; ++pos)
+                    {
+                        scratch[pos] = (2 * pos + 1 < old_size)
+                                     ? scratch[2 * pos] + scratch[2 * pos + 1] * power
+                                     : scratch[2 * pos];
+                    }
+                }
+
+                result[index] = scratch[0];
+            }
+        }
+
+#ifdef SAGA_SIMD_X86
+        template <class T>
+        struct simd_fma_ops;
+
+        template <>
+        struct simd_fma_ops<double>
+        {
+            using vector = __m256d;
+
+            static constexpr std::size_t lanes = 4;
+
+            SAGA_TARGET_AVX2_FMA_INLINE static vector broadcast(double value)
+            {
+                return _mm256_set1_pd(value);
+            }
+
+            SAGA_TARGET_AVX2_FMA_INLINE static vector load(double const * ptr)
+            {
+                return _mm256_loadu_pd(ptr);
+            }
+
+            SAGA_TARGET_AVX2_FMA_INLINE static void store(double * ptr, vector value)
+            {
+                _mm256_storeu_pd(ptr, value);
+            }
+
+            /// @brief <tt>lhs * rhs + addend</tt> с одним округлением
+            SAGA_TARGET_AVX2_FMA_INLINE static vector fma(vector lhs, vector rhs, vector addend)
+            {
+                return _mm256_fmadd_pd(lhs, rhs, addend);
+            }
+
+            SAGA_TARGET_AVX2_FMA_INLINE static vector multiply(vector lhs, vector rhs)
+            {
+                return _mm256_mul_pd(lhs, rhs);
+            }
+        };
+
+        template <>
+        struct simd_fma_ops<float>
+        {
+            using vector = __m256;
+
+            static constexpr std::size_t lanes = 8;
+
+            SAGA_TARGET_AVX2_FMA_INLINE static vector broadcast(float value)
+            {
+                return _mm256_set1_ps(value);
+            }
+
+            SAGA_TARGET_AVX2_FMA_INLINE static vector load(float const * ptr)
+            {
+                return _mm256_loadu_ps(ptr);
+            }
+
+            SAGA_TARGET_AVX2_FMA_INLINE static void store(float * ptr, vector value)
+            {
+                _mm256_storeu_ps(ptr, value);
+            }
+
+            SAGA_TARGET_AVX2_FMA_INLINE static vector fma(vector lhs, vector rhs, vector addend)
+            {
+                return _mm256_fmadd_ps(lhs, rhs, addend);
+            }
+
+            SAGA_TARGET_AVX2_FMA_INLINE static vector multiply(vector lhs, vector rhs)
+            {
+                return _mm256_mul_ps(lhs, rhs);
+            }
+        };
+
+        /** @brief Схема Горнера: восемь независимых цепочек по одному вектору точек
+        @return Количество обработанных точек (кратно длине вектора)
+        */
+        template <class T>
+        SAGA_TARGET_AVX2_FMA
+        std::size_t polynomial_horner_avx2_fma(T const * coefficients, std::size_t num_coefficients
+                                              , T const * points, std::size_t num, T * result)
+        {
+            using Ops = simd_fma_ops<T>;
+            constexpr auto lanes = Ops::lanes;
+
+            // Задержка FMA -- 4-5 тактов при двух командах за такт
+            constexpr auto chains = std::size_t(8);
+
+            auto index = std::size_t(0);
+
+            for(; num - index >= chains * lanes; index += chains * lanes)
+            {
+                typename Ops::vector x[chains];
+                typename Ops::vector acc[chains];
+
+                for(auto chain = std::size_t(0); chain < chains; ++chain)
+                {
+                    x[chain] = Ops::load(points + index + chain * lanes);
+                    acc[chain] = Ops::broadcast(coefficients[0]);
+                }
+
+                for(auto pos = std::size_t(1); pos < num_coefficients; ++pos)
+                {
+                    auto const coefficient = Ops::broadcast(coefficients[pos]);
+
+                    for(auto chain = std::size_t(0); chain < chains; ++chain)
+                    {
+                        acc[chain] = Ops::fma(acc[chain], x[chain], coefficient);
+                    }
+                }
+
+                for(auto chain = std::size_t(0); chain < chains; ++chain)
+                {
+                    Ops::store(result + index + chain * lanes, acc[chain]);
+                }
+            }
+
+            for(; num - index >= lanes; index += lanes)
+            {
+                auto const x = Ops::load(points + index);
+                auto acc = Ops::broadcast(coefficients[0]);
+
+                for(auto pos = std::size_t(1); pos < num_coefficients; ++pos)
+                {
+                    acc = Ops::fma(acc, x, Ops::broadcast(coefficients[pos]));
+                }
+
+                Ops::store(result + index, acc);
+            }
+
+            return index;
+        }
+
+        /** @brief Схема Эстрина для векторов точек
+        @param coefficients коэффициенты, начиная с младшего
+        @param scratch буфер не менее чем из <tt>(num_coefficients + 1) / 2 * lanes</tt> элементов
+        @return Количество обработанных точек (кратно длине вектора)
+        */
+        template <class T>
+        SAGA_TARGET_AVX2_FMA
+        std::size_t polynomial_estrin_avx2_fma(T const * coefficients, std::size_t num_coefficients
+                                              , T const * points, std::size_t num, T * result
+                                              , T * scratch)
+        {
+            using Ops = simd_fma_ops<T>;
+            constexpr auto lanes = Ops::lanes;
+
+            auto index = std::size_t(0);
+
+            for(; num - index >= lanes; index += lanes)
+            {
+                auto const x = Ops::load(points + index);
+
+                auto size = (num_coefficients + 1) / 2;
+
+                for(auto pos = std::size_t(0); pos < size; ++pos)
+                {
+                    auto const low = Ops::broadcast(coefficients[2 * pos]);
+
+                    auto const value
+                        = (2 * pos + 1 < num_coefficients)
+                        ? Ops::fma(Ops::broadcast(coefficients[2 * pos + 1]), x, low)
+                        : low;
+
+                    Ops::store(scratch + pos * lanes, value);
+                }
+
+                for(auto power = Ops::multiply(x, x); size > 1;
+                    power = Ops::multiply(power, power))
+                {
+                    auto const old_size = size;
+                    size = (size + 1) / 2;
+
+                    for(auto pos = std::size_t(0); pos < size; ++pos)
+                    {
+                        auto const low = Ops::load(scratch + 2 * pos * lanes);
+
+                        auto const value
+                            = (2 * pos + 1 < old_size)
+                            ? Ops::fma(Ops::load(scratch + (2 * pos + 1) * lanes), power, low)
+                            : low;
+
+                        Ops::store(scratch + pos * lanes, value);
+                    }
+                }
+
+                Ops::store(result + index, Ops::load(scratch));
+            }
+
+            return index;
+        }
+#endif
+// SAGA_SIMD_X86
+
+        template <class T>
+        struct is_simd_fma_type
+         : std::bool_constant<std::is_same<T, float>{} || std::is_same<T, double>{}>
+        {};
+
+        // Выбор реализации
+        /** @brief Значения многочлена в точках <tt>points[0..num)</tt> по схеме Горнера
+        @param coefficients коэффициенты, начиная со старшего
+        @pre <tt>num_coefficients > 0</tt>
+        */
+        template <class T>
+        void simd_polynomial_horner(T const * coefficients, std::size_t num_coefficients
+                                   , T const * points, std::size_t num, T * result)
+        {
+            auto index = std::size_t(0);
+
+#ifdef SAGA_SIMD_X86
+            if constexpr (is_simd_fma_type<T>{})
+            {
+                if(detail::cpu_has_avx2_fma())
+                {
+                    index = detail::polynomial_horner_avx2_fma(coefficients, num_coefficients
+                                                              , points, num, result);
+                }
+            }
+#endif
+// SAGA_SIMD_X86
+
+            detail::polynomial_horner_scalar(coefficients, num_coefficients
+                                            , points + index, num - index, result + index);
+        }
+
+        /** @brief Значения многочлена в точках <tt>points[0..num)</tt> по схеме Эстрина
+        @param coefficients коэффициенты, начиная с младшего
+        @param scratch буфер не менее чем из <tt>(num_coefficients + 1) / 2 * 8</tt> элементов
+        @pre <tt>num_coefficients > 0</tt>
+        */
+        template <class T>
+        void simd_polynomial_estrin(T const * coefficients, std::size_t num_coefficients
+                                   , T const * points, std::size_t num, T * result, T * scratch)
+        {
+            auto index = std::size_t(0);
+
+#ifdef SAGA_SIMD_X86
+            if constexpr (is_simd_fma_type<T>{})
+            {
+                if(detail::cpu_has_avx2_fma())
+                {
+                    index = detail::polynomial_estrin_avx2_fma(coefficients, num_coefficients
+                                                              , points, num, result, scratch);
+                }
+            }
+#endif
+// SAGA_SIMD_X86
+
+            detail::polynomial_estrin_scalar(coefficients, num_coefficients
+                                            , points + index, num - index, result + index
+                                            , scratch);
+        }
+    }
+    // namespace detail
+}
+// namespace saga
+
+#endif
+// Z_SAGA_DETAIL_SIMD_POLYNOMIAL_HPP_INCLUDED
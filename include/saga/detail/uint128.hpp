@@ -0,0 +1,184 @@
+/* (c) 2026 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки SAGA.
+
+SAGA -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#ifndef Z_SAGA_DETAIL_UINT128_HPP_INCLUDED
+#define Z_SAGA_DETAIL_UINT128_HPP_INCLUDED
+
+/** @file saga/detail/uint128.hpp
+ @brief Умножение 64-битных чисел с получением 128-битного результата и обратное деление
+
+ Если компилятор поддерживает 128-битные целые, то используются они, в противном случае
+ произведение и частное вычисляются через 32-битные половины.
+*/
+
+#include <cstdint>
+
+#if defined(__SIZEOF_INT128__)
+#define SAGA_HAS_INT128 1
+#endif
+// SAGA_HAS_INT128
+
+namespace saga
+{
+    namespace detail
+    {
+#ifdef SAGA_HAS_INT128
+        __extension__ typedef unsigned __int128 uint128_t;
+#endif
+// SAGA_HAS_INT128
+
+        struct wide_product_64
+        {
+            std::uint64_t high;
+            std::uint64_t low;
+        };
+
+        /// @brief Полное (128-битное) произведение двух 64-битных чисел
+        constexpr wide_product_64 multiply_wide_64(std::uint64_t lhs, std::uint64_t rhs) noexcept
+        {
+#ifdef SAGA_HAS_INT128
+            auto const product = detail::uint128_t(lhs) * rhs;
+
+            return {std::uint64_t(product >> 64), std::uint64_t(product)};
+#else
+            constexpr auto mask = std::uint64_t(0xFFFF'FFFF);
+
+            auto const lhs_low = lhs & mask;
+            auto const lhs_high = lhs >> 32;
+            auto const rhs_low = rhs & mask;
+            auto const rhs_high = rhs >> 32;
+
+            auto const low_low = lhs_low * rhs_low;
+            auto const low_high = lhs_low * rhs_high;
+            auto const high_low = lhs_high * rhs_low;
+            auto const high_high = lhs_high * rhs_high;
+
+            auto const middle = (low_low >> 32) + (low_high & mask) + (high_low & mask);
+
+            return {high_high + (low_high >> 32) + (high_low >> 32) + (middle >> 32)
+                   , (middle << 32) | (low_low & mask)};
+#endif
+        }
+
+        /// @brief Старшие 64 бита произведения двух 64-битных чисел
+        constexpr std::uint64_t multiply_high_64(std::uint64_t lhs, std::uint64_t rhs) noexcept
+        {
+            return detail::multiply_wide_64(lhs, rhs).high;
+        }
+
+        /// @brief Количество старших нулевых битов ненулевого 64-битного числа
+        constexpr unsigned countl_zero_64(std::uint64_t word) noexcept
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return static_cast<unsigned>(__builtin_clzll(word));
+#else
+            auto result = 0u;
+
+            for(; (word >> 63) == 0; word <<= 1)
+            {
+                ++result;
+            }
+
+            return result;
+#endif
+        }
+
+        struct wide_quotient_64
+        {
+            std::uint64_t quotient;
+            std::uint64_t remainder;
+        };
+
+        /** @brief Деление 128-битного числа <tt>high * 2^64 + low</tt> на 64-битное через
+        32-битные половины (алгоритм divlu из книги Г. Уоррена "Алгоритмические трюки для
+        программистов")
+        @pre <tt>high < divisor</tt>, поэтому частное помещается в 64 бита
+        */
+        constexpr wide_quotient_64
+        divide_wide_64_portable(std::uint64_t high, std::uint64_t low
+                                , std::uint64_t divisor) noexcept
+        {
+            constexpr auto base = std::uint64_t(1) << 32;
+            constexpr auto mask = base - 1;
+
+            auto const shift = detail::countl_zero_64(divisor);
+
+            divisor <<= shift;
+            high = (shift == 0) ? high : (high << shift) | (low >> (64 - shift));
+            low <<= shift;
+
+            auto const divisor_high = divisor >> 32;
+            auto const divisor_low = divisor & mask;
+            auto const low_high = low >> 32;
+            auto const low_low = low & mask;
+
+            auto quotient_high = high / divisor_high;
+            auto rest = high - quotient_high * divisor_high;
+
+            for(; quotient_high >= base || quotient_high * divisor_low > base * rest + low_high;)
+            {
+                --quotient_high;
+                rest += divisor_high;
+
+                if(rest >= base)
+                {
+                    break;
+                }
+            }
+
+            auto const middle = high * base + low_high - quotient_high * divisor;
+
+            auto quotient_low = middle / divisor_high;
+            rest = middle - quotient_low * divisor_high;
+
+            for(; quotient_low >= base || quotient_low * divisor_low > base * rest + low_low;)
+            {
+                --quotient_low;
+                rest += divisor_high;
+
+                if(rest >= base)
+                {
+                    break;
+                }
+            }
+
+            auto const remainder = (middle * base + low_low - quotient_low * divisor) >> shift;
+
+            return {quotient_high * base + quotient_low, remainder};
+        }
+
+        /** @brief Деление 128-битного числа <tt>high * 2^64 + low</tt> на 64-битное
+        @pre <tt>high < divisor</tt>, поэтому частное помещается в 64 бита
+        */
+        constexpr wide_quotient_64
+        divide_wide_64(std::uint64_t high, std::uint64_t low, std::uint64_t divisor) noexcept
+        {
+#ifdef SAGA_HAS_INT128
+            auto const dividend = (detail::uint128_t(high) << 64) | low;
+
+            return {std::uint64_t(dividend / divisor), std::uint64_t(dividend % divisor)};
+#else
+            return detail::divide_wide_64_portable(high, low, divisor);
+#endif
+        }
+    }
+    // namespace detail
+}
+// namespace saga
+
+#endif
+// Z_SAGA_DETAIL_UINT128_HPP_INCLUDED
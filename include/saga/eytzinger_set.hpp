@@ -0,0 +1,484 @@
+/* (c) 2026 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки SAGA.
+
+SAGA -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#ifndef Z_SAGA_EYTZINGER_SET_HPP_INCLUDED
+#define Z_SAGA_EYTZINGER_SET_HPP_INCLUDED
+
+/** @file saga/eytzinger_set.hpp
+ @brief Неизменяемое множество, элементы которого хранятся в порядке Эйтцингера
+
+ Элементы упорядоченного множества располагаются в порядке обхода в ширину неявного полного
+ двоичного дерева поиска: корень имеет номер 1, потомки узла k -- номера 2k и 2k + 1. Первые
+ уровни дерева, через которые проходит каждый поиск, оказываются рядом и остаются в кэше, а поиск
+ выполняется без ветвлений: номер следующего узла вычисляется по результату сравнения. Потомки
+ узла k на d уровней ниже занимают 2^d последовательных номеров, начиная с 2^d k. Элементы хранятся
+ в памяти, выровненной по границе строки кэша, поэтому строку с такими потомками можно загрузить
+ заранее, пока выполняются сравнения на промежуточных уровнях (для int -- через четыре уровня).
+
+ Для множеств, не помещающихся в кэш второго уровня, поиск выполняется в несколько раз быстрее,
+ чем двоичный поиск в упорядоченном массиве. Изменять множество нельзя: оно создаётся за O(n) из
+ flat_set или упорядоченного интервала без эквивалентных элементов.
+
+ Основано на https://algorithmica.org/en/eytzinger
+*/
+
+#include <saga/flat_set.hpp>
+#include <saga/utility/operators.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <new>
+#include <vector>
+
+namespace saga
+{
+    namespace detail
+    {
+        /// @brief Распределитель памяти, выравнивающий блоки по границе строки кэша
+        template <class T>
+        struct cache_aligned_allocator
+        {
+            using value_type = T;
+
+            static constexpr std::size_t alignment = 64;
+
+            template <class Other>
+            struct rebind
+            {
+                using other = cache_aligned_allocator<Other>;
+            };
+
+            cache_aligned_allocator() = default;
+
+            template <class Other>
+            cache_aligned_allocator(cache_aligned_allocator<Other> const &) noexcept
+            {}
+
+            T * allocate(std::size_t num)
+            {
+                return static_cast<T *>(::operator new(num * sizeof(T)
+                                                      , std::align_val_t(alignment)));
+            }
+
+            void deallocate(T * ptr, std::size_t) noexcept
+            {
+                ::operator delete(ptr, std::align_val_t(alignment));
+            }
+
+            friend bool operator==(cache_aligned_allocator const &, cache_aligned_allocator const &)
+            {
+                return true;
+            }
+
+            friend bool operator!=(cache_aligned_allocator const &, cache_aligned_allocator const &)
+            {
+                return false;
+            }
+        };
+
+        /// @brief Количество младших единичных битов числа, не все биты которого -- единицы
+        inline unsigned eytzinger_trailing_ones(std::size_t index)
+        {
+            assert(~index != 0);
+
+#if defined(__GNUC__) || defined(__clang__)
+            return static_cast<unsigned>(__builtin_ctzll(~index));
+#else
+            auto result = 0u;
+
+            for(; (index & 1) != 0; index >>= 1)
+            {
+                ++result;
+            }
+
+            return result;
+#endif
+        }
+
+        /** @brief Номер узла, следующего за @c index при симметричном обходе дерева из @c num узлов
+        @return 0, если такого узла нет
+        */
+        inline std::size_t eytzinger_next(std::size_t index, std::size_t num)
+        {
+            assert(0 < index && index <= num);
+
+            if(2 * index + 1 <= num)
+            {
+                index = 2 * index + 1;
+
+                for(; 2 * index <= num;)
+                {
+                    index = 2 * index;
+                }
+
+                return index;
+            }
+
+            // Подъём, пока узел -- правый потомок, затем ещё на один уровень
+            return index >> (detail::eytzinger_trailing_ones(index) + 1);
+        }
+
+        /** @brief Номер узла, предшествующего @c index при симметричном обходе дерева
+        @param index номер узла или 0, что обозначает позицию за последним узлом
+        @return 0, если такого узла нет
+        */
+        inline std::size_t eytzinger_prev(std::size_t index, std::size_t num)
+        {
+            assert(index <= num);
+
+            if(index == 0 || 2 * index <= num)
+            {
+                index = (index == 0) ? 1 : 2 * index;
+
+                for(; 2 * index + 1 <= num;)
+                {
+                    index = 2 * index + 1;
+                }
+
+                return (num == 0) ? 0 : index;
+            }
+
+            // Подъём, пока узел -- левый потомок, затем ещё на один уровень
+            return index >> (detail::eytzinger_trailing_ones(~index) + 1);
+        }
+    }
+    // namespace detail
+
+    /** @brief Итератор eytzinger_set: проходит элементы в порядке возрастания (симметричный обход
+    неявного дерева)
+    */
+    template <class Key>
+    class eytzinger_iterator
+     : operators::unit_steppable<eytzinger_iterator<Key>
+     , operators::equality_comparable<eytzinger_iterator<Key>>>
+    {
+        friend bool operator==(eytzinger_iterator const & lhs, eytzinger_iterator const & rhs)
+        {
+            assert(lhs.data_ == rhs.data_);
+
+            return lhs.index_ == rhs.index_;
+        }
+
+    public:
+        // Типы
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = Key;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Key const *;
+        using reference = Key const &;
+
+        // Создание, копирование, уничтожение
+        eytzinger_iterator() = default;
+
+        /** @brief Итератор, указывающий на узел с номером @c index
+        @param data элементы в порядке Эйтцингера, узлу k соответствует <tt>data[k]</tt>
+        @param index номер узла или 0, что обозначает позицию за последним элементом
+        */
+        eytzinger_iterator(Key const * data, std::size_t num, std::size_t index)
+         : data_(data)
+         , num_(num)
+         , index_(index)
+        {
+            assert(index <= num);
+        }
+
+        // Итератор
+        reference operator*() const
+        {
+            assert(this->index_ != 0);
+
+            return this->data_[this->index_];
+        }
+
+        pointer operator->() const
+        {
+            return std::addressof(**this);
+        }
+
+        eytzinger_iterator & operator++()
+        {
+            this->index_ = detail::eytzinger_next(this->index_, this->num_);
+            return *this;
+        }
+
+        // Двусторонний итератор
+        eytzinger_iterator & operator--()
+        {
+            this->index_ = detail::eytzinger_prev(this->index_, this->num_);
+            return *this;
+        }
+
+    private:
+        Key const * data_ = nullptr;
+        std::size_t num_ = 0;
+        std::size_t index_ = 0;
+    };
+
+    /** @brief Неизменяемое множество с поиском по порядку Эйтцингера
+    @tparam Compare функция сравнения, такая же, как у flat_set, из которого создаётся множество
+    */
+    template <class Key, class Compare = std::less<Key>>
+    class eytzinger_set
+     : private Compare
+    {
+    public:
+        // Типы
+        using key_type        = Key;
+        using value_type      = Key;
+        using key_compare     = Compare;
+        using value_compare   = Compare;
+        using reference       = value_type const &;
+        using const_reference = value_type const &;
+        using size_type       = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using iterator        = eytzinger_iterator<Key>;
+        using const_iterator  = eytzinger_iterator<Key>;
+
+        // Создание, копирование, уничтожение
+        eytzinger_set()
+         : eytzinger_set(key_compare())
+        {}
+
+        explicit eytzinger_set(key_compare cmp)
+         : Compare(std::move(cmp))
+         , data_()
+        {}
+
+        /// @brief Создание по элементам @c src за O(n)
+        template <class KeyContainer>
+        explicit eytzinger_set(saga::flat_set<Key, Compare, KeyContainer> const & src)
+         : eytzinger_set(saga::sorted_unique, src.begin(), src.end(), src.key_comp())
+        {}
+
+        /** @brief Создание по упорядоченному интервалу за O(n)
+        @pre Интервал <tt>[first, last)</tt> упорядочен по @c cmp и не содержит эквивалентных
+        элементов
+        */
+        template <class ForwardIterator>
+        eytzinger_set(sorted_unique_t, ForwardIterator first, ForwardIterator last
+                     , key_compare cmp = key_compare())
+         : Compare(std::move(cmp))
+         , data_()
+        {
+            if(first == last)
+            {
+                return;
+            }
+
+            // Узлы нумеруются с единицы, нулевой элемент не используется. Элементы копируются
+            // дважды, зато не требуется конструктор без аргументов
+            this->data_.push_back(*first);
+            this->data_.insert(this->data_.end(), first, last);
+
+            this->fill_private(first, 1);
+
+            assert(first == last);
+            assert(std::adjacent_find(this->begin(), this->end()
+                                     , [this](Key const & lhs, Key const & rhs)
+                                       { return !this->cmp_ref()(lhs, rhs); })
+                   == this->end());
+        }
+
+        // Итераторы
+        const_iterator begin() const
+        {
+            return this->make_iterator(this->data_.empty() ? 0 : this->leftmost_private());
+        }
+
+        const_iterator end() const
+        {
+            return this->make_iterator(0);
+        }
+
+        const_iterator cbegin() const
+        {
+            return this->begin();
+        }
+
+        const_iterator cend() const
+        {
+            return this->end();
+        }
+
+        // Размер
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return this->data_.empty();
+        }
+
+        size_type size() const noexcept
+        {
+            return this->data_.empty() ? 0 : this->data_.size() - 1;
+        }
+
+        // Немодифицирующие операции
+        key_compare key_comp() const
+        {
+            return this->cmp_ref();
+        }
+
+        value_compare value_comp() const
+        {
+            return this->key_comp();
+        }
+
+        // Операции множества
+        /// @brief Итератор на первый элемент, не меньший @c key, или end()
+        const_iterator lower_bound(key_type const & key) const
+        {
+            return this->make_iterator(this->lower_bound_index_private(key));
+        }
+
+        /// @brief Итератор на первый элемент, больший @c key, или end()
+        const_iterator upper_bound(key_type const & key) const
+        {
+            auto const & cmp = this->cmp_ref();
+
+            return this->make_iterator(this->search_private([&cmp, &key](Key const & elem)
+                                                            { return !cmp(key, elem); }));
+        }
+
+        const_iterator find(key_type const & key) const
+        {
+            auto const index = this->lower_bound_index_private(key);
+
+            if(index == 0 || this->cmp_ref()(key, this->data_[index]))
+            {
+                return this->end();
+            }
+
+            return this->make_iterator(index);
+        }
+
+        bool contains(key_type const & key) const
+        {
+            return this->find(key) != this->end();
+        }
+
+        size_type count(key_type const & key) const
+        {
+            return this->contains(key) ? 1 : 0;
+        }
+
+        std::pair<const_iterator, const_iterator> equal_range(key_type const & key) const
+        {
+            return {this->lower_bound(key), this->upper_bound(key)};
+        }
+
+        friend bool operator==(eytzinger_set const & lhs, eytzinger_set const & rhs)
+        {
+            return lhs.data_ == rhs.data_;
+        }
+
+        friend bool operator!=(eytzinger_set const & lhs, eytzinger_set const & rhs)
+        {
+            return !(lhs == rhs);
+        }
+
+    private:
+        key_compare const & cmp_ref() const
+        {
+            return *this;
+        }
+
+        const_iterator make_iterator(size_type index) const
+        {
+            return const_iterator(this->data_.data(), this->size(), index);
+        }
+
+        size_type leftmost_private() const
+        {
+            auto index = size_type(1);
+
+            for(; 2 * index <= this->size();)
+            {
+                index = 2 * index;
+            }
+
+            return index;
+        }
+
+        template <class ForwardIterator>
+        void fill_private(ForwardIterator & pos, size_type index)
+        {
+            if(index > this->size())
+            {
+                return;
+            }
+
+            this->fill_private(pos, 2 * index);
+
+            this->data_[index] = *pos;
+            ++pos;
+
+            this->fill_private(pos, 2 * index + 1);
+        }
+
+        size_type lower_bound_index_private(key_type const & key) const
+        {
+            auto const & cmp = this->cmp_ref();
+
+            return this->search_private([&cmp, &key](Key const & elem) { return cmp(elem, key); });
+        }
+
+        /** @brief Номер первого в порядке возрастания узла, для которого @c pred ложен
+        @pre @c pred истинен для начальной части элементов в порядке возрастания и ложен для
+        остальных
+        @return Номер узла или 0, если таких узлов нет
+        */
+        template <class Predicate>
+        size_type search_private(Predicate pred) const
+        {
+            // Потомки узла k на несколько уровней ниже: строка кэша, начинающаяся с узла block * k
+            constexpr auto alignment = detail::cache_aligned_allocator<Key>::alignment;
+            constexpr auto prefetch_block = (alignment / sizeof(Key) > 0)
+                                          ? alignment / sizeof(Key) : size_type(1);
+
+            auto const num = this->size();
+            auto const * const data = this->data_.data();
+
+            auto index = size_type(1);
+
+            for(; index <= num;)
+            {
+#if defined(__GNUC__) || defined(__clang__)
+                /* Адрес может выходить за пределы массива, поэтому он вычисляется в целых числах:
+                арифметика указателей за пределами массива не определена, а предварительная
+                загрузка по недоступному адресу не приводит к ошибке
+                */
+                auto const address = reinterpret_cast<std::uintptr_t>(data)
+                                   + prefetch_block * index * sizeof(Key);
+                __builtin_prefetch(reinterpret_cast<void const *>(address));
+#endif
+                index = 2 * index + static_cast<size_type>(pred(data[index]));
+            }
+
+            // Отменяем последние переходы направо и один переход налево
+            return index >> (detail::eytzinger_trailing_ones(index) + 1);
+        }
+
+        std::vector<Key, detail::cache_aligned_allocator<Key>> data_;
+    };
+}
+// namespace saga
+
+#endif
+// Z_SAGA_EYTZINGER_SET_HPP_INCLUDED
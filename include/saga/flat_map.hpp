@@ -0,0 +1,936 @@
+/* (c) 2026 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки SAGA.
+
+SAGA -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#ifndef Z_SAGA_FLAT_MAP_HPP_INCLUDED
+#define Z_SAGA_FLAT_MAP_HPP_INCLUDED
+
+/** @file saga/flat_map.hpp
+ @brief Аналог std::map, хранящий ключи и значения в отдельных контейнерах
+
+ Основан на https://www.open-std.org/jtc1/sc22/wg21/docs/papers/2022/p0429r9.pdf
+ Ключи и значения хранятся в отдельных контейнерах (по умолчанию -- std::vector), поэтому при
+ поиске просматривается плотный массив ключей, а значения не загружаются в кэш. Разыменование
+ итератора возвращает прокси-ссылку std::pair<key_type const &, mapped_type &>.
+
+ Отличия от предложения по стандартизации:
+ * Используется saga::reverse_iterator вместо std::reverse_iterator
+ * Функция сравнения передаётся в конструкторы по значению
+ * Из нескольких элементов с эквивалентными ключами при создании или вставке интервала сохраняется
+ первый, как при вставке элементов по одному
+*/
+
+#include <saga/action/sort.hpp>
+#include <saga/action/unique.hpp>
+#include <saga/algorithm.hpp>
+#include <saga/container/reserve_if_supported.hpp>
+#include <saga/cursor/subrange.hpp>
+#include <saga/flat_set.hpp>
+#include <saga/iterator/reverse.hpp>
+#include <saga/utility/operators.hpp>
+
+#include <cassert>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace saga
+{
+    namespace detail
+    {
+        /// @brief Указатель на временный объект, возвращаемый оператором -> прокси-итераторов
+        template <class Reference>
+        class arrow_proxy
+        {
+        public:
+            explicit arrow_proxy(Reference ref)
+             : ref_(std::move(ref))
+            {}
+
+            Reference const * operator->() const
+            {
+                return std::addressof(this->ref_);
+            }
+
+        private:
+            Reference ref_;
+        };
+    }
+    // namespace detail
+
+    /** @brief Итератор flat_map: пара итераторов контейнеров ключей и значений, сдвигающихся
+    одновременно
+    */
+    template <class KeyIterator, class MappedIterator>
+    class flat_map_iterator
+     : operators::additive_with<flat_map_iterator<KeyIterator, MappedIterator>
+                               , typename std::iterator_traits<KeyIterator>::difference_type
+     , operators::unit_steppable<flat_map_iterator<KeyIterator, MappedIterator>
+     , operators::totally_ordered<flat_map_iterator<KeyIterator, MappedIterator>>>>
+    {
+        template <class OtherKeyIterator, class OtherMappedIterator>
+        friend class flat_map_iterator;
+
+        friend bool operator==(flat_map_iterator const & lhs, flat_map_iterator const & rhs)
+        {
+            return lhs.key_ == rhs.key_;
+        }
+
+        friend bool operator<(flat_map_iterator const & lhs, flat_map_iterator const & rhs)
+        {
+            return lhs.key_ < rhs.key_;
+        }
+
+    public:
+        // Типы
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = std::pair<saga::iter_value_t<KeyIterator>
+                                    , saga::iter_value_t<MappedIterator>>;
+        using difference_type = typename std::iterator_traits<KeyIterator>::difference_type;
+        using reference = std::pair<typename std::iterator_traits<KeyIterator>::reference
+                                   , typename std::iterator_traits<MappedIterator>::reference>;
+        using pointer = detail::arrow_proxy<reference>;
+
+        // Создание, копирование, уничтожение
+        flat_map_iterator() = default;
+
+        flat_map_iterator(KeyIterator key, MappedIterator mapped)
+         : key_(std::move(key))
+         , mapped_(std::move(mapped))
+        {}
+
+        template <class OtherKeyIterator, class OtherMappedIterator
+                 , class = std::enable_if_t
+                    <std::is_constructible<KeyIterator, OtherKeyIterator const &>{}
+                     && std::is_constructible<MappedIterator, OtherMappedIterator const &>{}>>
+        flat_map_iterator(flat_map_iterator<OtherKeyIterator, OtherMappedIterator> const & other)
+         : key_(other.key_)
+         , mapped_(other.mapped_)
+        {}
+
+        KeyIterator key_iterator() const
+        {
+            return this->key_;
+        }
+
+        MappedIterator mapped_iterator() const
+        {
+            return this->mapped_;
+        }
+
+        // Итератор
+        reference operator*() const
+        {
+            return reference(*this->key_, *this->mapped_);
+        }
+
+        pointer operator->() const
+        {
+            return pointer(**this);
+        }
+
+        flat_map_iterator & operator++()
+        {
+            ++ this->key_;
+            ++ this->mapped_;
+            return *this;
+        }
+
+        // Двусторонний итератор
+        flat_map_iterator & operator--()
+        {
+            -- this->key_;
+            -- this->mapped_;
+            return *this;
+        }
+
+        // Итератор произвольного доступа
+        flat_map_iterator & operator+=(difference_type num)
+        {
+            this->key_ += num;
+            this->mapped_ += num;
+            return *this;
+        }
+
+        flat_map_iterator & operator-=(difference_type num)
+        {
+            this->key_ -= num;
+            this->mapped_ -= num;
+            return *this;
+        }
+
+        reference operator[](difference_type num) const
+        {
+            return *(*this + num);
+        }
+
+        friend difference_type operator-(flat_map_iterator const & lhs
+                                        , flat_map_iterator const & rhs)
+        {
+            return lhs.key_ - rhs.key_;
+        }
+
+    private:
+        KeyIterator key_{};
+        MappedIterator mapped_{};
+    };
+
+    template <class Key, class T, class Compare = std::less<Key>
+             , class KeyContainer = std::vector<Key>, class MappedContainer = std::vector<T>>
+    class flat_map
+     : private Compare
+    {
+        static_assert(std::is_same<Key, typename KeyContainer::value_type>{});
+        static_assert(std::is_same<T, typename MappedContainer::value_type>{});
+
+    public:
+        // Типы
+        using key_type               = Key;
+        using mapped_type            = T;
+        using value_type             = std::pair<key_type, mapped_type>;
+        using key_compare            = Compare;
+        using reference              = std::pair<key_type const &, mapped_type &>;
+        using const_reference        = std::pair<key_type const &, mapped_type const &>;
+        using size_type              = std::size_t;
+        using difference_type        = std::ptrdiff_t;
+        using iterator               = flat_map_iterator<typename KeyContainer::const_iterator
+                                                        , typename MappedContainer::iterator>;
+        using const_iterator         = flat_map_iterator<typename KeyContainer::const_iterator
+                                                        , typename MappedContainer::const_iterator>;
+        using reverse_iterator       = saga::reverse_iterator<iterator>;
+        using const_reverse_iterator = saga::reverse_iterator<const_iterator>;
+        using key_container_type     = KeyContainer;
+        using mapped_container_type  = MappedContainer;
+
+        class value_compare
+        {
+            friend class flat_map;
+
+        public:
+            bool operator()(const_reference lhs, const_reference rhs) const
+            {
+                return this->cmp_(lhs.first, rhs.first);
+            }
+
+        private:
+            explicit value_compare(key_compare cmp)
+             : cmp_(std::move(cmp))
+            {}
+
+            key_compare cmp_;
+        };
+
+        struct containers
+        {
+            key_container_type keys;
+            mapped_container_type values;
+        };
+
+        // Создание, копирование, уничтожение
+        flat_map()
+         : flat_map(key_compare())
+        {}
+
+        explicit flat_map(key_compare cmp)
+         : Compare(std::move(cmp))
+         , c_()
+        {}
+
+        /** @brief Конструктор из контейнеров ключей и значений
+        @pre <tt>keys.size() == values.size()</tt>
+
+        Из нескольких элементов с эквивалентными ключами сохраняется первый.
+        */
+        flat_map(key_container_type keys, mapped_container_type values
+                , key_compare cmp = key_compare())
+         : Compare(std::move(cmp))
+         , c_{std::move(keys), std::move(values)}
+        {
+            assert(this->c_.keys.size() == this->c_.values.size());
+
+            this->merge_private(0, this->sorted_unique_order_private(0));
+        }
+
+        /** @brief Конструктор из упорядоченного контейнера ключей и контейнера значений
+        @pre <tt>keys.size() == values.size()</tt>
+        @pre @c keys упорядочен по @c cmp и не содержит эквивалентных элементов
+        */
+        flat_map(sorted_unique_t, key_container_type keys, mapped_container_type values
+                , key_compare cmp = key_compare())
+         : Compare(std::move(cmp))
+         , c_{std::move(keys), std::move(values)}
+        {
+            assert(this->c_.keys.size() == this->c_.values.size());
+            assert(this->is_sorted_unique_private(0));
+        }
+
+        template <class InputIterator>
+        flat_map(InputIterator first, InputIterator last, key_compare cmp = key_compare())
+         : flat_map(std::move(cmp))
+        {
+            this->insert(std::move(first), std::move(last));
+        }
+
+        template <class InputIterator>
+        flat_map(sorted_unique_t, InputIterator first, InputIterator last
+                , key_compare cmp = key_compare())
+         : flat_map(std::move(cmp))
+        {
+            this->insert(sorted_unique, std::move(first), std::move(last));
+        }
+
+        flat_map(std::initializer_list<value_type> values, key_compare cmp = key_compare())
+         : flat_map(values.begin(), values.end(), std::move(cmp))
+        {}
+
+        // Итераторы
+        iterator begin() noexcept
+        {
+            return iterator(this->c_.keys.cbegin(), this->c_.values.begin());
+        }
+
+        const_iterator begin() const noexcept
+        {
+            return const_iterator(this->c_.keys.cbegin(), this->c_.values.cbegin());
+        }
+
+        iterator end() noexcept
+        {
+            return iterator(this->c_.keys.cend(), this->c_.values.end());
+        }
+
+        const_iterator end() const noexcept
+        {
+            return const_iterator(this->c_.keys.cend(), this->c_.values.cend());
+        }
+
+        const_iterator cbegin() const noexcept
+        {
+            return this->begin();
+        }
+
+        const_iterator cend() const noexcept
+        {
+            return this->end();
+        }
+
+        reverse_iterator rbegin() noexcept
+        {
+            return reverse_iterator(this->end());
+        }
+
+        const_reverse_iterator rbegin() const noexcept
+        {
+            return const_reverse_iterator(this->end());
+        }
+
+        reverse_iterator rend() noexcept
+        {
+            return reverse_iterator(this->begin());
+        }
+
+        const_reverse_iterator rend() const noexcept
+        {
+            return const_reverse_iterator(this->begin());
+        }
+
+        const_reverse_iterator crbegin() const noexcept
+        {
+            return this->rbegin();
+        }
+
+        const_reverse_iterator crend() const noexcept
+        {
+            return this->rend();
+        }
+
+        // Размер и ёмкость
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return this->c_.keys.empty();
+        }
+
+        size_type size() const noexcept
+        {
+            return this->c_.keys.size();
+        }
+
+        size_type max_size() const noexcept
+        {
+            return std::min<size_type>(this->c_.keys.max_size(), this->c_.values.max_size());
+        }
+
+        // Доступ к элементам
+        mapped_type & operator[](key_type const & key)
+        {
+            return this->try_emplace(key).first->second;
+        }
+
+        mapped_type & operator[](key_type && key)
+        {
+            return this->try_emplace(std::move(key)).first->second;
+        }
+
+        mapped_type & at(key_type const & key)
+        {
+            auto const index = this->find_index_private(key);
+
+            if(index == this->size())
+            {
+                throw std::out_of_range("saga::flat_map::at");
+            }
+
+            return this->c_.values[index];
+        }
+
+        mapped_type const & at(key_type const & key) const
+        {
+            auto const index = this->find_index_private(key);
+
+            if(index == this->size())
+            {
+                throw std::out_of_range("saga::flat_map::at");
+            }
+
+            return this->c_.values[index];
+        }
+
+        // Модифицирующие операции
+        template <class... Args>
+        std::pair<iterator, bool> emplace(Args &&... args)
+        {
+            value_type value(std::forward<Args>(args)...);
+
+            return this->try_emplace(std::move(value.first), std::move(value.second));
+        }
+
+        std::pair<iterator, bool> insert(value_type const & value)
+        {
+            return this->try_emplace(value.first, value.second);
+        }
+
+        std::pair<iterator, bool> insert(value_type && value)
+        {
+            return this->try_emplace(std::move(value.first), std::move(value.second));
+        }
+
+        /** @brief Вставка элементов интервала <tt>[first, last)</tt>
+
+        Упорядочиваются только новые элементы, после чего они сливаются с имеющимися с конца
+        контейнеров, отбрасывая элементы с ключами, которые уже есть. Вставка m элементов в
+        отображение из n элементов требует O(n + m log m) операций.
+        */
+        template <class InputIterator>
+        void insert(InputIterator first, InputIterator last)
+        {
+            auto const old_size = this->size();
+
+            this->append_private(std::move(first), std::move(last));
+
+            this->merge_private(old_size, this->sorted_unique_order_private(old_size));
+        }
+
+        /** @brief Вставка элементов интервала <tt>[first, last)</tt>, упорядоченного по ключам
+        @pre Ключи элементов интервала упорядочены по key_comp() и среди них нет эквивалентных
+
+        Вставка m элементов в отображение из n элементов требует O(n + m) операций.
+        */
+        template <class InputIterator>
+        void insert(sorted_unique_t, InputIterator first, InputIterator last)
+        {
+            auto const old_size = this->size();
+
+            this->append_private(std::move(first), std::move(last));
+
+            assert(this->is_sorted_unique_private(old_size));
+
+            auto order = this->make_order_private(this->size() - old_size);
+
+            this->merge_private(old_size, order);
+        }
+
+        void insert(std::initializer_list<value_type> values)
+        {
+            this->insert(values.begin(), values.end());
+        }
+
+        template <class... Args>
+        std::pair<iterator, bool> try_emplace(key_type const & key, Args &&... args)
+        {
+            return this->try_emplace_private(key, std::forward<Args>(args)...);
+        }
+
+        template <class... Args>
+        std::pair<iterator, bool> try_emplace(key_type && key, Args &&... args)
+        {
+            return this->try_emplace_private(std::move(key), std::forward<Args>(args)...);
+        }
+
+        template <class M>
+        std::pair<iterator, bool> insert_or_assign(key_type const & key, M && obj)
+        {
+            auto result = this->try_emplace(key, std::forward<M>(obj));
+
+            if(!result.second)
+            {
+                result.first->second = std::forward<M>(obj);
+            }
+
+            return result;
+        }
+
+        template <class M>
+        std::pair<iterator, bool> insert_or_assign(key_type && key, M && obj)
+        {
+            auto result = this->try_emplace(std::move(key), std::forward<M>(obj));
+
+            if(!result.second)
+            {
+                result.first->second = std::forward<M>(obj);
+            }
+
+            return result;
+        }
+
+        /// @brief Извлечение контейнеров ключей и значений, после которого отображение пусто
+        containers extract() &&
+        {
+            auto result = std::move(this->c_);
+            this->clear();
+
+            return result;
+        }
+
+        /** @brief Замена контейнеров ключей и значений
+        @pre <tt>keys.size() == values.size()</tt>
+        @pre @c keys упорядочен по key_comp() и не содержит эквивалентных элементов
+        */
+        void replace(key_container_type && keys, mapped_container_type && values)
+        {
+            this->c_.keys = std::move(keys);
+            this->c_.values = std::move(values);
+
+            assert(this->c_.keys.size() == this->c_.values.size());
+            assert(this->is_sorted_unique_private(0));
+        }
+
+        iterator erase(iterator pos)
+        {
+            return this->erase(const_iterator(pos));
+        }
+
+        iterator erase(const_iterator pos)
+        {
+            auto const index = pos - this->cbegin();
+
+            this->c_.keys.erase(pos.key_iterator());
+            this->c_.values.erase(pos.mapped_iterator());
+
+            return this->begin() + index;
+        }
+
+        iterator erase(const_iterator first, const_iterator last)
+        {
+            auto const index = first - this->cbegin();
+
+            this->c_.keys.erase(first.key_iterator(), last.key_iterator());
+            this->c_.values.erase(first.mapped_iterator(), last.mapped_iterator());
+
+            return this->begin() + index;
+        }
+
+        size_type erase(key_type const & key)
+        {
+            auto const index = this->find_index_private(key);
+
+            if(index == this->size())
+            {
+                return 0;
+            }
+
+            this->erase(this->cbegin() + static_cast<difference_type>(index));
+
+            return 1;
+        }
+
+        void swap(flat_map & other) noexcept
+        {
+            using std::swap;
+
+            swap(this->cmp_ref(), other.cmp_ref());
+            swap(this->c_.keys, other.c_.keys);
+            swap(this->c_.values, other.c_.values);
+        }
+
+        void clear() noexcept
+        {
+            this->c_.keys.clear();
+            this->c_.values.clear();
+        }
+
+        // Немодифицирующие операции
+        key_compare key_comp() const
+        {
+            return this->cmp_ref();
+        }
+
+        value_compare value_comp() const
+        {
+            return value_compare(this->key_comp());
+        }
+
+        key_container_type const & keys() const noexcept
+        {
+            return this->c_.keys;
+        }
+
+        mapped_container_type const & values() const noexcept
+        {
+            return this->c_.values;
+        }
+
+        // Операции отображения
+        iterator find(key_type const & key)
+        {
+            return this->begin() + static_cast<difference_type>(this->find_index_private(key));
+        }
+
+        const_iterator find(key_type const & key) const
+        {
+            return this->begin() + static_cast<difference_type>(this->find_index_private(key));
+        }
+
+        size_type count(key_type const & key) const
+        {
+            return this->contains(key) ? 1 : 0;
+        }
+
+        bool contains(key_type const & key) const
+        {
+            return this->find_index_private(key) != this->size();
+        }
+
+        iterator lower_bound(key_type const & key)
+        {
+            return this->begin() + this->lower_bound_private(key);
+        }
+
+        const_iterator lower_bound(key_type const & key) const
+        {
+            return this->begin() + this->lower_bound_private(key);
+        }
+
+        iterator upper_bound(key_type const & key)
+        {
+            return this->begin() + this->upper_bound_private(key);
+        }
+
+        const_iterator upper_bound(key_type const & key) const
+        {
+            return this->begin() + this->upper_bound_private(key);
+        }
+
+        std::pair<iterator, iterator> equal_range(key_type const & key)
+        {
+            return {this->lower_bound(key), this->upper_bound(key)};
+        }
+
+        std::pair<const_iterator, const_iterator> equal_range(key_type const & key) const
+        {
+            return {this->lower_bound(key), this->upper_bound(key)};
+        }
+
+        // Сравнение
+        friend bool operator==(flat_map const & lhs, flat_map const & rhs)
+        {
+            return saga::equal(saga::cursor::all(lhs.keys()), saga::cursor::all(rhs.keys()))
+                   && saga::equal(saga::cursor::all(lhs.values()), saga::cursor::all(rhs.values()));
+        }
+
+        friend bool operator<(flat_map const & lhs, flat_map const & rhs)
+        {
+            return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+        }
+
+        friend bool operator!=(flat_map const & lhs, flat_map const & rhs)
+        {
+            return !(lhs == rhs);
+        }
+
+        friend bool operator>(flat_map const & lhs, flat_map const & rhs)
+        {
+            return rhs < lhs;
+        }
+
+        friend bool operator<=(flat_map const & lhs, flat_map const & rhs)
+        {
+            return !(rhs < lhs);
+        }
+
+        friend bool operator>=(flat_map const & lhs, flat_map const & rhs)
+        {
+            return !(lhs < rhs);
+        }
+
+        friend void swap(flat_map & lhs, flat_map & rhs) noexcept
+        {
+            lhs.swap(rhs);
+        }
+
+    private:
+        using order_allocator = typename std::allocator_traits<
+            typename key_container_type::allocator_type>::template rebind_alloc<size_type>;
+
+        // Перестановка индексов новых элементов
+        using order_container = std::vector<size_type, order_allocator>;
+
+        key_compare const & cmp_ref() const
+        {
+            return *this;
+        }
+
+        key_compare & cmp_ref()
+        {
+            return *this;
+        }
+
+        difference_type lower_bound_private(key_type const & key) const
+        {
+            auto const & keys = this->c_.keys;
+
+            auto const pos
+                = saga::lower_bound(saga::cursor::all(keys), key, std::ref(this->cmp_ref()));
+
+            return pos.begin() - keys.begin();
+        }
+
+        difference_type upper_bound_private(key_type const & key) const
+        {
+            auto const & keys = this->c_.keys;
+
+            auto const pos
+                = saga::upper_bound(saga::cursor::all(keys), key, std::ref(this->cmp_ref()));
+
+            return pos.begin() - keys.begin();
+        }
+
+        /// @return Индекс элемента с ключом, эквивалентным @c key, или size(), если такого нет
+        size_type find_index_private(key_type const & key) const
+        {
+            auto const index = static_cast<size_type>(this->lower_bound_private(key));
+
+            if(index == this->size() || this->cmp_ref()(key, this->c_.keys[index]))
+            {
+                return this->size();
+            }
+
+            return index;
+        }
+
+        template <class K, class... Args>
+        std::pair<iterator, bool> try_emplace_private(K && key, Args &&... args)
+        {
+            auto const index = this->lower_bound_private(key);
+            auto const pos = this->begin() + index;
+
+            if(pos != this->end() && !this->cmp_ref()(key, pos->first))
+            {
+                return {pos, false};
+            }
+
+            this->c_.keys.insert(pos.key_iterator(), std::forward<K>(key));
+
+            try
+            {
+                this->c_.values.emplace(pos.mapped_iterator(), std::forward<Args>(args)...);
+            }
+            catch(...)
+            {
+                this->c_.keys.erase(this->c_.keys.begin() + index);
+                throw;
+            }
+
+            return {this->begin() + index, true};
+        }
+
+        template <class InputIterator>
+        void append_private(InputIterator first, InputIterator last)
+        {
+            for(; first != last; ++first)
+            {
+                auto && value = *first;
+
+                this->c_.keys.push_back(std::get<0>(std::forward<decltype(value)>(value)));
+                this->c_.values.push_back(std::get<1>(std::forward<decltype(value)>(value)));
+            }
+        }
+
+        bool is_sorted_unique_private(size_type first) const
+        {
+            // Строгое возрастание: ни один ключ не больше и не эквивалентен следующему
+            auto const & keys = this->c_.keys;
+
+            return saga::is_sorted(saga::make_subrange_cursor(keys.begin() + first, keys.end()
+                                                             , unsafe_tag_t{})
+                                   , [this](key_type const & lhs, key_type const & rhs)
+                                     { return !this->cmp_ref()(rhs, lhs); });
+        }
+
+        /** @brief Порядок элементов <tt>[first, size())</tt> по возрастанию ключей без
+        эквивалентных
+        @return Индексы относительно @c first; из эквивалентных элементов остаётся первый
+        */
+        /** @brief Тождественная перестановка индексов <tt>[0, num)</tt>
+
+        Память выделяется распределителем контейнера ключей.
+        */
+        order_container make_order_private(size_type num) const
+        {
+            order_container order(num, size_type(0), this->c_.keys.get_allocator());
+            std::iota(order.begin(), order.end(), size_type(0));
+
+            return order;
+        }
+
+        order_container sorted_unique_order_private(size_type first) const
+        {
+            auto order = this->make_order_private(this->size() - first);
+
+            auto const keys = this->c_.keys.begin() + static_cast<difference_type>(first);
+            auto const & cmp = this->cmp_ref();
+
+            auto const index_less = [keys, &cmp](size_type lhs, size_type rhs)
+            {
+                return cmp(keys[lhs], keys[rhs]) || (!cmp(keys[rhs], keys[lhs]) && lhs < rhs);
+            };
+
+            // После сортировки ключи эквивалентны, если предыдущий не меньше следующего
+            auto const index_equiv = [keys, &cmp](size_type lhs, size_type rhs)
+            {
+                return !cmp(keys[lhs], keys[rhs]);
+            };
+
+            order |= saga::action::sort(index_less) | saga::action::unique(index_equiv);
+
+            return order;
+        }
+
+        /** @brief Слияние упорядоченной части <tt>[0, old_size)</tt> с новыми элементами
+        <tt>[old_size, size())</tt>, взятыми в порядке @c order
+
+        Новые элементы переносятся во временные буферы, а освободившиеся места в конце контейнеров
+        заполняются с конца: на каждом шаге переносится элемент с наибольшим ключом. Новые
+        элементы с ключами, которые уже есть, отбрасываются, и образовавшийся промежуток удаляется.
+        */
+        void merge_private(size_type old_size, order_container const & order)
+        {
+            auto & keys = this->c_.keys;
+            auto & values = this->c_.values;
+
+            auto const in_order = [&order]
+            {
+                for(auto index = size_type(0); index < order.size(); ++index)
+                {
+                    if(order[index] != index)
+                    {
+                        return false;
+                    }
+                }
+
+                return true;
+            };
+
+            auto const new_size = old_size + order.size();
+
+            if(new_size == this->size() && in_order()
+               && (old_size == 0 || new_size == old_size
+                   || this->cmp_ref()(keys[old_size - 1], keys[old_size])))
+            {
+                return;
+            }
+
+            key_container_type new_keys(keys.get_allocator());
+            mapped_container_type new_values(values.get_allocator());
+            saga::reserve_if_supported(new_keys, order.size());
+            saga::reserve_if_supported(new_values, order.size());
+
+            for(auto const & index : order)
+            {
+                new_keys.push_back(std::move(keys[old_size + index]));
+                new_values.push_back(std::move(values[old_size + index]));
+            }
+
+            keys.erase(keys.begin() + static_cast<difference_type>(new_size), keys.end());
+            values.erase(values.begin() + static_cast<difference_type>(new_size), values.end());
+
+            auto out = new_size;
+            auto old_pos = old_size;
+            auto new_pos = order.size();
+
+            // out - old_pos >= new_pos, поэтому элементы не перекрываются
+            for(; new_pos > 0 && old_pos > 0;)
+            {
+                auto const & old_back = keys[old_pos - 1];
+                auto const & new_back = new_keys[new_pos - 1];
+
+                --out;
+
+                if(this->cmp_ref()(old_back, new_back))
+                {
+                    --new_pos;
+                    keys[out] = std::move(new_keys[new_pos]);
+                    values[out] = std::move(new_values[new_pos]);
+                }
+                else
+                {
+                    if(!this->cmp_ref()(new_back, old_back))
+                    {
+                        --new_pos;
+                    }
+
+                    --old_pos;
+                    keys[out] = std::move(keys[old_pos]);
+                    values[out] = std::move(values[old_pos]);
+                }
+            }
+
+            for(; new_pos > 0;)
+            {
+                --out;
+                --new_pos;
+                keys[out] = std::move(new_keys[new_pos]);
+                values[out] = std::move(new_values[new_pos]);
+            }
+
+            auto const gap_first = static_cast<difference_type>(old_pos);
+            auto const gap_last = static_cast<difference_type>(out);
+
+            keys.erase(keys.begin() + gap_first, keys.begin() + gap_last);
+            values.erase(values.begin() + gap_first, values.begin() + gap_last);
+        }
+
+        containers c_;
+    };
+}
+// namespace saga
+
+#endif
+// Z_SAGA_FLAT_MAP_HPP_INCLUDED
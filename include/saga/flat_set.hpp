@@ -36,8 +36,23 @@ SAGA -- это свободной программное обеспечение:
 #include <saga/cursor/subrange.hpp>
 #include <saga/iterator/reverse.hpp>
 
+#include <algorithm>
+#include <cassert>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <vector>
+
 namespace saga
 {
+    /// @brief Тип тега, означающего, что интервал упорядочен и не содержит эквивалентных элементов
+    struct sorted_unique_t
+    {
+        explicit sorted_unique_t() = default;
+    };
+
+    inline constexpr sorted_unique_t sorted_unique{};
+
     // @todo Проверить, что итераторы с произвольным доступом
     // @todo Проверить требования к обратимым контейнерам ([container.rev.reqmts])
     // @todo Проверить дополнительные требования к контейнерам ([container.opt.reqmts]).
@@ -49,10 +64,8 @@ namespace saga
     // @todo При исключении интервал должен быть восстановлен, даже если придётся опустошить
     // @todo Аудит в функциях, использующих sorted_unique
 
-    // @todo sorted_unique_t и sorted_unique
     // @todo Возможность задавать key_container
     // @todo erase_if(flat_set, Pred)
-    // @todo Специализация uses_allocator
 
     // @todo Выразить как можно больше функций через CRTP (особенно те, в которых нет доступа к private)
     template <class Key, class Compare = std::less<Key>, class KeyContainer = std::vector<Key>>
@@ -61,6 +74,10 @@ namespace saga
     {
         static_assert(std::is_same<Key, typename KeyContainer::value_type>{});
 
+        template <class Allocator>
+        using require_allocator
+            = std::enable_if_t<std::uses_allocator<KeyContainer, Allocator>{}>;
+
     public:
         // Типы
         using key_type               = Key;
@@ -99,8 +116,28 @@ namespace saga
          , data_()
         {}
 
-        // @todo Конструктор с функцией сравнения и распределителем памяти
-        // @todo Конструктор с распределителем памяти
+        template <class Allocator, class = require_allocator<Allocator>>
+        flat_set(key_compare cmp, Allocator const & alloc)
+         : Compare(std::move(cmp))
+         , data_(alloc)
+        {}
+
+        template <class Allocator, class = require_allocator<Allocator>>
+        explicit flat_set(Allocator const & alloc)
+         : flat_set(key_compare(), alloc)
+        {}
+
+        template <class Allocator, class = require_allocator<Allocator>>
+        flat_set(flat_set const & other, Allocator const & alloc)
+         : Compare(other.cmp_ref())
+         , data_(other.data_, alloc)
+        {}
+
+        template <class Allocator, class = require_allocator<Allocator>>
+        flat_set(flat_set && other, Allocator const & alloc)
+         : Compare(std::move(other.cmp_ref()))
+         , data_(std::move(other.data_), alloc)
+        {}
 
         // @todo Конструктор из пары итераторов и, возможно, функции сравнения
 
@@ -111,10 +148,7 @@ namespace saga
          // @todo использовать std::make_obj_using_allocator<container_type>(alloc) из C++ 20
          , data_(alloc)
         {
-            // @todo Должно быть this->insert(std::move(first), std::move(last)); вместо всего кода
-            this->data_.insert(this->data_.end(), std::move(first), std::move(last));
-
-            this->unique_private();
+            this->insert(std::move(first), std::move(last));
         }
 
         // @todo Конструктор из пары итераторов и распределителя памяти
@@ -228,6 +262,53 @@ namespace saga
             }
         }
 
+        /** @brief Вставка элементов интервала <tt>[first, last)</tt>
+
+        Упорядочиваются только новые элементы, после чего они сливаются с имеющимися с конца
+        контейнера, отбрасывая эквивалентные. Вставка m элементов в множество из n элементов
+        требует O(n + m log m) операций. Из нескольких эквивалентных элементов сохраняется уже
+        имеющийся в множестве, а среди новых -- какой-то один из них.
+        */
+        template <class InputIterator>
+        void insert(InputIterator first, InputIterator last)
+        {
+            auto const old_size = this->data_.size();
+
+            this->data_.insert(this->data_.end(), std::move(first), std::move(last));
+
+            auto const batch = saga::make_subrange_cursor(this->data_.begin() + old_size
+                                                         , this->data_.end(), unsafe_tag_t{});
+
+            saga::sort(batch, std::ref(this->cmp_ref()));
+
+            auto const to_erase = saga::unique(batch, this->equiv_private());
+            this->data_.erase(to_erase.begin(), to_erase.end());
+
+            this->merge_private(old_size);
+        }
+
+        /** @brief Вставка элементов упорядоченного интервала <tt>[first, last)</tt>
+        @pre Интервал <tt>[first, last)</tt> упорядочен по key_comp() и не содержит эквивалентных
+        элементов
+
+        Вставка m элементов в множество из n элементов требует O(n + m) операций.
+        */
+        template <class InputIterator>
+        void insert(sorted_unique_t, InputIterator first, InputIterator last)
+        {
+            auto const old_size = this->data_.size();
+
+            this->data_.insert(this->data_.end(), std::move(first), std::move(last));
+
+            // Строгое возрастание: ни один элемент не больше и не эквивалентен следующему
+            assert(saga::is_sorted(saga::make_subrange_cursor(this->data_.begin() + old_size
+                                                             , this->data_.end(), unsafe_tag_t{})
+                                   , [this](const_reference lhs, const_reference rhs)
+                                     { return !this->cmp_ref()(rhs, lhs); }));
+
+            this->merge_private(old_size);
+        }
+
         void swap(flat_set & other) noexcept
         {
             using std::swap;
@@ -254,6 +335,69 @@ namespace saga
                                      , key, std::ref(this->cmp_ref())).begin();
         }
 
+        // Теоретико-множественные операции
+        /** @brief Проверка того, что каждый элемент @c other эквивалентен некоторому элементу
+        данного множества
+
+        Требует O(m log(n/m)) сравнений, где m -- размер @c other, n -- размер данного множества.
+        */
+        bool includes(flat_set const & other) const
+        {
+            return saga::includes_adaptive(saga::cursor::all(this->data_)
+                                          , saga::cursor::all(other.data_)
+                                          , std::ref(this->cmp_ref()));
+        }
+
+        /** @brief Добавление элементов @c other, которым нет эквивалентных в данном множестве
+
+        Серии элементов, между которыми нет элементов другого множества, находятся
+        экспоненциальным поиском и копируются целиком.
+        */
+        void unite(flat_set const & other)
+        {
+            KeyContainer result(this->data_.get_allocator());
+
+            saga::set_union_adaptive(saga::cursor::all(this->data_)
+                                    , saga::cursor::all(other.data_)
+                                    , saga::back_inserter(result)
+                                    , std::ref(this->cmp_ref()));
+
+            this->data_.swap(result);
+        }
+
+        /** @brief Удаление элементов, которым нет эквивалентных в @c other
+
+        Требует O(m log(n/m)) сравнений, где m и n -- размеры меньшего и большего из множеств.
+        */
+        void intersect(flat_set const & other)
+        {
+            KeyContainer result(this->data_.get_allocator());
+
+            saga::set_intersection_adaptive(saga::cursor::all(this->data_)
+                                           , saga::cursor::all(other.data_)
+                                           , saga::back_inserter(result)
+                                           , std::ref(this->cmp_ref()));
+
+            this->data_.swap(result);
+        }
+
+        /** @brief Удаление элементов, эквивалентных элементам @c other
+
+        Элементы @c other, между которыми нет элементов данного множества, пропускаются
+        экспоненциальным поиском.
+        */
+        void subtract(flat_set const & other)
+        {
+            KeyContainer result(this->data_.get_allocator());
+
+            saga::set_difference_adaptive(saga::cursor::all(this->data_)
+                                         , saga::cursor::all(other.data_)
+                                         , saga::back_inserter(result)
+                                         , std::ref(this->cmp_ref()));
+
+            this->data_.swap(result);
+        }
+
         friend bool operator==(flat_set const & lhs, flat_set const & rhs)
         {
             return saga::equal(saga::cursor::all(lhs), saga::cursor::all(rhs));
@@ -301,15 +445,71 @@ namespace saga
             return *this;
         }
 
-        void unique_private()
+        auto equiv_private() const
         {
             // @todo Оптимизация: мы знаем, что вторая часть конъюнкции всегда истина после sort
-            auto equiv = [&](const_reference lhs, const_reference rhs)
+            return [this](const_reference lhs, const_reference rhs)
             {
                 return !this->cmp_ref()(lhs, rhs) && !this->cmp_ref()(rhs, lhs);
             };
+        }
 
-            this->data_ |= saga::action::sort(this->cmp_ref()) | saga::action::unique(equiv);
+        void unique_private()
+        {
+            this->data_ |= saga::action::sort(this->cmp_ref())
+                         | saga::action::unique(this->equiv_private());
+        }
+
+        /** @brief Слияние упорядоченных частей <tt>[0, old_size)</tt> и <tt>[old_size, size())</tt>
+        с удалением из второй части элементов, эквивалентных элементам первой
+
+        Новые элементы переносятся во временный буфер, а освободившиеся места в конце контейнера
+        заполняются с конца: на каждом шаге переносится больший из последних элементов. В конце
+        удаляется промежуток, образовавшийся из-за отброшенных эквивалентных элементов.
+        */
+        void merge_private(size_type old_size)
+        {
+            auto const first = this->data_.begin();
+            auto const middle = first + old_size;
+
+            if(old_size == 0 || middle == this->data_.end()
+               || this->cmp_ref()(*std::prev(middle), *middle))
+            {
+                return;
+            }
+
+            KeyContainer batch(this->data_.get_allocator());
+            batch.insert(batch.end(), std::make_move_iterator(middle)
+                        , std::make_move_iterator(this->data_.end()));
+
+            auto out = this->data_.end();
+            auto old_pos = middle;
+            auto new_pos = batch.end();
+
+            // out - old_pos >= new_pos - batch.begin(), поэтому элементы не перекрываются
+            for(; new_pos != batch.begin() && old_pos != first;)
+            {
+                auto const & old_back = *std::prev(old_pos);
+                auto const & new_back = *std::prev(new_pos);
+
+                if(this->cmp_ref()(old_back, new_back))
+                {
+                    *--out = std::move(*--new_pos);
+                }
+                else
+                {
+                    if(!this->cmp_ref()(new_back, old_back))
+                    {
+                        --new_pos;
+                    }
+
+                    *--out = std::move(*--old_pos);
+                }
+            }
+
+            out = std::move_backward(batch.begin(), new_pos, out);
+
+            this->data_.erase(old_pos, out);
         }
 
         KeyContainer data_;
@@ -317,5 +517,15 @@ namespace saga
 }
 // namespace saga
 
+namespace std
+{
+    /// @brief flat_set использует распределитель памяти, если его использует KeyContainer
+    template <class Key, class Compare, class KeyContainer, class Allocator>
+    struct uses_allocator<saga::flat_set<Key, Compare, KeyContainer>, Allocator>
+     : std::uses_allocator<KeyContainer, Allocator>
+    {};
+}
+// namespace std
+
 #endif
 // Z_SAGA_FLAT_SET_HPP_INCLUDED
@@ -27,12 +27,98 @@ SAGA -- это свободной программное обеспечение:
 
 #include <cassert>
 #include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
 
 namespace saga
 {
     template <class T>
     using iterator_category_t = typename std::iterator_traits<T>::iterator_category;
 
+    template <class T>
+    using iter_value_t = typename std::iterator_traits<T>::value_type;
+
+    // Непрерывные итераторы
+    namespace detail
+    {
+        template <class Value>
+        using is_vector_element_arithmetic
+            = std::bool_constant<std::is_arithmetic<Value>{} && !std::is_same<Value, bool>{}>;
+
+        template <class Iterator, class Value, class SFINAE = void>
+        struct is_known_contiguous_iterator
+         : std::false_type
+        {};
+
+        template <class Iterator, class Value>
+        struct is_known_contiguous_iterator<Iterator, Value
+                                           , std::enable_if_t<is_vector_element_arithmetic<Value>{}>>
+         : std::bool_constant<std::is_same<Iterator, typename std::vector<Value>::iterator>{}
+                              || std::is_same<Iterator
+                                             , typename std::vector<Value>::const_iterator>{}
+                              || std::is_same<Iterator, std::string::iterator>{}
+                              || std::is_same<Iterator, std::string::const_iterator>{}>
+        {};
+    }
+    // namespace detail
+
+    /** @brief Проверка того, что итератор ссылается на элементы, расположенные в памяти подряд
+
+    Указатели на объекты всегда считаются непрерывными итераторами. Если доступна концепция
+    @c std::contiguous_iterator, то используется она. Иначе распознаются только итераторы
+    @c std::vector и @c std::string, элементы которых имеют арифметический тип.
+    */
+    template <class Iterator, class SFINAE = void>
+    struct is_contiguous_iterator
+     : std::false_type
+    {};
+
+    template <class T>
+    struct is_contiguous_iterator<T *>
+     : std::is_object<T>
+    {};
+
+#if defined(__cpp_lib_concepts) && __cpp_lib_concepts >= 202002L
+    template <class Iterator>
+    struct is_contiguous_iterator<Iterator, std::enable_if_t<!std::is_pointer<Iterator>{}>>
+     : std::bool_constant<std::contiguous_iterator<Iterator>>
+    {};
+#else
+    template <class Iterator>
+    struct is_contiguous_iterator<Iterator
+                                 , std::enable_if_t<!std::is_pointer<Iterator>{}
+                                                   , std::void_t<iter_value_t<Iterator>>>>
+     : detail::is_known_contiguous_iterator<Iterator, iter_value_t<Iterator>>
+    {};
+#endif
+// defined(__cpp_lib_concepts) && __cpp_lib_concepts >= 202002L
+
+    /** @brief Адрес элемента, на который ссылается непрерывный итератор
+    @pre @c is_contiguous_iterator<Iterator>
+    @pre Если std::to_address недоступна, то @c pos можно разыменовать: адрес вычисляется как
+    <tt>std::addressof(*pos)</tt>, поэтому итератор, указывающий за последний элемент,
+    использовать нельзя
+    */
+    template <class T>
+    constexpr T * to_address(T * ptr) noexcept
+    {
+        static_assert(!std::is_function<T>{});
+
+        return ptr;
+    }
+
+    template <class Iterator>
+    constexpr auto to_address(Iterator const & pos) noexcept
+    {
+#if defined(__cpp_lib_to_address) && __cpp_lib_to_address >= 201711L
+        return std::to_address(pos);
+#else
+        return std::addressof(*pos);
+#endif
+// defined(__cpp_lib_to_address) && __cpp_lib_to_address >= 201711L
+    }
+
     namespace detail
     {
         template <class T, bool to_object>
@@ -162,9 +162,22 @@ namespace saga
             return *tmp;
         }
 
+        /** @brief Как в C++20, использует оператор -> базового итератора, что позволяет работать
+        с итераторами, возвращающими прокси-объекты
+        */
         constexpr pointer operator->() const
         {
-            return std::addressof(**this);
+            auto tmp = this->current_;
+            -- tmp;
+
+            if constexpr(std::is_pointer<Iterator>{})
+            {
+                return tmp;
+            }
+            else
+            {
+                return tmp.operator->();
+            }
         }
 
         constexpr reverse_iterator & operator++()
@@ -263,11 +263,19 @@ namespace saga
         {
             assert(factor != 0);
 
-            if(num == 0 || factor == 1 || factor == -1)
+            if(num == 0 || factor == 1)
             {
                 return {num, 0};
             }
 
+            if constexpr (std::is_signed<IntType>{})
+            {
+                if(factor == -1)
+                {
+                    return {num, 0};
+                }
+            }
+
             auto multiplicity = IntType(0);
 
             for(; num % factor == 0;)
@@ -0,0 +1,230 @@
+/* (c) 2026 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки SAGA.
+
+SAGA -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#ifndef Z_SAGA_MEMORY_ARENA_RESOURCE_HPP_INCLUDED
+#define Z_SAGA_MEMORY_ARENA_RESOURCE_HPP_INCLUDED
+
+/** @file saga/memory/arena_resource.hpp
+ @brief Монотонный ресурс памяти (арена), сохраняющий выделенные блоки при сбросе
+
+ В отличие от std::pmr::monotonic_buffer_resource, метод reset не возвращает блоки вышестоящему
+ ресурсу, а только делает их снова свободными. Поэтому вычисления, повторяющиеся на каждой итерации
+ (поколение генетического алгоритма, обработка очередного пакета), после первой итерации вообще не
+ обращаются к общей куче. Ресурс не синхронизирован: предполагается, что у каждого потока своя
+ арена.
+*/
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+
+namespace saga
+{
+    class arena_resource
+     : public std::pmr::memory_resource
+    {
+    public:
+        // Типы
+        using size_type = std::size_t;
+
+        /// @brief Размер первого блока, используемый по умолчанию
+        static constexpr size_type default_initial_size = 4096;
+
+        // Создание, копирование, уничтожение
+        arena_resource() noexcept
+         : arena_resource(default_initial_size)
+        {}
+
+        /** @brief Арена, запрашивающая память у @c upstream
+        @param initial_size размер первого блока, последующие блоки увеличиваются вдвое
+        */
+        explicit arena_resource(size_type initial_size
+                               , std::pmr::memory_resource * upstream
+                                   = std::pmr::get_default_resource()) noexcept
+         : upstream_(upstream)
+         , next_size_(std::max(initial_size, sizeof(chunk_header) + alignof(std::max_align_t)))
+        {
+            assert(upstream != nullptr);
+        }
+
+        arena_resource(arena_resource const &) = delete;
+        arena_resource & operator=(arena_resource const &) = delete;
+
+        ~arena_resource() override
+        {
+            this->release();
+        }
+
+        // Управление памятью
+        /** @brief Делает всю память арены снова свободной, сохраняя блоки
+        @details Ранее выделенные из арены объекты должны быть уничтожены до вызова
+        */
+        void reset() noexcept
+        {
+            this->current_ = this->first_;
+            this->used_ = 0;
+
+            if(this->current_ != nullptr)
+            {
+                this->position_ = this->current_->begin();
+            }
+        }
+
+        /// @brief Возвращает все блоки вышестоящему ресурсу
+        void release() noexcept
+        {
+            for(auto * chunk = this->first_; chunk != nullptr;)
+            {
+                auto * const next = chunk->next;
+
+                this->upstream_->deallocate(chunk, chunk->size, alignof(chunk_header));
+
+                chunk = next;
+            }
+
+            this->first_ = nullptr;
+            this->current_ = nullptr;
+            this->position_ = nullptr;
+            this->used_ = 0;
+            this->capacity_ = 0;
+        }
+
+        // Свойства
+        std::pmr::memory_resource * upstream_resource() const noexcept
+        {
+            return this->upstream_;
+        }
+
+        /// @brief Количество байтов, выделенных с последнего сброса, с учётом выравнивания
+        size_type used() const noexcept
+        {
+            return this->used_;
+        }
+
+        /// @brief Суммарный размер блоков, полученных от вышестоящего ресурса
+        size_type capacity() const noexcept
+        {
+            return this->capacity_;
+        }
+
+    private:
+        struct alignas(std::max_align_t) chunk_header
+        {
+            chunk_header * next;
+            size_type size;
+
+            std::byte * begin() noexcept
+            {
+                return reinterpret_cast<std::byte *>(this + 1);
+            }
+
+            std::byte * end() noexcept
+            {
+                return reinterpret_cast<std::byte *>(this) + this->size;
+            }
+        };
+
+        static std::byte * align_up(std::byte * ptr, size_type alignment) noexcept
+        {
+            auto const address = reinterpret_cast<std::uintptr_t>(ptr);
+            auto const aligned = (address + alignment - 1) & ~(std::uintptr_t(alignment) - 1);
+
+            return ptr + (aligned - address);
+        }
+
+        void * do_allocate(size_type bytes, size_type alignment) override
+        {
+            for(;;)
+            {
+                if(this->current_ != nullptr)
+                {
+                    auto * const result = arena_resource::align_up(this->position_, alignment);
+
+                    if(result <= this->current_->end()
+                       && bytes <= static_cast<size_type>(this->current_->end() - result))
+                    {
+                        this->used_ += static_cast<size_type>(result + bytes - this->position_);
+                        this->position_ = result + bytes;
+
+                        return result;
+                    }
+
+                    // Блок, сохранённый при сбросе, может оказаться мал: берём следующий
+                    if(this->current_->next != nullptr)
+                    {
+                        this->current_ = this->current_->next;
+                        this->position_ = this->current_->begin();
+                        continue;
+                    }
+                }
+
+                this->add_chunk_private(bytes, alignment);
+            }
+        }
+
+        void do_deallocate(void *, size_type, size_type) override
+        {}
+
+        bool do_is_equal(std::pmr::memory_resource const & other) const noexcept override
+        {
+            return this == &other;
+        }
+
+        /// @brief Добавление в конец списка блока, в котором поместится @c bytes байтов
+        void add_chunk_private(size_type bytes, size_type alignment)
+        {
+            auto const required = sizeof(chunk_header) + bytes + alignment;
+            auto const size = std::max(this->next_size_, required);
+
+            auto * const memory = this->upstream_->allocate(size, alignof(chunk_header));
+            auto * const chunk = ::new(memory) chunk_header{nullptr, size};
+
+            if(this->current_ == nullptr)
+            {
+                assert(this->first_ == nullptr);
+
+                this->first_ = chunk;
+            }
+            else
+            {
+                assert(this->current_->next == nullptr);
+
+                this->current_->next = chunk;
+            }
+
+            this->current_ = chunk;
+            this->position_ = chunk->begin();
+            this->capacity_ += size;
+            this->next_size_ = 2 * size;
+        }
+
+        std::pmr::memory_resource * upstream_ = nullptr;
+        chunk_header * first_ = nullptr;
+        chunk_header * current_ = nullptr;
+        std::byte * position_ = nullptr;
+        size_type used_ = 0;
+        size_type capacity_ = 0;
+        size_type next_size_ = default_initial_size;
+    };
+}
+// namespace saga
+
+#endif
+// Z_SAGA_MEMORY_ARENA_RESOURCE_HPP_INCLUDED
@@ -0,0 +1,239 @@
+/* (c) 2026 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки SAGA.
+
+SAGA -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#ifndef Z_SAGA_MEMORY_MAPPED_FILE_HPP_INCLUDED
+#define Z_SAGA_MEMORY_MAPPED_FILE_HPP_INCLUDED
+
+/** @file saga/memory/mapped_file.hpp
+ @brief Файл, отображённый в память только для чтения
+
+ В POSIX-системах содержимое файла отображается в память с помощью mmap, поэтому чтение не требует
+ копирования в буфер потока. В остальных системах файл целиком читается в динамическую память.
+*/
+
+#include <cerrno>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define SAGA_HAS_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <fstream>
+#include <memory>
+#endif
+// SAGA_HAS_MMAP
+
+namespace saga
+{
+    /** @brief Содержимое файла, доступное как непрерывная последовательность символов
+
+    Объекты этого класса можно перемещать, но нельзя копировать. Указатели и
+    <tt>std::string_view</tt>, полученные из объекта, действительны, пока он не уничтожен и не
+    изменён присваиванием.
+    */
+    class mapped_file
+    {
+    public:
+        // Типы
+        using value_type = char;
+        using size_type = std::size_t;
+        using const_pointer = char const *;
+        using const_iterator = const_pointer;
+
+        // Создание, копирование, уничтожение
+        /// @brief Создаёт объект, не связанный ни с каким файлом
+        mapped_file() noexcept = default;
+
+        /** @brief Отображает в память содержимое файла @c path
+        @throw std::system_error, если файл не удалось открыть или прочитать
+        */
+        explicit mapped_file(char const * path)
+        {
+            this->open_private(path);
+        }
+
+        explicit mapped_file(std::string const & path)
+         : mapped_file(path.c_str())
+        {}
+
+        mapped_file(mapped_file const &) = delete;
+
+        mapped_file(mapped_file && other) noexcept
+         : data_(std::exchange(other.data_, nullptr))
+         , size_(std::exchange(other.size_, 0))
+        {}
+
+        ~mapped_file()
+        {
+            this->close_private();
+        }
+
+        mapped_file & operator=(mapped_file const &) = delete;
+
+        mapped_file & operator=(mapped_file && rhs) noexcept
+        {
+            if(this != &rhs)
+            {
+                this->close_private();
+
+                this->data_ = std::exchange(rhs.data_, nullptr);
+                this->size_ = std::exchange(rhs.size_, 0);
+            }
+
+            return *this;
+        }
+
+        // Размер и содержимое
+        const_pointer data() const noexcept
+        {
+            return this->data_;
+        }
+
+        size_type size() const noexcept
+        {
+            return this->size_;
+        }
+
+        bool empty() const noexcept
+        {
+            return this->size_ == 0;
+        }
+
+        std::string_view view() const noexcept
+        {
+            return std::string_view(this->data_, this->size_);
+        }
+
+        // Итераторы
+        const_iterator begin() const noexcept
+        {
+            return this->data_;
+        }
+
+        const_iterator end() const noexcept
+        {
+            return this->data_ + this->size_;
+        }
+
+    private:
+#ifdef SAGA_HAS_MMAP
+        void open_private(char const * path)
+        {
+            auto const fd = ::open(path, O_RDONLY);
+
+            if(fd == -1)
+            {
+                throw std::system_error(errno, std::generic_category(), path);
+            }
+
+            struct ::stat info {};
+
+            if(::fstat(fd, &info) == -1)
+            {
+                auto const error = errno;
+                ::close(fd);
+                throw std::system_error(error, std::generic_category(), path);
+            }
+
+            auto const size = static_cast<size_type>(info.st_size);
+
+            // Отображение нулевой длины не допускается: пустой файл представляется пустым объектом
+            if(size == 0)
+            {
+                ::close(fd);
+                return;
+            }
+
+            auto const addr = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            auto const error = errno;
+
+            ::close(fd);
+
+            if(addr == MAP_FAILED)
+            {
+                throw std::system_error(error, std::generic_category(), path);
+            }
+
+#ifdef POSIX_MADV_SEQUENTIAL
+            ::posix_madvise(addr, size, POSIX_MADV_SEQUENTIAL);
+#endif
+
+            this->data_ = static_cast<char const *>(addr);
+            this->size_ = size;
+        }
+
+        void close_private() noexcept
+        {
+            if(this->data_ != nullptr)
+            {
+                ::munmap(const_cast<char *>(this->data_), this->size_);
+            }
+        }
+#else
+        void open_private(char const * path)
+        {
+            std::ifstream file(path, std::ios::binary | std::ios::ate);
+
+            if(!file)
+            {
+                throw std::system_error(std::make_error_code(std::errc::no_such_file_or_directory)
+                                       , path);
+            }
+
+            auto const size = static_cast<size_type>(file.tellg());
+
+            if(size == 0)
+            {
+                return;
+            }
+
+            auto buffer = std::make_unique<char[]>(size);
+
+            file.seekg(0);
+
+            if(!file.read(buffer.get(), static_cast<std::streamsize>(size)))
+            {
+                throw std::system_error(std::make_error_code(std::errc::io_error), path);
+            }
+
+            this->data_ = buffer.release();
+            this->size_ = size;
+        }
+
+        void close_private() noexcept
+        {
+            delete [] this->data_;
+        }
+#endif
+// SAGA_HAS_MMAP
+
+    private:
+        char const * data_ = nullptr;
+        size_type size_ = 0;
+    };
+}
+// namespace saga
+
+#endif
+// Z_SAGA_MEMORY_MAPPED_FILE_HPP_INCLUDED
@@ -26,9 +26,17 @@ SAGA -- это свободной программное обеспечение:
 #include <saga/cursor/subrange.hpp>
 #include <saga/functional.hpp>
 #include <saga/math.hpp>
+#include <saga/numeric/linear_sieve.hpp>
+#include <saga/numeric/modular.hpp>
+#include <saga/numeric/segmented_sieve.hpp>
 #include <saga/utility/exchange.hpp>
+#include <saga/utility/in_place.hpp>
 
+#include <cmath>
+#include <cstdint>
 #include <functional>
+#include <limits>
+#include <memory>
 #include <utility>
 
 namespace saga
@@ -61,9 +69,28 @@ namespace saga
                          Value init,
                          BinaryOperation bin_op = BinaryOperation()) const
         {
-            for(; !!cur; ++ cur)
+            if constexpr (saga::is_segmented_cursor<InputCursor>{})
             {
-                init = saga::invoke(bin_op, std::move(init), *cur);
+                while(!!cur)
+                {
+                    auto segment = cur.front_segment();
+                    auto const num = segment.size();
+
+                    for(auto rest = num; rest > 0; --rest)
+                    {
+                        init = saga::invoke(bin_op, std::move(init), segment.front());
+                        segment.drop_front();
+                    }
+
+                    cur.drop_front_segment(num);
+                }
+            }
+            else
+            {
+                for(; !!cur; ++ cur)
+                {
+                    init = saga::invoke(bin_op, std::move(init), *cur);
+                }
             }
 
             return init;
@@ -78,6 +105,29 @@ namespace saga
         constexpr T operator()(InputCursor1 in1, InputCursor2 in2, T init,
                                BinaryOperator1 op1 = {}, BinaryOperator2 op2 = {}) const
         {
+            // Подсчёт числа равных или неравных пар элементов
+            constexpr auto use_simd_equal
+                = detail::use_simd_comparison<detail::is_equal_to_predicate
+                                              , BinaryOperator2, InputCursor1, InputCursor2>{};
+            constexpr auto use_simd_not_equal
+                = detail::use_simd_comparison<detail::is_not_equal_to_predicate
+                                              , BinaryOperator2, InputCursor1, InputCursor2>{};
+
+            if constexpr (std::is_integral<T>{} && std::is_same<BinaryOperator1, std::plus<>>{}
+                          && (use_simd_equal || use_simd_not_equal))
+            {
+                if(!detail::may_be_constant_evaluated())
+                {
+                    auto const num = std::min(static_cast<std::size_t>(in1.size())
+                                             , static_cast<std::size_t>(in2.size()));
+
+                    auto const n_equal = detail::simd_count_equal(detail::simd_data(in1)
+                                                                  , detail::simd_data(in2), num);
+
+                    return static_cast<T>(init + (use_simd_equal ? n_equal : num - n_equal));
+                }
+            }
+
             for(; !!in1 && !!in2; ++ in1, (void)++in2)
             {
                 init = saga::invoke(op1, std::move(init), saga::invoke(op2, *in1, *in2));
@@ -435,32 +485,11 @@ namespace saga
         OutputCursor
         operator()(IntType n_max, OutputCursor out) const
         {
-            using Seive = std::vector<unsigned short>;
-
-            if(n_max < IntType(3))
-            {
-                return out;
-            }
-
-            out << IntType(2);
-
-            if(n_max == IntType(3))
-            {
-                return out;
-            }
-
-            auto const N_seive = (n_max - 2)/2;
-
-            Seive seive(N_seive, true);
-
-            saga::eratosthenes_seive_fn{}(saga::cursor::all(seive));
+            auto primes = saga::primes_in_cursor<IntType>(IntType(2), std::move(n_max));
 
-            for(auto index = IntType(0); index < N_seive; ++ index)
+            for(; !!primes; ++primes)
             {
-                if(seive[index])
-                {
-                    out << 2*index + 3;
-                }
+                out << *primes;
             }
 
             return out;
@@ -473,7 +502,15 @@ namespace saga
         std::vector<IntType>
         operator()(IntType n_max) const
         {
-            std::vector<IntType> primes;
+            return (*this)(std::move(n_max), std::allocator<IntType>());
+        }
+
+        /// @brief Простые числа, меньшие @c n_max, в векторе, использующем распределитель @c alloc
+        template <class IntType, class Allocator>
+        std::vector<IntType, Allocator>
+        operator()(IntType n_max, Allocator const & alloc) const
+        {
+            std::vector<IntType, Allocator> primes(alloc);
 
             saga::copy_primes_below_fn{}(std::move(n_max), saga::back_inserter(primes));
 
@@ -481,29 +518,123 @@ namespace saga
         }
     };
 
+    namespace detail
+    {
+        /** @brief Вычисление одной таблицы линейным решетом непосредственно в векторе, который
+        возвращается вызывающей стороне
+        @param fill функциональный объект, вызываемый с аргументами @c n, @c primes и
+        @c table: границей, вектором для простых чисел и указателем на начало таблицы
+
+        Для границ, не превосходящих 2^32, простые числа хранятся в 32-битных элементах. Других
+        вспомогательных таблиц, кроме нужных для вычисления самой таблицы, не создаётся.
+        */
+        template <class IntType, class Allocator, class Fill>
+        std::vector<IntType, Allocator>
+        linear_sieve_table(IntType n_max, Allocator const & alloc, Fill fill)
+        {
+            auto const n = static_cast<std::size_t>(n_max);
+
+            std::vector<IntType, Allocator> table(n, IntType(0), alloc);
+
+            if(n == 0 || n - 1 <= std::numeric_limits<std::uint32_t>::max())
+            {
+                std::vector<std::uint32_t> primes;
+                fill(n, primes, table.data());
+            }
+            else
+            {
+                std::vector<std::uint64_t> primes;
+                fill(n, primes, table.data());
+            }
+
+            return table;
+        }
+    }
+    // namespace detail
+
     struct euler_phi_below_fn
     {
         template <class IntType>
         std::vector<IntType>
         operator()(IntType n_max) const
         {
-            std::vector<IntType> result(n_max);
+            return (*this)(std::move(n_max), std::allocator<IntType>());
+        }
+
+        /** @brief Значения функции Эйлера для чисел, меньших @c n_max, в векторе, использующем
+        распределитель @c alloc
+        @details Временный вектор простых чисел использует std::allocator
+        */
+        template <class IntType, class Allocator>
+        std::vector<IntType, Allocator>
+        operator()(IntType n_max, Allocator const & alloc) const
+        {
+            return saga::detail::linear_sieve_table(n_max, alloc
+                                                   , [](std::size_t n, auto & primes, IntType * phi)
+            {
+                saga::detail::linear_sieve_fill<IntType, IntType>
+                    (n, primes, phi, nullptr, phi, nullptr, nullptr, nullptr);
+            });
+        }
+    };
+
+    /** @brief Умножение по модулю
+
+    Для встроенных целых типов произведение вычисляется без переполнения: 32-битные числа
+    перемножаются в 64-битных, а 64-битные -- в 128-битных.
+    */
+    template <class IntType>
+    class multiplies_modulo
+    {
+    public:
+        constexpr explicit multiplies_modulo(IntType mod)
+         : mod_(std::move(mod))
+        {}
 
-            saga::iota_fn{}(saga::cursor::all(result), IntType(0));
+        constexpr IntType operator()(IntType const & lhs, IntType const & rhs) const
+        {
+            if constexpr (std::is_integral<IntType>{} && sizeof(IntType) <= sizeof(std::uint32_t))
+            {
+                using Wide = std::conditional_t<std::is_signed<IntType>{}
+                                               , std::int64_t, std::uint64_t>;
 
-            for(auto cur : saga::cursor::indices(IntType(2), n_max))
+                return IntType(Wide(lhs) * Wide(rhs) % Wide(this->mod_));
+            }
+            else if constexpr (std::is_integral<IntType>{}
+                               && sizeof(IntType) == sizeof(std::uint64_t))
             {
-                if(cur == result[cur])
+                if constexpr (std::is_signed<IntType>{})
                 {
-                    for(auto num = cur; num < n_max; num += cur)
+                    if(lhs < 0 || rhs < 0)
                     {
-                        result[num] -= result[num] / cur;
+                        return lhs * rhs % this->mod_;
                     }
                 }
-            }
 
-            return result;
+                auto const mod = static_cast<std::uint64_t>(this->mod_);
+                auto product = detail::multiply_wide_64(static_cast<std::uint64_t>(lhs)
+                                                        , static_cast<std::uint64_t>(rhs));
+
+                if(product.high == 0)
+                {
+                    return IntType(product.low % mod);
+                }
+
+                if(product.high >= mod)
+                {
+                    product.high %= mod;
+                }
+
+                return IntType(detail::divide_wide_64(product.high, product.low, mod).remainder);
+            }
+            else
+            {
+                return lhs * rhs % this->mod_;
+            }
         }
+
+    private:
+        IntType mod_;
     };
 
     struct inverses_modulo_prime_fn
@@ -536,11 +667,63 @@ namespace saga
 
             std::vector<IntType> result(num_end, 0);
 
-            result[1] = 1;
+            if(result.size() > 1)
+            {
+                result[1] = 1;
+            }
+
+            auto const mult = saga::multiplies_modulo<IntType>(prime);
 
             for(auto num : saga::cursor::indices(std::size_t(2), result.size()))
             {
-                result[num] = (prime / num) * (prime - result[prime % num]) % prime;
+                result[num] = mult(IntType(prime / num), IntType(prime - result[prime % num]));
+            }
+
+            return result;
+        }
+        ///@}
+
+        ///@{
+        /** @brief Вычисление обратных для всех вычетов по простому модулю типа @c modular_integer
+        @param num_end верхняя граница индексов, для которых вычисляются обратные элементы.
+        Если значение не задано, то используется модуль
+
+        Умножения по модулю выполняются с помощью редукции, используемой типом @c modular_integer.
+
+        @pre <tt>modular_integer<Modulus>::modulus()</tt> -- простое число
+        @pre num_end <= modular_integer<Modulus>::modulus()
+        @return Индексируемый контейнер, элементы которого содержат обратные к соответствующему
+        индексу. Значение для нулевого элемента не определено.
+        */
+        template <class Modulus>
+        std::vector<saga::modular_integer<Modulus>>
+        operator()(saga::in_place_type_t<saga::modular_integer<Modulus>> type) const
+        {
+            auto const prime = saga::modular_integer<Modulus>::modulus();
+
+            return (*this)(type, static_cast<std::size_t>(prime));
+        }
+
+        template <class Modulus>
+        std::vector<saga::modular_integer<Modulus>>
+        operator()(saga::in_place_type_t<saga::modular_integer<Modulus>>, std::size_t num_end) const
+        {
+            using Value = saga::modular_integer<Modulus>;
+
+            auto const prime = Value::modulus();
+
+            assert(num_end <= prime);
+
+            std::vector<Value> result(num_end);
+
+            if(result.size() > 1)
+            {
+                result[1] = Value(1);
+            }
+
+            for(auto num : saga::cursor::indices(std::size_t(2), result.size()))
+            {
+                result[num] = -Value(prime / num) * result[prime % num];
             }
 
             return result;
@@ -556,21 +739,15 @@ namespace saga
         {
             assert(n_max > 0);
 
-            std::vector<IntType> answer;
-            answer.reserve(n_max);
-
-            answer.push_back(IntType(1));
-            saga::copy(saga::cursor::indices(IntType(1), n_max), saga::back_inserter(answer));
-
-            auto const primes = saga::primes_below_fn{}(saga::isqrt(n_max) + 1);
-
-            for(auto const & prime : primes)
+            auto answer = saga::detail::linear_sieve_table(n_max, std::allocator<IntType>()
+                                                          , [](std::size_t n, auto & primes
+                                                              , IntType * first_factors)
             {
-                for(auto num = prime * prime; num < n_max; num += prime)
-                {
-                    answer[num] = std::min(answer[num], prime);
-                }
-            }
+                saga::detail::linear_sieve_fill<IntType, IntType>
+                    (n, primes, first_factors, first_factors, nullptr, nullptr, nullptr, nullptr);
+            });
+
+            answer[0] = IntType(1);
 
             return answer;
         }
@@ -585,22 +762,15 @@ namespace saga
         {
             assert(n_max > 1);
 
-            auto const first_factors = saga::first_factors_below_fn{}(n_max);
-
-            std::vector<IntType> d_sum(n_max, 1);
-
-            for(auto const & num : saga::cursor::indices(2, n_max))
+            auto d_sum = saga::detail::linear_sieve_table(n_max, std::allocator<IntType>()
+                                                         , [](std::size_t n, auto & primes
+                                                             , IntType * sums)
             {
-                auto const prime = first_factors[num];
+                saga::detail::linear_sieve_fill<IntType, IntType>
+                    (n, primes, sums, nullptr, nullptr, nullptr, nullptr, sums);
+            });
 
-                auto rest = num;
-                for(; rest % prime == 0; rest /= prime)
-                {
-                    d_sum[num] = d_sum[num] * prime + 1;
-                }
-
-                d_sum[num] *= d_sum[rest];
-            }
+            d_sum[0] = IntType(1);
 
             return d_sum;
         }
@@ -623,21 +793,265 @@ namespace saga
         }
     };
 
-    template <class IntType>
-    class multiplies_modulo
+    namespace detail
     {
-    public:
-        constexpr explicit multiplies_modulo(IntType mod)
-         : mod_(std::move(mod))
-        {}
+        /** @brief Метод Lucy_Hedgehog: сумма значений вполне мультипликативной функции f по
+        простым числам, не превосходящим @c num
+        @param prefix функция, возвращающая сумму f(k) при 2 <= k <= v
+        @param weight функция, возвращающая f(p)
+
+        Хранит значения для всех различных частных <tt>num / k</tt>: O(sqrt(num)) памяти и
+        O(num^(3/4)) операций. Используются только сложение, вычитание и умножение, поэтому для
+        беззнаковых типов результат верен по модулю 2^N даже при переполнении.
+        */
+        template <class IntType, class Prefix, class Weight>
+        IntType lucy_hedgehog(IntType num, Prefix prefix, Weight weight)
+        {
+            if(num < 2)
+            {
+                return IntType(0);
+            }
 
-        constexpr IntType operator()(IntType const & lhs, IntType const & rhs) const
+            auto const root = saga::isqrt(num);
+
+            // small[v] -- значение для v <= root, large[k] -- для num / k
+            std::vector<IntType> small(static_cast<std::size_t>(root) + 1, IntType(0));
+            std::vector<IntType> large(static_cast<std::size_t>(root) + 1, IntType(0));
+
+            for(auto value = IntType(1); value <= root; ++value)
+            {
+                small[value] = prefix(value);
+                large[value] = prefix(num / value);
+            }
+
+            for(auto prime = IntType(2); prime <= root; ++prime)
+            {
+                if(small[prime] == small[prime - 1])
+                {
+                    continue;
+                }
+
+                auto const before = small[prime - 1];
+                auto const factor = weight(prime);
+                auto const square = prime * prime;
+                auto const k_max = std::min(root, num / square);
+
+                for(auto k = IntType(1); k <= k_max; ++k)
+                {
+                    auto const k_prime = k * prime;
+                    auto const & rest = (k_prime <= root) ? large[k_prime] : small[num / k_prime];
+
+                    large[k] -= factor * (rest - before);
+                }
+
+                for(auto value = root; value >= square; --value)
+                {
+                    small[value] -= factor * (small[value / prime] - before);
+                }
+            }
+
+            return large[1];
+        }
+
+        // Наибольшая граница таблицы, вычисляемой решетом для сумматорных функций
+        inline constexpr std::size_t summatory_table_max = std::size_t(1) << 22;
+
+        /** @brief Граница таблицы значений сумматорной функции
+
+        Оптимальная граница -- num^(2/3), но она ограничивается сверху ради экономии памяти.
+        Граница всегда больше isqrt(num): это требуется функции summatory_by_hyperbola.
+        */
+        template <class IntType>
+        std::size_t summatory_table_size(IntType num)
         {
-            return lhs * rhs % this->mod_;
+            auto const root = static_cast<std::size_t>(saga::isqrt(num));
+            auto const cbrt = static_cast<std::size_t>(std::cbrt(static_cast<double>(num)));
+
+            return std::max(root + 1, std::min(cbrt * cbrt, summatory_table_max));
         }
 
-    private:
-        IntType mod_;
+        /** @brief Вычисление сумматорной функции F по формуле обращения
+        <tt>F(v) = total(v) - sum(F(v / d), 2 <= d <= v)</tt>
+        @param table значения F(v) при <tt>v < table.size()</tt>
+        @pre <tt>table.size() > isqrt(num)</tt>
+
+        Для каждого из <tt>num / table.size()</tt> больших частных <tt>v = num / k</tt> слагаемые
+        группируются по совпадающим значениям <tt>v / d</tt> (гиперболический метод Дирихле), что
+        требует O(sqrt(v)) операций.
+        */
+        template <class Result, class IntType, class Total>
+        Result summatory_by_hyperbola(IntType num, std::vector<Result> const & table, Total total)
+        {
+            assert(num >= 0);
+            assert(static_cast<std::size_t>(saga::isqrt(num)) < table.size());
+
+            auto const limit = static_cast<IntType>(table.size());
+
+            if(num < limit)
+            {
+                return table[num];
+            }
+
+            auto const k_max = num / limit;
+
+            std::vector<Result> large(static_cast<std::size_t>(k_max) + 1, Result(0));
+
+            // Последним вычисляется значение для k = 1, то есть F(num)
+            auto answer = Result(0);
+
+            for(auto k = k_max; k > 0; --k)
+            {
+                auto const value = num / k;
+                auto const root = saga::isqrt(value);
+
+                auto result = total(value);
+
+                // Малые d: частные v / d могут быть как малыми, так и большими
+                for(auto d = IntType(2); d <= root; ++d)
+                {
+                    auto const quotient = value / d;
+
+                    result -= (quotient < limit) ? table[quotient] : large[k * d];
+                }
+
+                // Большие d: частное q < limit принимают все d из (v / (q + 1), v / q]
+                auto const q_max = value / (root + 1);
+                auto d_high = value;
+
+                for(auto quotient = IntType(1); quotient <= q_max; ++quotient)
+                {
+                    auto const d_low = std::max(value / (quotient + 1), root);
+
+                    result -= static_cast<Result>(d_high - d_low) * table[quotient];
+
+                    d_high = d_low;
+                }
+
+                large[k] = result;
+                answer = result;
+            }
+
+            return answer;
+        }
+    }
+    // namespace detail
+
+    /** @brief Количество простых чисел, не превосходящих @c num, методом Lucy_Hedgehog
+
+    Требует O(sqrt(num)) памяти и O(num^(3/4)) операций, в отличие от решета, которому нужно
+    O(num) памяти.
+    */
+    struct lucy_prime_count_fn
+    {
+        template <class IntType>
+        IntType operator()(IntType num) const
+        {
+            return detail::lucy_hedgehog(num, [](IntType value) { return IntType(value - 1); }
+                                        , [](IntType) { return IntType(1); });
+        }
+    };
+
+    /** @brief Сумма простых чисел, не превосходящих @c num, методом Lucy_Hedgehog
+
+    Сумма растёт как num^2 / (2 ln num), а промежуточные значения -- как num^2 / 2. Вычисления
+    всегда выполняются в беззнаковом типе, то есть по модулю 2^N, поэтому результат верен, если
+    искомая сумма представима в @c IntType: для std::int64_t это выполняется при num, не
+    превосходящих примерно 2*10^10, для std::uint64_t -- примерно 3*10^10. Для больших num
+    результат для беззнаковых типов равен сумме по модулю 2^N.
+    */
+    struct lucy_prime_sum_fn
+    {
+        template <class IntType>
+        IntType operator()(IntType num) const
+        {
+            using Unsigned = std::make_unsigned_t<IntType>;
+
+            if(num < 2)
+            {
+                return IntType(0);
+            }
+
+            auto prefix = [](Unsigned value)
+                { return Unsigned(saga::triangular_number(value) - 1); };
+
+            return IntType(detail::lucy_hedgehog(Unsigned(num), prefix
+                                                , [](Unsigned prime) { return prime; }));
+        }
+    };
+
+    /** @brief Функция Мертенса: сумма значений функции Мёбиуса от 1 до @c num
+
+    Использует тождество <tt>sum(M(num / d), 1 <= d <= num) = 1</tt>. Значения для малых
+    аргументов вычисляются линейным решетом, для больших -- гиперболическим методом Дирихле,
+    что требует O(num^(2/3)) операций, пока таблица не достигает наибольшего размера.
+    */
+    struct mertens_fn
+    {
+        template <class IntType>
+        std::make_signed_t<IntType> operator()(IntType num) const
+        {
+            using Result = std::make_signed_t<IntType>;
+
+            if(num < 1)
+            {
+                return Result(0);
+            }
+
+            auto const size = detail::summatory_table_size(num);
+
+            auto const mu
+                = saga::linear_sieve<>(size, saga::linear_sieve_tables::moebius).moebius();
+
+            std::vector<Result> table(size, Result(0));
+
+            for(auto value = std::size_t(1); value < size; ++value)
+            {
+                table[value] = table[value - 1] + mu[value];
+            }
+
+            return detail::summatory_by_hyperbola(num, table, [](IntType) { return Result(1); });
+        }
+    };
+
+    /** @brief Сумма значений функции Эйлера от 1 до @c num
+
+    Использует тождество <tt>sum(Phi(num / d), 1 <= d <= num) = num (num + 1) / 2</tt>, где Phi --
+    искомая сумма. Значения для малых аргументов вычисляются линейным решетом, для больших --
+    гиперболическим методом Дирихле.
+
+    Сумма растёт как 3 num^2 / pi^2, а num (num + 1) / 2 -- быстрее. Вычисления всегда выполняются
+    в беззнаковом типе, то есть по модулю 2^N, поэтому результат верен, если искомая сумма
+    представима в @c IntType: для std::int64_t это выполняется при num, не превосходящих примерно
+    5*10^9, для std::uint64_t -- примерно 7.5*10^9. Для больших num результат для беззнаковых
+    типов равен сумме по модулю 2^N.
+    */
+    struct euler_phi_sum_fn
+    {
+        template <class IntType>
+        IntType operator()(IntType num) const
+        {
+            using Unsigned = std::make_unsigned_t<IntType>;
+
+            if(num < 1)
+            {
+                return IntType(0);
+            }
+
+            auto const size = detail::summatory_table_size(num);
+
+            auto const phi
+                = saga::linear_sieve<>(size, saga::linear_sieve_tables::euler_phi).euler_phi();
+
+            std::vector<Unsigned> table(size, Unsigned(0));
+
+            for(auto value = std::size_t(1); value < size; ++value)
+            {
+                table[value] = Unsigned(table[value - 1] + phi[value]);
+            }
+
+            return IntType(detail::summatory_by_hyperbola(Unsigned(num), table
+                                                          , saga::triangular_number));
+        }
     };
 
     struct legendre_symbol_fn
@@ -672,6 +1086,29 @@ namespace saga
 
             return answer;
         }
+
+        /** @brief Вычисление символа Лежандра для вычета по простому модулю
+        @pre модуль -- простое число
+        */
+        template <class Modulus>
+        constexpr int operator()(saga::modular_integer<Modulus> const & num) const
+        {
+            using Value = saga::modular_integer<Modulus>;
+
+            auto const prime = Value::modulus();
+
+            if(num == Value(0))
+            {
+                return 0;
+            }
+
+            if(prime == 2)
+            {
+                return 1;
+            }
+
+            return (num.power((prime - 1) / 2) == Value(1)) ? 1 : -1;
+        }
     };
 
     struct sqrt_modulo_prime_fn
@@ -690,34 +1127,59 @@ namespace saga
 
             num %= prime;
 
-            auto const mult = saga::multiplies_modulo<IntType>(prime);
+            return sqrt_modulo_prime_fn::tonelli_shanks(num, prime
+                                                        , saga::multiplies_modulo<IntType>(prime));
+        }
+
+        /** @brief Вычисление квадратного корня из вычета по простому модулю
+        @pre модуль -- простое число
+        @pre num - квадратичный вычет
+        */
+        template <class Modulus>
+        saga::modular_integer<Modulus>
+        operator()(saga::modular_integer<Modulus> const & num, unsafe_tag_t) const
+        {
+            auto const prime = saga::modular_integer<Modulus>::modulus();
+
+            if(prime == 2)
+            {
+                return num;
+            }
+
+            return sqrt_modulo_prime_fn::tonelli_shanks(num, prime, std::multiplies<>{});
+        }
 
+    private:
+        // Алгоритм Тонелли-Шенкса, prime > 2
+        template <class Value, class IntType, class BinaryOperation>
+        static Value tonelli_shanks(Value num, IntType prime, BinaryOperation mult)
+        {
             if(prime % 4 == 3)
             {
                 return saga::power_natural(num, (prime + 1) / 4, mult);
             }
 
-            auto const [Q, S] = saga::remove_factor(prime - 1, IntType(2));
+            auto const [Q, S] = saga::remove_factor(IntType(prime - 1), IntType(2));
 
             auto M = S;
-            auto const z = this->find_nonresidue(prime);
+            auto const z = sqrt_modulo_prime_fn::find_nonresidue(num, prime);
             auto c = saga::power_natural(z, Q, mult);
             auto t = saga::power_natural(num, Q, mult);
             auto R = saga::power_natural(num, (Q+1)/2, mult);
 
             for(;;)
             {
-                if(t == 0)
+                if(t == Value(0))
                 {
-                    return IntType(0);
+                    return Value(0);
                 }
 
-                if(t == 1)
+                if(t == Value(1))
                 {
                     return R;
                 }
 
-                auto const i = this->find_index(t, M, prime);
+                auto const i = sqrt_modulo_prime_fn::find_index(t, M, mult);
 
                 auto const b
                     = saga::power_natural(c, saga::power_semigroup(IntType(2), M - i - 1), mult);
@@ -729,9 +1191,8 @@ namespace saga
             }
         }
 
-    private:
         template <class IntType>
-        static IntType find_nonresidue(IntType prime)
+        static IntType find_nonresidue(IntType, IntType prime)
         {
             assert(prime > 2);
 
@@ -739,7 +1200,7 @@ namespace saga
 
             for(; answer < prime; ++ answer)
             {
-                if(saga::legendre_symbol_fn{}(answer, prime) == -1)
+                if(saga::legendre_symbol_fn{}(answer, prime) == IntType(-1))
                 {
                     return answer;
                 }
@@ -750,16 +1211,34 @@ namespace saga
             return answer;
         }
 
-        template <class IntType>
-        static IntType find_index(IntType t, IntType M, IntType prime)
+        template <class Modulus>
+        static saga::modular_integer<Modulus>
+        find_nonresidue(saga::modular_integer<Modulus> const &, std::uint64_t prime)
+        {
+            assert(prime > 2);
+
+            for(auto answer = std::uint64_t(2); answer < prime; ++ answer)
+            {
+                if(saga::legendre_symbol_fn{}(saga::modular_integer<Modulus>(answer)) == -1)
+                {
+                    return saga::modular_integer<Modulus>(answer);
+                }
+            }
+
+            assert(false);
+            return {};
+        }
+
+        template <class Value, class IntType, class BinaryOperation>
+        static IntType find_index(Value t, IntType M, BinaryOperation mult)
         {
             auto index = IntType(1);
 
             for(; index < M; ++ index)
             {
-                t = saga::square(t) % prime;
+                t = saga::square(t, mult);
 
-                if(t == 1)
+                if(t == Value(1))
                 {
                     return index;
                 }
@@ -768,7 +1247,6 @@ namespace saga
             assert(false);
             return index;
         }
-
     };
 
     struct factoriadic_fn
@@ -844,6 +1322,11 @@ namespace saga
     inline constexpr auto const divisor_sums_below = divisor_sums_below_fn{};
     inline constexpr auto const aliquot_sums_below = aliquot_sums_below_fn{};
 
+    inline constexpr auto const lucy_prime_count = lucy_prime_count_fn{};
+    inline constexpr auto const lucy_prime_sum = lucy_prime_sum_fn{};
+    inline constexpr auto const mertens = mertens_fn{};
+    inline constexpr auto const euler_phi_sum = euler_phi_sum_fn{};
+
     inline constexpr auto const legendre_symbol = legendre_symbol_fn{};
     inline constexpr auto const sqrt_modulo_prime = sqrt_modulo_prime_fn{};
 
@@ -0,0 +1,131 @@
+/* (c) 2026 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки SAGA.
+
+SAGA -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#ifndef Z_SAGA_NUMERIC_BARRETT_HPP_INCLUDED
+#define Z_SAGA_NUMERIC_BARRETT_HPP_INCLUDED
+
+/** @file saga/numeric/barrett.hpp
+ @brief Арифметика по 32-битному модулю с редукцией Барретта
+
+ Остаток от деления 64-битного числа на n вычисляется с помощью заранее найденного приближения
+ к 2^64 / n: одно умножение с 128-битным результатом, одно обычное умножение и одна поправка.
+ В отличие от формы Монтгомери, модуль может быть чётным, а числа хранятся как есть.
+*/
+
+#include <saga/detail/uint128.hpp>
+
+#include <cassert>
+#include <cstdint>
+
+namespace saga
+{
+    class barrett_32
+    {
+    public:
+        // Типы
+        using value_type = std::uint32_t;
+
+        // Создание, копирование, уничтожение
+        /** @brief Конструктор
+        @pre <tt>modulus > 1</tt>
+        */
+        constexpr explicit barrett_32(value_type modulus) noexcept
+         : modulus_(modulus)
+         , inverse_(std::uint64_t(-1) / modulus + 1)
+        {
+            assert(modulus > 1);
+        }
+
+        // Свойства
+        constexpr value_type modulus() const noexcept
+        {
+            return this->modulus_;
+        }
+
+        // Редукция
+        /** @brief Остаток от деления на модуль
+
+        Если <tt>num = q * n + r</tt>, то <tt>mulhi(num, ceil(2^64 / n))</tt> равно @c q или
+        <tt>q + 1</tt>, поэтому достаточно одной поправки.
+        */
+        constexpr value_type reduce(std::uint64_t num) const noexcept
+        {
+            auto const quotient = detail::multiply_high_64(num, this->inverse_);
+            auto const product = quotient * this->modulus_;
+
+            return value_type(num - product + ((num < product) ? this->modulus_ : 0));
+        }
+
+        /// @brief Единица
+        constexpr value_type one() const noexcept
+        {
+            return 1;
+        }
+
+        // Операции над остатками
+        constexpr value_type add(value_type lhs, value_type rhs) const noexcept
+        {
+            assert(lhs < this->modulus_ && rhs < this->modulus_);
+
+            auto const sum = std::uint64_t(lhs) + rhs;
+
+            return value_type(sum - ((sum >= this->modulus_) ? this->modulus_ : 0));
+        }
+
+        constexpr value_type subtract(value_type lhs, value_type rhs) const noexcept
+        {
+            assert(lhs < this->modulus_ && rhs < this->modulus_);
+
+            return lhs - rhs + ((lhs < rhs) ? this->modulus_ : 0);
+        }
+
+        constexpr value_type negate(value_type num) const noexcept
+        {
+            return this->subtract(0, num);
+        }
+
+        constexpr value_type multiply(value_type lhs, value_type rhs) const noexcept
+        {
+            return this->reduce(std::uint64_t(lhs) * rhs);
+        }
+
+        constexpr value_type power(value_type base, std::uint64_t exponent) const noexcept
+        {
+            auto result = this->one();
+
+            for(; exponent > 0; exponent /= 2)
+            {
+                if(exponent % 2 == 1)
+                {
+                    result = this->multiply(result, base);
+                }
+
+                base = this->multiply(base, base);
+            }
+
+            return result;
+        }
+
+    private:
+        value_type modulus_;
+        std::uint64_t inverse_;
+    };
+}
+// namespace saga
+
+#endif
+// Z_SAGA_NUMERIC_BARRETT_HPP_INCLUDED
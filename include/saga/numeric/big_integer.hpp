@@ -0,0 +1,1802 @@
+/* (c) 2026 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки SAGA.
+
+SAGA -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#ifndef Z_SAGA_NUMERIC_BIG_INTEGER_HPP_INCLUDED
+#define Z_SAGA_NUMERIC_BIG_INTEGER_HPP_INCLUDED
+
+/** @file saga/numeric/big_integer.hpp
+ @brief Целые числа произвольной длины
+
+ Модуль числа хранится как последовательность 64-битных "цифр" (limbs) от младших к старшим.
+ Умножение выбирает алгоритм по размеру сомножителей: школьный, Карацубы или быстрое
+ теоретико-числовое преобразование (NTT) по трём простым модулям с восстановлением по китайской
+ теореме об остатках. Деление длинных чисел и перевод в десятичную систему и обратно
+ выполняются методом "разделяй и властвуй" и поэтому тоже используют быстрое умножение.
+*/
+
+#include <saga/detail/uint128.hpp>
+#include <saga/numeric/montgomery.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace saga
+{
+    namespace detail
+    {
+        using big_limb = std::uint64_t;
+
+        // Пороги переключения алгоритмов (в 64-битных цифрах)
+        inline constexpr std::size_t big_karatsuba_threshold = 32;
+        inline constexpr std::size_t big_ntt_threshold = 2000;
+        inline constexpr std::size_t big_division_threshold = 64;
+        inline constexpr std::size_t big_conversion_threshold = 32;
+
+        // Сложение и вычитание последовательностей цифр
+        /// @brief <tt>result = lhs + rhs</tt> для @c num цифр, возвращает перенос
+        inline big_limb limbs_add_n(big_limb * result, big_limb const * lhs
+                                   , big_limb const * rhs, std::size_t num)
+        {
+            auto carry = big_limb(0);
+
+            for(auto index = std::size_t(0); index < num; ++index)
+            {
+                auto const sum = lhs[index] + carry;
+                carry = (sum < carry);
+
+                result[index] = sum + rhs[index];
+                carry += (result[index] < sum);
+            }
+
+            return carry;
+        }
+
+        /// @brief <tt>result = lhs + value</tt> для @c num цифр, возвращает перенос
+        inline big_limb limbs_add_1(big_limb * result, big_limb const * lhs, std::size_t num
+                                   , big_limb value)
+        {
+            auto index = std::size_t(0);
+
+            for(; index < num && value != 0; ++index)
+            {
+                result[index] = lhs[index] + value;
+                value = (result[index] < value);
+            }
+
+            if(result != lhs)
+            {
+                std::copy(lhs + index, lhs + num, result + index);
+            }
+
+            return value;
+        }
+
+        /// @brief <tt>result = lhs - rhs</tt> для @c num цифр, возвращает заём
+        inline big_limb limbs_sub_n(big_limb * result, big_limb const * lhs
+                                   , big_limb const * rhs, std::size_t num)
+        {
+            auto borrow = big_limb(0);
+
+            for(auto index = std::size_t(0); index < num; ++index)
+            {
+                auto const difference = lhs[index] - rhs[index];
+                auto const next_borrow = big_limb(lhs[index] < rhs[index]);
+
+                result[index] = difference - borrow;
+                borrow = next_borrow | (difference < borrow);
+            }
+
+            return borrow;
+        }
+
+        /// @brief <tt>result = lhs - value</tt> для @c num цифр, возвращает заём
+        inline big_limb limbs_sub_1(big_limb * result, big_limb const * lhs, std::size_t num
+                                   , big_limb value)
+        {
+            auto index = std::size_t(0);
+
+            for(; index < num && value != 0; ++index)
+            {
+                auto const borrow = big_limb(lhs[index] < value);
+
+                result[index] = lhs[index] - value;
+                value = borrow;
+            }
+
+            if(result != lhs)
+            {
+                std::copy(lhs + index, lhs + num, result + index);
+            }
+
+            return value;
+        }
+
+        /** @brief <tt>result = lhs + rhs</tt>, где @c lhs содержит @c lhs_size цифр, а @c rhs --
+        <tt>rhs_size <= lhs_size</tt> цифр. Возвращает перенос
+        */
+        inline big_limb limbs_add(big_limb * result, big_limb const * lhs, std::size_t lhs_size
+                                 , big_limb const * rhs, std::size_t rhs_size)
+        {
+            assert(rhs_size <= lhs_size);
+
+            auto const carry = detail::limbs_add_n(result, lhs, rhs, rhs_size);
+
+            return detail::limbs_add_1(result + rhs_size, lhs + rhs_size, lhs_size - rhs_size
+                                      , carry);
+        }
+
+        /** @brief <tt>result = lhs - rhs</tt>, где @c lhs содержит @c lhs_size цифр, а @c rhs --
+        <tt>rhs_size <= lhs_size</tt> цифр. Возвращает заём
+        */
+        inline big_limb limbs_sub(big_limb * result, big_limb const * lhs, std::size_t lhs_size
+                                 , big_limb const * rhs, std::size_t rhs_size)
+        {
+            assert(rhs_size <= lhs_size);
+
+            auto const borrow = detail::limbs_sub_n(result, lhs, rhs, rhs_size);
+
+            return detail::limbs_sub_1(result + rhs_size, lhs + rhs_size, lhs_size - rhs_size
+                                      , borrow);
+        }
+
+        /// @brief Сравнение двух последовательностей из @c num цифр: -1, 0 или 1
+        inline int limbs_compare_n(big_limb const * lhs, big_limb const * rhs, std::size_t num)
+        {
+            for(; num > 0; --num)
+            {
+                if(lhs[num - 1] != rhs[num - 1])
+                {
+                    return (lhs[num - 1] < rhs[num - 1]) ? -1 : 1;
+                }
+            }
+
+            return 0;
+        }
+
+        /// @brief Количество цифр без старших нулей
+        inline std::size_t limbs_normalized_size(big_limb const * limbs, std::size_t num)
+        {
+            for(; num > 0 && limbs[num - 1] == 0; --num)
+            {}
+
+            return num;
+        }
+
+        // Умножение и деление на одну цифру
+        /// @brief <tt>result = lhs * value</tt> для @c num цифр, возвращает старшую цифру
+        inline big_limb limbs_mul_1(big_limb * result, big_limb const * lhs, std::size_t num
+                                   , big_limb value)
+        {
+            auto carry = big_limb(0);
+
+            for(auto index = std::size_t(0); index < num; ++index)
+            {
+                auto const product = detail::multiply_wide_64(lhs[index], value);
+
+                result[index] = product.low + carry;
+                carry = product.high + (result[index] < carry);
+            }
+
+            return carry;
+        }
+
+        /// @brief <tt>result += lhs * value</tt> для @c num цифр, возвращает старшую цифру
+        inline big_limb limbs_addmul_1(big_limb * result, big_limb const * lhs, std::size_t num
+                                      , big_limb value)
+        {
+            auto carry = big_limb(0);
+
+            for(auto index = std::size_t(0); index < num; ++index)
+            {
+                auto const product = detail::multiply_wide_64(lhs[index], value);
+
+                auto const low = product.low + carry;
+                carry = product.high + (low < carry);
+
+                result[index] += low;
+                carry += (result[index] < low);
+            }
+
+            return carry;
+        }
+
+        /// @brief <tt>result -= lhs * value</tt> для @c num цифр, возвращает заём
+        inline big_limb limbs_submul_1(big_limb * result, big_limb const * lhs, std::size_t num
+                                      , big_limb value)
+        {
+            auto borrow = big_limb(0);
+
+            for(auto index = std::size_t(0); index < num; ++index)
+            {
+                auto const product = detail::multiply_wide_64(lhs[index], value);
+
+                auto const low = product.low + borrow;
+                borrow = product.high + (low < borrow);
+
+                borrow += (result[index] < low);
+                result[index] -= low;
+            }
+
+            return borrow;
+        }
+
+        /// @brief <tt>quotient = lhs / divisor</tt> для @c num цифр, возвращает остаток
+        inline big_limb limbs_divmod_1(big_limb * quotient, big_limb const * lhs, std::size_t num
+                                      , big_limb divisor)
+        {
+            assert(divisor != 0);
+
+            auto remainder = big_limb(0);
+
+            for(; num > 0; --num)
+            {
+                auto const step = detail::divide_wide_64(remainder, lhs[num - 1], divisor);
+
+                quotient[num - 1] = step.quotient;
+                remainder = step.remainder;
+            }
+
+            return remainder;
+        }
+
+        // Умножение
+        /** @brief Школьное умножение: <tt>result = lhs * rhs</tt>
+        @pre @c result содержит <tt>lhs_size + rhs_size</tt> цифр и не пересекается с сомножителями
+        @pre <tt>lhs_size > 0 && rhs_size > 0</tt>
+        */
+        inline void limbs_mul_basecase(big_limb * result, big_limb const * lhs, std::size_t lhs_size
+                                      , big_limb const * rhs, std::size_t rhs_size)
+        {
+            assert(lhs_size > 0 && rhs_size > 0);
+
+            result[lhs_size] = detail::limbs_mul_1(result, lhs, lhs_size, rhs[0]);
+
+            for(auto index = std::size_t(1); index < rhs_size; ++index)
+            {
+                result[lhs_size + index]
+                    = detail::limbs_addmul_1(result + index, lhs, lhs_size, rhs[index]);
+            }
+        }
+
+        /// @brief Размер временного буфера для умножения Карацубы чисел из @c num цифр
+        inline std::size_t karatsuba_scratch_size(std::size_t num)
+        {
+            auto result = std::size_t(0);
+
+            for(; num >= detail::big_karatsuba_threshold; num = (num + 1) / 2)
+            {
+                result += 4 * ((num + 1) / 2);
+            }
+
+            return result;
+        }
+
+        /** @brief Модуль разности <tt>|lhs - rhs|</tt>, где @c lhs содержит @c num цифр, а @c rhs
+        -- <tt>rhs_size <= num</tt> цифр
+        @return @b true, если <tt>lhs < rhs</tt>
+        */
+        inline bool limbs_abs_difference(big_limb * result, big_limb const * lhs, std::size_t num
+                                        , big_limb const * rhs, std::size_t rhs_size)
+        {
+            auto const rhs_is_greater
+                = detail::limbs_normalized_size(lhs + rhs_size, num - rhs_size) == 0
+                && detail::limbs_compare_n(lhs, rhs, rhs_size) < 0;
+
+            if(rhs_is_greater)
+            {
+                detail::limbs_sub_n(result, rhs, lhs, rhs_size);
+                std::fill(result + rhs_size, result + num, big_limb(0));
+            }
+            else
+            {
+                detail::limbs_sub(result, lhs, num, rhs, rhs_size);
+            }
+
+            return rhs_is_greater;
+        }
+
+        /** @brief Умножение Карацубы чисел одинаковой длины: <tt>result = lhs * rhs</tt>
+
+        Вариант с вычитанием: <tt>(a1 B + a0)(b1 B + b0) = a1 b1 B^2 + (a0 b0 + a1 b1 -
+        (a0 - a1)(b0 - b1)) B + a0 b0</tt>, что требует трёх умножений половинной длины.
+
+        @pre @c result содержит <tt>2 * num</tt> цифр и не пересекается с сомножителями
+        @pre @c scratch содержит не менее <tt>karatsuba_scratch_size(num)</tt> цифр
+        */
+        inline void limbs_mul_karatsuba(big_limb * result, big_limb const * lhs
+                                       , big_limb const * rhs, std::size_t num
+                                       , big_limb * scratch)
+        {
+            if(num < detail::big_karatsuba_threshold)
+            {
+                detail::limbs_mul_basecase(result, lhs, num, rhs, num);
+                return;
+            }
+
+            auto const low_size = (num + 1) / 2;
+            auto const high_size = num - low_size;
+
+            auto * const lhs_diff = scratch;
+            auto * const rhs_diff = scratch + low_size;
+            auto * const middle = scratch + 2 * low_size;
+            auto * const next_scratch = scratch + 4 * low_size;
+
+            auto const lhs_negative = detail::limbs_abs_difference(lhs_diff, lhs, low_size
+                                                                  , lhs + low_size, high_size);
+            auto const rhs_negative = detail::limbs_abs_difference(rhs_diff, rhs, low_size
+                                                                  , rhs + low_size, high_size);
+
+            detail::limbs_mul_karatsuba(middle, lhs_diff, rhs_diff, low_size, next_scratch);
+            detail::limbs_mul_karatsuba(result, lhs, rhs, low_size, next_scratch);
+            detail::limbs_mul_karatsuba(result + 2 * low_size, lhs + low_size, rhs + low_size
+                                       , high_size, next_scratch);
+
+            // sum = a0 b0 + a1 b1 занимает 2 * low_size цифр и перенос
+            auto * const sum = scratch;
+            auto carry = detail::limbs_add(sum, result, 2 * low_size
+                                          , result + 2 * low_size, 2 * high_size);
+
+            if(lhs_negative == rhs_negative)
+            {
+                carry -= detail::limbs_sub_n(sum, sum, middle, 2 * low_size);
+            }
+            else
+            {
+                carry += detail::limbs_add_n(sum, sum, middle, 2 * low_size);
+            }
+
+            carry += detail::limbs_add_n(result + low_size, result + low_size, sum, 2 * low_size);
+
+            detail::limbs_add_1(result + 3 * low_size, result + 3 * low_size
+                               , 2 * num - 3 * low_size, carry);
+        }
+
+        /// @brief Простые модули для NTT вида c * 2^40 + 1 и их первообразные корни
+        struct big_ntt_prime
+        {
+            big_limb modulus;
+            big_limb generator;
+        };
+
+        inline constexpr big_ntt_prime big_ntt_primes[] = {{0x7FFF'EF00'0000'0001, 5}
+                                                          , {0x7FFF'E900'0000'0001, 7}
+                                                          , {0x7FFF'E700'0000'0001, 3}};
+
+        /** @brief Теоретико-числовое преобразование по одному простому модулю
+
+        Значения хранятся в обычной (не Монтгомери) форме: умножение на степени корня, хранимые
+        в форме Монтгомери, возвращает результат в обычной форме. Прямое преобразование
+        (прореживание по частоте) выдаёт результат в бит-реверсном порядке, обратное
+        (прореживание по времени) принимает его, поэтому перестановка не нужна.
+        */
+        class big_ntt
+        {
+        public:
+            big_ntt(big_ntt_prime const & prime, std::size_t size)
+             : arithmetic_(prime.modulus)
+             , size_(size)
+             , roots_(size)
+             , inverse_roots_(size)
+            {
+                assert(size >= 2 && (size & (size - 1)) == 0);
+
+                auto const & mont = this->arithmetic_;
+
+                auto const generator = mont.to_montgomery(prime.generator);
+                auto const root = mont.power(generator, (prime.modulus - 1) / size);
+                auto const inverse_root = mont.power(root, prime.modulus - 2);
+
+                // Корни для этапа длины len хранятся с позиции len
+                big_ntt::fill_roots(mont, this->roots_, root);
+                big_ntt::fill_roots(mont, this->inverse_roots_, inverse_root);
+
+                auto const inverse_size = mont.power(mont.to_montgomery(size), prime.modulus - 2);
+
+                // Обратное преобразование компенсирует и множитель 2^(-64) поточечного умножения
+                this->scale_ = mont.to_montgomery(inverse_size);
+            }
+
+            big_limb modulus() const
+            {
+                return this->arithmetic_.modulus();
+            }
+
+            /// @brief Загрузка цифр в массив преобразования с дополнением нулями
+            void load(big_limb * data, big_limb const * limbs, std::size_t num) const
+            {
+                auto const modulus = this->arithmetic_.modulus();
+
+                for(auto index = std::size_t(0); index < num; ++index)
+                {
+                    auto value = limbs[index];
+
+                    for(; value >= modulus;)
+                    {
+                        value -= modulus;
+                    }
+
+                    data[index] = value;
+                }
+
+                std::fill(data + num, data + this->size_, big_limb(0));
+            }
+
+            void forward(big_limb * data) const
+            {
+                auto const & mont = this->arithmetic_;
+
+                for(auto len = this->size_ / 2; len > 0; len /= 2)
+                {
+                    auto const * const roots = this->roots_.data() + len;
+
+                    for(auto first = std::size_t(0); first < this->size_; first += 2 * len)
+                    {
+                        for(auto index = std::size_t(0); index < len; ++index)
+                        {
+                            auto const lhs = data[first + index];
+                            auto const rhs = data[first + index + len];
+
+                            data[first + index] = this->add(lhs, rhs);
+                            data[first + index + len]
+                                = mont.multiply(this->subtract(lhs, rhs), roots[index]);
+                        }
+                    }
+                }
+            }
+
+            /// @brief Поточечное умножение: результат содержит множитель 2^(-64)
+            void multiply(big_limb * data, big_limb const * other) const
+            {
+                for(auto index = std::size_t(0); index < this->size_; ++index)
+                {
+                    data[index] = this->arithmetic_.multiply(data[index], other[index]);
+                }
+            }
+
+            void inverse(big_limb * data) const
+            {
+                auto const & mont = this->arithmetic_;
+
+                for(auto len = std::size_t(1); len < this->size_; len *= 2)
+                {
+                    auto const * const roots = this->inverse_roots_.data() + len;
+
+                    for(auto first = std::size_t(0); first < this->size_; first += 2 * len)
+                    {
+                        for(auto index = std::size_t(0); index < len; ++index)
+                        {
+                            auto const lhs = data[first + index];
+                            auto const rhs = mont.multiply(data[first + index + len], roots[index]);
+
+                            data[first + index] = this->add(lhs, rhs);
+                            data[first + index + len] = this->subtract(lhs, rhs);
+                        }
+                    }
+                }
+
+                for(auto index = std::size_t(0); index < this->size_; ++index)
+                {
+                    data[index] = mont.multiply(data[index], this->scale_);
+                }
+            }
+
+        private:
+            // Модули меньше 2^63, поэтому сумма не переполняется; условные операторы без ветвлений
+            big_limb add(big_limb lhs, big_limb rhs) const
+            {
+                auto const sum = lhs + rhs;
+                auto const modulus = this->arithmetic_.modulus();
+
+                return sum - ((sum >= modulus) ? modulus : 0);
+            }
+
+            big_limb subtract(big_limb lhs, big_limb rhs) const
+            {
+                auto const modulus = this->arithmetic_.modulus();
+
+                return lhs - rhs + ((lhs < rhs) ? modulus : 0);
+            }
+
+            static void fill_roots(saga::montgomery_64 const & mont, std::vector<big_limb> & roots
+                                  , big_limb root)
+            {
+                auto const half = roots.size() / 2;
+
+                auto power = mont.one();
+
+                for(auto index = std::size_t(0); index < half; ++index)
+                {
+                    roots[half + index] = power;
+                    power = mont.multiply(power, root);
+                }
+
+                for(auto len = half / 2; len > 0; len /= 2)
+                {
+                    for(auto index = std::size_t(0); index < len; ++index)
+                    {
+                        roots[len + index] = roots[2 * len + 2 * index];
+                    }
+                }
+            }
+
+            saga::montgomery_64 arithmetic_;
+            std::size_t size_;
+            std::vector<big_limb> roots_;
+            std::vector<big_limb> inverse_roots_;
+            big_limb scale_ = 0;
+        };
+
+        /** @brief Умножение с помощью NTT: <tt>result = lhs * rhs</tt>
+
+        Коэффициенты свёртки меньше <tt>min(lhs_size, rhs_size) * 2^128</tt>, поэтому они
+        однозначно восстанавливаются по остаткам от деления на три 63-битных простых числа
+        (алгоритм Гарнера).
+
+        @pre @c result содержит <tt>lhs_size + rhs_size</tt> цифр и не пересекается с сомножителями
+        */
+        inline void limbs_mul_ntt(big_limb * result, big_limb const * lhs, std::size_t lhs_size
+                                 , big_limb const * rhs, std::size_t rhs_size)
+        {
+            auto const result_size = lhs_size + rhs_size;
+            auto const is_square = (lhs == rhs && lhs_size == rhs_size);
+
+            auto size = std::size_t(2);
+
+            for(; size < result_size;)
+            {
+                size *= 2;
+            }
+
+            std::vector<big_limb> residues[3];
+            std::vector<big_limb> other(is_square ? 0 : size);
+
+            for(auto index = 0; index < 3; ++index)
+            {
+                big_ntt const ntt(detail::big_ntt_primes[index], size);
+
+                auto & data = residues[index];
+                data.resize(size);
+
+                ntt.load(data.data(), lhs, lhs_size);
+                ntt.forward(data.data());
+
+                if(is_square)
+                {
+                    ntt.multiply(data.data(), data.data());
+                }
+                else
+                {
+                    ntt.load(other.data(), rhs, rhs_size);
+                    ntt.forward(other.data());
+                    ntt.multiply(data.data(), other.data());
+                }
+
+                ntt.inverse(data.data());
+            }
+
+            // Алгоритм Гарнера: x = r0 + p0 (y1 + p1 y2)
+            auto const p0 = detail::big_ntt_primes[0].modulus;
+            auto const p1 = detail::big_ntt_primes[1].modulus;
+            auto const p2 = detail::big_ntt_primes[2].modulus;
+
+            saga::montgomery_64 const mont1(p1);
+            saga::montgomery_64 const mont2(p2);
+
+            auto const p0_inverse_1 = mont1.power(mont1.to_montgomery(p0), p1 - 2);
+            auto const p0_inverse_2 = mont2.power(mont2.to_montgomery(p0), p2 - 2);
+            auto const p1_inverse_2 = mont2.power(mont2.to_montgomery(p1), p2 - 2);
+
+            auto const p0_p1 = detail::multiply_wide_64(p0, p1);
+
+            // Накопитель переноса из трёх цифр
+            big_limb accumulator[3] = {0, 0, 0};
+
+            for(auto index = std::size_t(0); index < result_size; ++index)
+            {
+                auto const r0 = residues[0][index];
+                auto const r1 = residues[1][index];
+                auto const r2 = residues[2][index];
+
+                auto const y1 = mont1.multiply(mont1.subtract(r1, r0 % p1), p0_inverse_1);
+
+                auto y2 = mont2.multiply(mont2.subtract(r2, r0 % p2), p0_inverse_2);
+                y2 = mont2.multiply(mont2.subtract(y2, y1 % p2), p1_inverse_2);
+
+                // x = r0 + p0 y1 + p0 p1 y2
+                auto const low_part = detail::multiply_wide_64(p0, y1);
+                auto const high_low = detail::multiply_wide_64(p0_p1.low, y2);
+                auto const high_high = detail::multiply_wide_64(p0_p1.high, y2);
+
+                auto const middle = high_low.high + high_high.low;
+
+                big_limb value[3] = {low_part.low, low_part.high, 0};
+                big_limb const high_part[3] = {high_low.low, middle
+                                              , high_high.high + (middle < high_low.high)};
+
+                detail::limbs_add_1(value, value, 3, r0);
+                detail::limbs_add_n(value, value, high_part, 3);
+                detail::limbs_add_n(accumulator, accumulator, value, 3);
+
+                result[index] = accumulator[0];
+                accumulator[0] = accumulator[1];
+                accumulator[1] = accumulator[2];
+                accumulator[2] = 0;
+            }
+
+            assert(accumulator[0] == 0 && accumulator[1] == 0);
+        }
+
+        /** @brief Умножение с выбором алгоритма по размеру сомножителей
+        @pre @c result содержит <tt>lhs_size + rhs_size</tt> цифр и не пересекается с сомножителями
+        @pre <tt>lhs_size > 0 && rhs_size > 0</tt>
+        */
+        inline void limbs_multiply(big_limb * result, big_limb const * lhs, std::size_t lhs_size
+                                  , big_limb const * rhs, std::size_t rhs_size)
+        {
+            if(lhs_size < rhs_size)
+            {
+                std::swap(lhs, rhs);
+                std::swap(lhs_size, rhs_size);
+            }
+
+            if(rhs_size < detail::big_karatsuba_threshold)
+            {
+                detail::limbs_mul_basecase(result, lhs, lhs_size, rhs, rhs_size);
+                return;
+            }
+
+            if(rhs_size >= detail::big_ntt_threshold)
+            {
+                detail::limbs_mul_ntt(result, lhs, lhs_size, rhs, rhs_size);
+                return;
+            }
+
+            std::vector<big_limb> scratch(detail::karatsuba_scratch_size(rhs_size));
+
+            if(lhs_size == rhs_size)
+            {
+                detail::limbs_mul_karatsuba(result, lhs, rhs, rhs_size, scratch.data());
+                return;
+            }
+
+            // Несбалансированные сомножители: lhs разбивается на части длины rhs_size
+            std::fill(result, result + lhs_size + rhs_size, big_limb(0));
+
+            std::vector<big_limb> product(2 * rhs_size);
+
+            for(auto offset = std::size_t(0); offset < lhs_size; offset += rhs_size)
+            {
+                auto const part_size = std::min(rhs_size, lhs_size - offset);
+
+                if(part_size == rhs_size)
+                {
+                    detail::limbs_mul_karatsuba(product.data(), lhs + offset, rhs, rhs_size
+                                               , scratch.data());
+                }
+                else
+                {
+                    detail::limbs_multiply(product.data(), rhs, rhs_size, lhs + offset, part_size);
+                }
+
+                detail::limbs_add(result + offset, result + offset, lhs_size + rhs_size - offset
+                                 , product.data(), part_size + rhs_size);
+            }
+        }
+
+        // Деление
+        /** @brief Деление столбиком (алгоритм D Д. Кнута): <tt>quotient = lhs / rhs</tt>,
+        <tt>remainder = lhs % rhs</tt>
+        @pre <tt>lhs_size >= rhs_size >= 2</tt>, <tt>rhs[rhs_size - 1] != 0</tt>
+        @pre @c quotient содержит <tt>lhs_size - rhs_size + 1</tt> цифр, @c remainder -- @c rhs_size
+        */
+        inline void limbs_divide_knuth(big_limb * quotient, big_limb * remainder
+                                      , big_limb const * lhs, std::size_t lhs_size
+                                      , big_limb const * rhs, std::size_t rhs_size)
+        {
+            assert(rhs_size >= 2 && lhs_size >= rhs_size);
+            assert(rhs[rhs_size - 1] != 0);
+
+            // Нормализация: старший бит делителя должен быть равен 1
+            auto const shift = detail::countl_zero_64(rhs[rhs_size - 1]);
+
+            auto shift_left = [shift](big_limb * out, big_limb const * in, std::size_t num)
+            {
+                auto carry = big_limb(0);
+
+                for(auto index = std::size_t(0); index < num; ++index)
+                {
+                    out[index] = (in[index] << shift) | carry;
+                    carry = (shift == 0) ? 0 : in[index] >> (64 - shift);
+                }
+
+                return carry;
+            };
+
+            std::vector<big_limb> divisor(rhs_size);
+            std::vector<big_limb> rest(lhs_size + 1);
+
+            shift_left(divisor.data(), rhs, rhs_size);
+            rest[lhs_size] = shift_left(rest.data(), lhs, lhs_size);
+
+            auto const top = divisor[rhs_size - 1];
+            auto const next = divisor[rhs_size - 2];
+
+            for(auto pos = lhs_size - rhs_size + 1; pos > 0; --pos)
+            {
+                auto * const window = rest.data() + (pos - 1);
+
+                auto const high = window[rhs_size];
+                auto const low = window[rhs_size - 1];
+
+                auto estimate = ~big_limb(0);
+                auto estimate_rest = big_limb(0);
+                auto rest_overflow = false;
+
+                if(high < top)
+                {
+                    auto const step = detail::divide_wide_64(high, low, top);
+
+                    estimate = step.quotient;
+                    estimate_rest = step.remainder;
+                }
+                else
+                {
+                    // high == top: оценка равна B - 1, остаток равен low + top
+                    estimate_rest = low + top;
+                    rest_overflow = (estimate_rest < low);
+                }
+
+                for(; !rest_overflow;)
+                {
+                    auto const product = detail::multiply_wide_64(estimate, next);
+
+                    auto const too_big = product.high > estimate_rest
+                                      || (product.high == estimate_rest
+                                          && product.low > window[rhs_size - 2]);
+
+                    if(!too_big)
+                    {
+                        break;
+                    }
+
+                    --estimate;
+                    estimate_rest += top;
+                    rest_overflow = (estimate_rest < top);
+                }
+
+                auto const borrow = detail::limbs_submul_1(window, divisor.data(), rhs_size
+                                                          , estimate);
+
+                if(window[rhs_size] < borrow)
+                {
+                    // Оценка оказалась на единицу больше
+                    --estimate;
+
+                    auto const carry = detail::limbs_add_n(window, window, divisor.data()
+                                                          , rhs_size);
+                    window[rhs_size] += carry - borrow;
+                }
+                else
+                {
+                    window[rhs_size] -= borrow;
+                }
+
+                quotient[pos - 1] = estimate;
+            }
+
+            for(auto index = std::size_t(0); index < rhs_size; ++index)
+            {
+                auto const high_bits = (shift == 0) ? 0 : rest[index + 1] << (64 - shift);
+
+                remainder[index] = (rest[index] >> shift) | high_bits;
+            }
+        }
+    }
+    // namespace detail
+
+    /** @brief Целое число произвольной длины со знаком
+
+    Хранит знак и модуль: последовательность 64-битных цифр от младших к старшим без старших
+    нулей (у нуля цифр нет). Деление, как и для встроенных типов, округляет частное к нулю, а
+    знак остатка совпадает со знаком делимого. Сдвиги применяются к модулю и сохраняют знак.
+
+    Операторы составного присваивания по возможности используют уже выделенную память:
+    сложение, вычитание, сдвиги и умножение на встроенное целое выполняются на месте.
+    */
+    class big_integer
+    {
+        // Равенство и порядок
+        friend bool operator==(big_integer const & lhs, big_integer const & rhs)
+        {
+            return lhs.negative_ == rhs.negative_ && lhs.magnitude_ == rhs.magnitude_;
+        }
+
+        friend bool operator!=(big_integer const & lhs, big_integer const & rhs)
+        {
+            return !(lhs == rhs);
+        }
+
+        friend bool operator<(big_integer const & lhs, big_integer const & rhs)
+        {
+            return big_integer::compare(lhs, rhs) < 0;
+        }
+
+        friend bool operator>(big_integer const & lhs, big_integer const & rhs)
+        {
+            return rhs < lhs;
+        }
+
+        friend bool operator<=(big_integer const & lhs, big_integer const & rhs)
+        {
+            return !(rhs < lhs);
+        }
+
+        friend bool operator>=(big_integer const & lhs, big_integer const & rhs)
+        {
+            return !(lhs < rhs);
+        }
+
+        // Вывод
+        template <class CharT, class Traits>
+        friend std::basic_ostream<CharT, Traits> &
+        operator<<(std::basic_ostream<CharT, Traits> & out, big_integer const & value)
+        {
+            return out << value.to_string().c_str();
+        }
+
+        // Арифметические операции
+        friend big_integer operator-(big_integer value)
+        {
+            value.negate();
+
+            return value;
+        }
+
+        friend big_integer operator+(big_integer lhs, big_integer const & rhs)
+        {
+            lhs += rhs;
+
+            return lhs;
+        }
+
+        friend big_integer operator-(big_integer lhs, big_integer const & rhs)
+        {
+            lhs -= rhs;
+
+            return lhs;
+        }
+
+        friend big_integer operator*(big_integer const & lhs, big_integer const & rhs)
+        {
+            return big_integer::multiply(lhs, rhs);
+        }
+
+        template <class IntType, std::enable_if_t<std::is_integral<IntType>{}> * = nullptr>
+        friend big_integer operator*(big_integer lhs, IntType rhs)
+        {
+            lhs *= rhs;
+
+            return lhs;
+        }
+
+        template <class IntType, std::enable_if_t<std::is_integral<IntType>{}> * = nullptr>
+        friend big_integer operator*(IntType lhs, big_integer rhs)
+        {
+            rhs *= lhs;
+
+            return rhs;
+        }
+
+        friend big_integer operator/(big_integer const & lhs, big_integer const & rhs)
+        {
+            return big_integer::divide(lhs, rhs).first;
+        }
+
+        friend big_integer operator%(big_integer const & lhs, big_integer const & rhs)
+        {
+            return big_integer::divide(lhs, rhs).second;
+        }
+
+        friend big_integer operator<<(big_integer value, std::size_t shift)
+        {
+            value <<= shift;
+
+            return value;
+        }
+
+        friend big_integer operator>>(big_integer value, std::size_t shift)
+        {
+            value >>= shift;
+
+            return value;
+        }
+
+        friend void swap(big_integer & lhs, big_integer & rhs) noexcept
+        {
+            lhs.swap(rhs);
+        }
+
+    public:
+        // Типы
+        using limb_type = detail::big_limb;
+
+        // Создание, копирование, уничтожение
+        big_integer() = default;
+
+        template <class IntType, std::enable_if_t<std::is_integral<IntType>{}> * = nullptr>
+        big_integer(IntType value)
+        {
+            static_assert(sizeof(IntType) <= sizeof(limb_type), "Integer type is too wide");
+
+            using UInt = std::make_unsigned_t<IntType>;
+
+            auto magnitude = static_cast<UInt>(value);
+
+            if constexpr (std::is_signed<IntType>{})
+            {
+                if(value < 0)
+                {
+                    this->negative_ = true;
+                    magnitude = static_cast<UInt>(UInt(0) - magnitude);
+                }
+            }
+
+            if(magnitude != 0)
+            {
+                this->magnitude_.push_back(limb_type(magnitude));
+            }
+        }
+
+        /** @brief Создание из десятичной записи
+        @param str необязательный знак (@c + или @c -) и непустая последовательность десятичных
+        цифр
+        @throw std::invalid_argument, если @c str имеет другой вид
+        */
+        explicit big_integer(std::string_view str)
+        {
+            auto negative = false;
+
+            if(!str.empty() && (str.front() == '-' || str.front() == '+'))
+            {
+                negative = (str.front() == '-');
+                str.remove_prefix(1);
+            }
+
+            auto const is_digit = [](char symbol) { return '0' <= symbol && symbol <= '9'; };
+
+            if(str.empty() || !std::all_of(str.begin(), str.end(), is_digit))
+            {
+                throw std::invalid_argument("big_integer: incorrect decimal number");
+            }
+
+            *this = big_integer::parse_decimal(str);
+            this->negative_ = negative && !this->magnitude_.empty();
+        }
+
+        void swap(big_integer & other) noexcept
+        {
+            this->magnitude_.swap(other.magnitude_);
+            std::swap(this->negative_, other.negative_);
+        }
+
+        // Свойства
+        bool is_negative() const
+        {
+            return this->negative_;
+        }
+
+        explicit operator bool() const
+        {
+            return !this->magnitude_.empty();
+        }
+
+        /// @brief Цифры модуля (по основанию 2^64) от младших к старшим
+        std::vector<limb_type> const & limbs() const
+        {
+            return this->magnitude_;
+        }
+
+        /// @brief Количество битов, необходимых для записи модуля
+        std::size_t bit_width() const
+        {
+            if(this->magnitude_.empty())
+            {
+                return 0;
+            }
+
+            return 64 * this->magnitude_.size() - detail::countl_zero_64(this->magnitude_.back());
+        }
+
+        /// @brief Десятичная запись
+        std::string to_string() const;
+
+        // Арифметические операции
+        void negate()
+        {
+            this->negative_ = !this->negative_ && !this->magnitude_.empty();
+        }
+
+        big_integer & operator+=(big_integer const & rhs)
+        {
+            return this->add(rhs, rhs.negative_);
+        }
+
+        big_integer & operator-=(big_integer const & rhs)
+        {
+            return this->add(rhs, !rhs.negative_);
+        }
+
+        big_integer & operator*=(big_integer const & rhs)
+        {
+            *this = big_integer::multiply(*this, rhs);
+
+            return *this;
+        }
+
+        template <class IntType, std::enable_if_t<std::is_integral<IntType>{}> * = nullptr>
+        big_integer & operator*=(IntType rhs)
+        {
+            static_assert(sizeof(IntType) <= sizeof(limb_type), "Integer type is too wide");
+
+            using UInt = std::make_unsigned_t<IntType>;
+
+            auto magnitude = static_cast<UInt>(rhs);
+
+            if constexpr (std::is_signed<IntType>{})
+            {
+                if(rhs < 0)
+                {
+                    magnitude = static_cast<UInt>(UInt(0) - magnitude);
+                    this->negate();
+                }
+            }
+
+            if(magnitude == 0 || this->magnitude_.empty())
+            {
+                *this = big_integer();
+                return *this;
+            }
+
+            auto const carry = detail::limbs_mul_1(this->magnitude_.data(), this->magnitude_.data()
+                                                  , this->magnitude_.size(), magnitude);
+
+            if(carry != 0)
+            {
+                this->magnitude_.push_back(carry);
+            }
+
+            return *this;
+        }
+
+        big_integer & operator/=(big_integer const & rhs)
+        {
+            *this = big_integer::divide(*this, rhs).first;
+
+            return *this;
+        }
+
+        big_integer & operator%=(big_integer const & rhs)
+        {
+            *this = big_integer::divide(*this, rhs).second;
+
+            return *this;
+        }
+
+        big_integer & operator<<=(std::size_t shift)
+        {
+            if(this->magnitude_.empty())
+            {
+                return *this;
+            }
+
+            auto const limb_shift = shift / 64;
+            auto const bit_shift = static_cast<unsigned>(shift % 64);
+
+            auto const old_size = this->magnitude_.size();
+
+            this->magnitude_.resize(old_size + limb_shift + 1, 0);
+
+            auto * const data = this->magnitude_.data();
+
+            for(auto index = old_size; index > 0; --index)
+            {
+                auto const value = data[index - 1];
+
+                if(bit_shift == 0)
+                {
+                    data[index - 1 + limb_shift] = value;
+                }
+                else
+                {
+                    data[index + limb_shift] |= value >> (64 - bit_shift);
+                    data[index - 1 + limb_shift] = value << bit_shift;
+                }
+            }
+
+            std::fill(data, data + limb_shift, limb_type(0));
+
+            this->normalize();
+
+            return *this;
+        }
+
+        big_integer & operator>>=(std::size_t shift)
+        {
+            auto const limb_shift = shift / 64;
+            auto const bit_shift = static_cast<unsigned>(shift % 64);
+
+            if(limb_shift >= this->magnitude_.size())
+            {
+                *this = big_integer();
+                return *this;
+            }
+
+            auto const new_size = this->magnitude_.size() - limb_shift;
+
+            auto * const data = this->magnitude_.data();
+
+            for(auto index = std::size_t(0); index < new_size; ++index)
+            {
+                auto value = data[index + limb_shift] >> bit_shift;
+
+                if(bit_shift != 0 && index + 1 < new_size)
+                {
+                    value |= data[index + limb_shift + 1] << (64 - bit_shift);
+                }
+
+                data[index] = value;
+            }
+
+            this->magnitude_.resize(new_size);
+            this->normalize();
+
+            return *this;
+        }
+
+    private:
+        // 10^19 -- наибольшая степень 10, помещающаяся в 64 бита
+        static constexpr auto decimal_base = limb_type(10'000'000'000'000'000'000u);
+        static constexpr auto decimal_base_digits = std::size_t(19);
+
+        void normalize()
+        {
+            auto const size = detail::limbs_normalized_size(this->magnitude_.data()
+                                                           , this->magnitude_.size());
+            this->magnitude_.resize(size);
+
+            if(size == 0)
+            {
+                this->negative_ = false;
+            }
+        }
+
+        static int compare_magnitude(std::vector<limb_type> const & lhs
+                                    , std::vector<limb_type> const & rhs)
+        {
+            if(lhs.size() != rhs.size())
+            {
+                return (lhs.size() < rhs.size()) ? -1 : 1;
+            }
+
+            return detail::limbs_compare_n(lhs.data(), rhs.data(), lhs.size());
+        }
+
+        static int compare(big_integer const & lhs, big_integer const & rhs)
+        {
+            if(lhs.negative_ != rhs.negative_)
+            {
+                return lhs.negative_ ? -1 : 1;
+            }
+
+            auto const result = big_integer::compare_magnitude(lhs.magnitude_, rhs.magnitude_);
+
+            return lhs.negative_ ? -result : result;
+        }
+
+        // Прибавление числа с модулем rhs и знаком rhs_negative
+        big_integer & add(big_integer const & rhs, bool rhs_negative)
+        {
+            if(this == &rhs)
+            {
+                auto const copy = rhs;
+
+                return this->add(copy, rhs_negative);
+            }
+
+            auto & lhs = this->magnitude_;
+            auto const & other = rhs.magnitude_;
+
+            if(this->negative_ == rhs_negative || other.empty())
+            {
+                auto const size = std::max(lhs.size(), other.size());
+
+                lhs.resize(size + 1, 0);
+
+                auto const carry = detail::limbs_add(lhs.data(), lhs.data(), size
+                                                    , other.data(), other.size());
+                lhs[size] = carry;
+            }
+            else if(big_integer::compare_magnitude(lhs, other) >= 0)
+            {
+                detail::limbs_sub(lhs.data(), lhs.data(), lhs.size(), other.data(), other.size());
+            }
+            else
+            {
+                // |rhs| > |lhs|: lhs = rhs - lhs, знак меняется
+                lhs.resize(other.size(), 0);
+
+                detail::limbs_sub_n(lhs.data(), other.data(), lhs.data(), other.size());
+
+                this->negative_ = rhs_negative;
+            }
+
+            this->normalize();
+
+            return *this;
+        }
+
+        static big_integer multiply(big_integer const & lhs, big_integer const & rhs)
+        {
+            big_integer result;
+
+            if(lhs.magnitude_.empty() || rhs.magnitude_.empty())
+            {
+                return result;
+            }
+
+            auto const lhs_size = lhs.magnitude_.size();
+            auto const rhs_size = rhs.magnitude_.size();
+
+            result.magnitude_.resize(lhs_size + rhs_size);
+
+            detail::limbs_multiply(result.magnitude_.data(), lhs.magnitude_.data(), lhs_size
+                                  , rhs.magnitude_.data(), rhs_size);
+
+            result.negative_ = (lhs.negative_ != rhs.negative_);
+            result.normalize();
+
+            return result;
+        }
+
+        // Деление
+        struct normalized_divisor;
+
+        using decimal_power = normalized_divisor;
+
+        /// @brief B^num, где B = 2^64
+        static big_integer power_of_base(std::size_t num)
+        {
+            big_integer result;
+
+            result.magnitude_.assign(num + 1, 0);
+            result.magnitude_.back() = 1;
+
+            return result;
+        }
+
+        // Частное и остаток модулей, делитель не равен нулю
+        static void divide_magnitude(std::vector<limb_type> const & lhs
+                                    , std::vector<limb_type> const & rhs
+                                    , big_integer & quotient, big_integer & remainder)
+        {
+            assert(!rhs.empty());
+
+            quotient = big_integer();
+            remainder = big_integer();
+
+            if(big_integer::compare_magnitude(lhs, rhs) < 0)
+            {
+                remainder.magnitude_ = lhs;
+                return;
+            }
+
+            auto const lhs_size = lhs.size();
+            auto const rhs_size = rhs.size();
+
+            quotient.magnitude_.resize(lhs_size - rhs_size + 1);
+
+            if(rhs_size == 1)
+            {
+                auto const rest = detail::limbs_divmod_1(quotient.magnitude_.data(), lhs.data()
+                                                        , lhs_size, rhs.front());
+                if(rest != 0)
+                {
+                    remainder.magnitude_.push_back(rest);
+                }
+            }
+            else
+            {
+                remainder.magnitude_.resize(rhs_size);
+
+                detail::limbs_divide_knuth(quotient.magnitude_.data(), remainder.magnitude_.data()
+                                          , lhs.data(), lhs_size, rhs.data(), rhs_size);
+            }
+
+            quotient.normalize();
+            remainder.normalize();
+        }
+
+        /** @brief <tt>floor(B^(2n) / divisor)</tt> методом Ньютона
+        @pre @c divisor нормализован и содержит n цифр
+
+        Обратное к старшим <tt>n / 2 + 2</tt> цифрам делителя вычисляется рекурсивно, затем одна
+        итерация Ньютона удваивает точность, а оставшаяся погрешность в несколько единиц
+        устраняется поправками.
+        */
+        static big_integer reciprocal(big_integer const & divisor)
+        {
+            auto const size = divisor.magnitude_.size();
+
+            auto const power = big_integer::power_of_base(2 * size);
+
+            if(size < detail::big_division_threshold)
+            {
+                big_integer quotient;
+                big_integer remainder;
+
+                big_integer::divide_magnitude(power.magnitude_, divisor.magnitude_
+                                             , quotient, remainder);
+
+                return quotient;
+            }
+
+            auto const part = size / 2 + 2;
+            auto const dropped = 64 * (size - part);
+
+            auto result = big_integer::reciprocal(divisor >> dropped) << dropped;
+
+            // Итерация Ньютона: v += v (B^(2n) - d v) / B^(2n)
+            auto error = power - divisor * result;
+
+            auto correction = result * error;
+            correction.negative_ = false;
+            correction >>= 128 * size;
+
+            if(error.negative_)
+            {
+                correction += 1;
+                result -= correction;
+                error += divisor * correction;
+            }
+            else
+            {
+                result += correction;
+                error -= divisor * correction;
+            }
+
+            for(; error.negative_;)
+            {
+                result -= 1;
+                error += divisor;
+            }
+
+            for(; error >= divisor;)
+            {
+                result += 1;
+                error -= divisor;
+            }
+
+            return result;
+        }
+
+        /** @brief Деление числа не более чем из 2n цифр, меньшего <tt>divisor * B^n</tt>, на
+        нормализованный делитель из n цифр с помощью приближённого обратного
+        */
+        static std::pair<big_integer, big_integer>
+        divide_block(big_integer current, normalized_divisor const & divisor);
+
+        /** @brief Деление неотрицательного числа на нормализованный делитель
+
+        Длинное делимое обрабатывается блоками из n цифр, начиная со старших, как при делении
+        столбиком, но каждая "цифра" частного содержит n цифр и находится умножением.
+        */
+        static std::pair<big_integer, big_integer>
+        divide(big_integer const & lhs, normalized_divisor const & divisor);
+
+        static std::pair<big_integer, big_integer>
+        divide(big_integer const & lhs, big_integer const & rhs);
+
+        // Перевод в десятичную систему и обратно
+        /** @brief Запись неотрицательного числа <tt>value < 10^(19 * 2^level)</tt>
+        @param powers степени <tt>powers[k] = 10^(19 * 2^k)</tt>
+        @param pad дополнять ли запись ведущими нулями до <tt>19 * 2^level</tt> цифр
+        */
+        static void write_decimal(std::string & out, big_integer const & value
+                                 , std::vector<decimal_power> const & powers, std::size_t level
+                                 , bool pad);
+
+        // Квадратичный перевод: последовательное деление на 10^19
+        static void write_decimal_basecase(std::string & out, big_integer const & value
+                                          , std::size_t width)
+        {
+            std::vector<limb_type> chunks;
+
+            auto rest = value.magnitude_;
+
+            for(auto size = rest.size(); size > 0;)
+            {
+                chunks.push_back(detail::limbs_divmod_1(rest.data(), rest.data(), size
+                                                       , decimal_base));
+
+                size = detail::limbs_normalized_size(rest.data(), size);
+            }
+
+            std::string digits;
+
+            for(auto pos = chunks.size(); pos > 0; --pos)
+            {
+                auto chunk = std::to_string(chunks[pos - 1]);
+
+                if(pos != chunks.size())
+                {
+                    digits.append(decimal_base_digits - chunk.size(), '0');
+                }
+
+                digits += chunk;
+            }
+
+            if(digits.empty() && width == 0)
+            {
+                digits = "0";
+            }
+
+            if(digits.size() < width)
+            {
+                out.append(width - digits.size(), '0');
+            }
+
+            out += digits;
+        }
+
+        /// @brief Число по строке десятичных цифр
+        static big_integer parse_decimal(std::string_view digits)
+        {
+            auto const basecase_digits = decimal_base_digits * detail::big_conversion_threshold;
+
+            if(digits.size() <= basecase_digits)
+            {
+                return big_integer::parse_decimal_basecase(digits);
+            }
+
+            // Степени 10^(19 * 2^k), меньшие длины строки
+            std::vector<big_integer> powers(1, big_integer(decimal_base));
+
+            for(; (decimal_base_digits << powers.size()) < digits.size();)
+            {
+                powers.push_back(powers.back() * powers.back());
+            }
+
+            return big_integer::parse_decimal(digits, powers, powers.size() - 1);
+        }
+
+        // Число по строке из не более чем 19 * 2^(level + 1) цифр
+        static big_integer parse_decimal(std::string_view digits
+                                        , std::vector<big_integer> const & powers
+                                        , std::size_t level)
+        {
+            auto const low_size = decimal_base_digits << level;
+
+            if(digits.size() <= decimal_base_digits * detail::big_conversion_threshold)
+            {
+                return big_integer::parse_decimal_basecase(digits);
+            }
+
+            if(digits.size() <= low_size)
+            {
+                return big_integer::parse_decimal(digits, powers, level - 1);
+            }
+
+            auto const split = digits.size() - low_size;
+
+            auto result = big_integer::parse_decimal(digits.substr(0, split), powers, level - 1);
+            result *= powers[level];
+            result += big_integer::parse_decimal(digits.substr(split), powers, level - 1);
+
+            return result;
+        }
+
+        // Квадратичный перевод: умножение на 10^19 и прибавление очередных 19 цифр
+        static big_integer parse_decimal_basecase(std::string_view digits)
+        {
+            big_integer result;
+
+            auto const head = digits.size() % decimal_base_digits;
+            auto first = std::size_t(0);
+            auto last = (head == 0) ? decimal_base_digits : head;
+
+            for(; first < digits.size(); first = last, last += decimal_base_digits)
+            {
+                auto chunk = limb_type(0);
+
+                for(auto pos = first; pos < last; ++pos)
+                {
+                    chunk = chunk * 10 + limb_type(digits[pos] - '0');
+                }
+
+                auto & limbs = result.magnitude_;
+
+                auto carry = detail::limbs_mul_1(limbs.data(), limbs.data(), limbs.size()
+                                                , decimal_base);
+                carry += detail::limbs_add_1(limbs.data(), limbs.data(), limbs.size(), chunk);
+
+                if(carry != 0)
+                {
+                    limbs.push_back(carry);
+                }
+            }
+
+            result.normalize();
+
+            return result;
+        }
+
+        std::vector<limb_type> magnitude_;
+        bool negative_ = false;
+    };
+
+    /** @brief Нормализованный делитель: сдвинутый так, что старший бит старшей цифры равен 1,
+    вместе с приближённым обратным <tt>floor(B^(2n) / value)</tt>, где n -- число цифр
+
+    Обратное вычисляется только для длинных делителей и позволяет делить с помощью быстрого
+    умножения. Повторное использование делителя (например, при переводе в десятичную систему)
+    избавляет от повторного вычисления обратного.
+    */
+    struct big_integer::normalized_divisor
+    {
+        explicit normalized_divisor(big_integer divisor)
+         : original(std::move(divisor))
+         , shift(detail::countl_zero_64(this->original.magnitude_.back()))
+         , value(this->original << this->shift)
+         , inverse(this->value.magnitude_.size() < detail::big_division_threshold
+                   ? big_integer() : big_integer::reciprocal(this->value))
+        {}
+
+        big_integer original;
+        unsigned shift;
+        big_integer value;
+        big_integer inverse;
+    };
+
+    inline std::string big_integer::to_string() const
+    {
+        if(this->magnitude_.empty())
+        {
+            return "0";
+        }
+
+        auto value = *this;
+        value.negative_ = false;
+
+        // Степени 10^(19 * 2^k), пока квадрат последней не превзойдёт модуль числа
+        std::vector<decimal_power> powers;
+
+        if(value.magnitude_.size() >= detail::big_conversion_threshold)
+        {
+            auto power = big_integer(decimal_base);
+
+            for(;;)
+            {
+                auto const is_last = value.bit_width() <= 2 * (power.bit_width() - 1);
+
+                powers.emplace_back(power);
+
+                if(is_last)
+                {
+                    break;
+                }
+
+                power = power * power;
+            }
+        }
+
+        std::string result(this->negative_ ? "-" : "");
+
+        big_integer::write_decimal(result, value, powers, powers.size(), false);
+
+        return result;
+    }
+
+    inline std::pair<big_integer, big_integer>
+    big_integer::divide_block(big_integer current, normalized_divisor const & divisor)
+    {
+        auto const size = divisor.value.magnitude_.size();
+
+        auto quotient = ((current >> (64 * (size - 1))) * divisor.inverse) >> (64 * (size + 1));
+
+        current -= quotient * divisor.value;
+
+        // Оценка частного занижена не более чем на несколько единиц
+        for(; current >= divisor.value;)
+        {
+            quotient += 1;
+            current -= divisor.value;
+        }
+
+        return {std::move(quotient), std::move(current)};
+    }
+
+    inline std::pair<big_integer, big_integer>
+    big_integer::divide(big_integer const & lhs, normalized_divisor const & divisor)
+    {
+        auto const size = divisor.value.magnitude_.size();
+
+        if(divisor.inverse.magnitude_.empty()
+           || lhs.magnitude_.size() < size + detail::big_division_threshold)
+        {
+            std::pair<big_integer, big_integer> result;
+
+            big_integer::divide_magnitude(lhs.magnitude_, divisor.original.magnitude_
+                                         , result.first, result.second);
+
+            return result;
+        }
+
+        auto const shifted = lhs << divisor.shift;
+        auto const & limbs = shifted.magnitude_;
+
+        auto const blocks = (limbs.size() + size - 1) / size;
+
+        big_integer quotient;
+        quotient.magnitude_.assign(blocks * size, 0);
+
+        big_integer rest;
+
+        for(auto block = blocks; block > 0; --block)
+        {
+            auto const first = (block - 1) * size;
+            auto const last = std::min(limbs.size(), first + size);
+
+            // current = rest * B^n + цифры блока
+            big_integer current;
+            current.magnitude_.assign(size + rest.magnitude_.size(), 0);
+
+            std::copy(limbs.begin() + first, limbs.begin() + last, current.magnitude_.begin());
+            std::copy(rest.magnitude_.begin(), rest.magnitude_.end()
+                     , current.magnitude_.begin() + size);
+            current.normalize();
+
+            auto part = big_integer::divide_block(std::move(current), divisor);
+
+            std::copy(part.first.magnitude_.begin(), part.first.magnitude_.end()
+                     , quotient.magnitude_.begin() + first);
+
+            rest = std::move(part.second);
+        }
+
+        quotient.normalize();
+        rest >>= divisor.shift;
+
+        return {std::move(quotient), std::move(rest)};
+    }
+
+    inline std::pair<big_integer, big_integer>
+    big_integer::divide(big_integer const & lhs, big_integer const & rhs)
+    {
+        assert(!rhs.magnitude_.empty());
+
+        std::pair<big_integer, big_integer> result;
+
+        auto const large = rhs.magnitude_.size() >= detail::big_division_threshold
+                        && lhs.magnitude_.size()
+                           >= rhs.magnitude_.size() + detail::big_division_threshold;
+
+        if(large)
+        {
+            auto abs_lhs = lhs;
+            abs_lhs.negative_ = false;
+
+            auto abs_rhs = rhs;
+            abs_rhs.negative_ = false;
+
+            result = big_integer::divide(abs_lhs, normalized_divisor(std::move(abs_rhs)));
+        }
+        else
+        {
+            big_integer::divide_magnitude(lhs.magnitude_, rhs.magnitude_
+                                         , result.first, result.second);
+        }
+
+        result.first.negative_ = (lhs.negative_ != rhs.negative_);
+        result.second.negative_ = lhs.negative_;
+
+        result.first.normalize();
+        result.second.normalize();
+
+        return result;
+    }
+
+    inline void big_integer::write_decimal(std::string & out, big_integer const & value
+                                          , std::vector<decimal_power> const & powers
+                                          , std::size_t level, bool pad)
+    {
+        if(level == 0 || value.magnitude_.size() < detail::big_conversion_threshold)
+        {
+            auto const width = pad ? decimal_base_digits << level : std::size_t(0);
+
+            big_integer::write_decimal_basecase(out, value, width);
+            return;
+        }
+
+        auto const parts = big_integer::divide(value, powers[level - 1]);
+
+        if(pad || parts.first)
+        {
+            big_integer::write_decimal(out, parts.first, powers, level - 1, pad);
+            big_integer::write_decimal(out, parts.second, powers, level - 1, true);
+        }
+        else
+        {
+            big_integer::write_decimal(out, parts.second, powers, level - 1, false);
+        }
+    }
+
+    /** @brief Факториал числа в виде big_integer
+
+    Сомножители перемножаются по дереву: произведения соседних поддиапазонов имеют близкие
+    длины, что позволяет использовать быстрое умножение.
+    */
+    struct big_factorial_fn
+    {
+    public:
+        big_integer operator()(std::uint64_t num) const
+        {
+            if(num < 2)
+            {
+                return big_integer(1);
+            }
+
+            return big_factorial_fn::product(2, num + 1);
+        }
+
+    private:
+        // Произведение чисел из [first, last)
+        static big_integer product(std::uint64_t first, std::uint64_t last)
+        {
+            if(last - first <= 16)
+            {
+                auto result = big_integer(1);
+
+                for(auto num = first; num < last; ++num)
+                {
+                    result *= num;
+                }
+
+                return result;
+            }
+
+            auto const middle = first + (last - first) / 2;
+
+            return big_factorial_fn::product(first, middle)
+                   * big_factorial_fn::product(middle, last);
+        }
+    };
+
+    inline constexpr auto const big_factorial = big_factorial_fn{};
+}
+// namespace saga
+
+#endif
+// Z_SAGA_NUMERIC_BIG_INTEGER_HPP_INCLUDED
@@ -0,0 +1,216 @@
+/* (c) 2026 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки SAGA.
+
+SAGA -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#ifndef Z_SAGA_NUMERIC_FACTORIZE_HPP_INCLUDED
+#define Z_SAGA_NUMERIC_FACTORIZE_HPP_INCLUDED
+
+/** @file saga/numeric/factorize.hpp
+ @brief Разложение на простые множители чисел, помещающихся в 64 бита
+
+ Малые простые множители отделяются пробным делением, простота оставшихся множителей
+ проверяется тестом Миллера-Рабина, а составные множители расщепляются ро-методом Полларда в
+ варианте Брента.
+*/
+
+#include <saga/numeric/is_prime.hpp>
+#include <saga/numeric/montgomery.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+namespace saga
+{
+    template <class IntType>
+    struct prime_power
+    {
+        IntType prime;
+        IntType exponent;
+
+        friend constexpr bool operator==(prime_power const & lhs, prime_power const & rhs)
+        {
+            return lhs.prime == rhs.prime && lhs.exponent == rhs.exponent;
+        }
+
+        friend constexpr bool operator!=(prime_power const & lhs, prime_power const & rhs)
+        {
+            return !(lhs == rhs);
+        }
+    };
+
+    /** @brief Нетривиальный делитель нечётного составного числа: ро-метод Полларда-Брента
+
+    Последовательность x -> x^2 + c вычисляется в форме Монтгомери, наибольший общий делитель
+    вычисляется один раз для произведения разностей нескольких последовательных шагов.
+    */
+    struct pollard_brent_fn
+    {
+        /**
+        @pre @c num нечётно и составное
+        */
+        std::uint64_t operator()(std::uint64_t num) const
+        {
+            assert(num % 2 == 1 && num > 1);
+            assert(!saga::is_prime(num));
+
+            auto const mont = saga::montgomery_64(num);
+
+            constexpr auto batch = std::uint64_t(128);
+
+            for(auto increment = std::uint64_t(1);; ++increment)
+            {
+                auto const c = mont.to_montgomery(increment);
+                auto const step = [&mont, c](std::uint64_t value)
+                {
+                    return mont.add(mont.multiply(value, value), c);
+                };
+
+                auto y = mont.to_montgomery(2);
+                auto x = y;
+                auto saved = y;
+                auto product = mont.one();
+                auto divisor = std::uint64_t(1);
+
+                for(auto length = std::uint64_t(1); divisor == 1; length *= 2)
+                {
+                    x = y;
+
+                    for(auto index = std::uint64_t(0); index < length; ++index)
+                    {
+                        y = step(y);
+                    }
+
+                    for(auto done = std::uint64_t(0); done < length && divisor == 1; done += batch)
+                    {
+                        saved = y;
+
+                        auto const count = std::min(batch, length - done);
+
+                        for(auto index = std::uint64_t(0); index < count; ++index)
+                        {
+                            y = step(y);
+                            product = mont.multiply(product, (x > y) ? x - y : y - x);
+                        }
+
+                        divisor = std::gcd(product, num);
+                    }
+                }
+
+                if(divisor == num)
+                {
+                    // Произведение обнулилось: повторяем последнюю порцию по одному шагу
+                    divisor = 1;
+
+                    for(; divisor == 1;)
+                    {
+                        saved = step(saved);
+                        divisor = std::gcd((x > saved) ? x - saved : saved - x, num);
+                    }
+                }
+
+                if(divisor != num)
+                {
+                    return divisor;
+                }
+            }
+        }
+    };
+
+    /** @brief Разложение на простые множители
+    @pre <tt>num > 0</tt>
+    @return Простые делители числа @c num в порядке возрастания вместе с их кратностями
+    */
+    struct factorize_fn
+    {
+    public:
+        template <class IntType>
+        std::vector<prime_power<IntType>>
+        operator()(IntType const & num) const
+        {
+            static_assert(std::is_integral<IntType>{} && sizeof(IntType) <= sizeof(std::uint64_t)
+                          , "Integral type no wider than 64 bits expected");
+
+            assert(num > 0);
+
+            std::vector<std::uint64_t> primes;
+            factorize_fn::collect(std::uint64_t(num), primes);
+
+            std::sort(primes.begin(), primes.end());
+
+            std::vector<prime_power<IntType>> result;
+
+            for(auto const & prime : primes)
+            {
+                if(!result.empty() && result.back().prime == IntType(prime))
+                {
+                    ++result.back().exponent;
+                }
+                else
+                {
+                    result.push_back({IntType(prime), IntType(1)});
+                }
+            }
+
+            return result;
+        }
+
+    private:
+        static void collect(std::uint64_t num, std::vector<std::uint64_t> & primes)
+        {
+            for(auto prime = std::uint64_t(2); prime < 64 && prime * prime <= num;
+                prime += (prime == 2) ? 1 : 2)
+            {
+                for(; num % prime == 0; num /= prime)
+                {
+                    primes.push_back(prime);
+                }
+            }
+
+            factorize_fn::collect_large(num, primes);
+        }
+
+        // @pre num не имеет делителей, меньших 64
+        static void collect_large(std::uint64_t num, std::vector<std::uint64_t> & primes)
+        {
+            if(num == 1)
+            {
+                return;
+            }
+
+            if(saga::is_prime(num))
+            {
+                primes.push_back(num);
+                return;
+            }
+
+            auto const divisor = pollard_brent_fn{}(num);
+
+            factorize_fn::collect_large(divisor, primes);
+            factorize_fn::collect_large(num / divisor, primes);
+        }
+    };
+
+    inline constexpr auto const pollard_brent = pollard_brent_fn{};
+    inline constexpr auto const factorize = factorize_fn{};
+}
+// namespace saga
+
+#endif
+// Z_SAGA_NUMERIC_FACTORIZE_HPP_INCLUDED
@@ -23,6 +23,10 @@ SAGA -- это свободной программное обеспечение:
 #include <saga/cursor/take_while.hpp>
 #include <saga/defs.hpp>
 #include <saga/math.hpp>
+#include <saga/numeric/montgomery.hpp>
+
+#include <cstdint>
+#include <type_traits>
 
 namespace saga
 {
@@ -47,6 +51,92 @@ namespace saga
 
         return saga::none_of(std::move(cur), [&](auto const & arg){ return num % arg == 0;});
     }
+
+    /** @brief Детерминированный тест Миллера-Рабина для чисел, помещающихся в 64 бита
+
+    После пробного деления на простые числа, меньшие 40, выполняется проверка по семи основаниям,
+    которых достаточно для всех чисел, меньших 2^64. Умножения выполняются в форме Монтгомери.
+    */
+    struct is_prime_fn
+    {
+    public:
+        template <class IntType>
+        constexpr bool operator()(IntType const & num) const
+        {
+            static_assert(std::is_integral<IntType>{} && sizeof(IntType) <= sizeof(std::uint64_t)
+                          , "Integral type no wider than 64 bits expected");
+
+            if(num < IntType(2))
+            {
+                return false;
+            }
+
+            return is_prime_fn::test(std::uint64_t(num));
+        }
+
+    private:
+        static constexpr bool test(std::uint64_t num)
+        {
+            constexpr std::uint64_t small_primes[] = {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37};
+
+            for(auto const & prime : small_primes)
+            {
+                if(num % prime == 0)
+                {
+                    return num == prime;
+                }
+            }
+
+            if(num < 41 * 41)
+            {
+                return true;
+            }
+
+            constexpr std::uint64_t bases[]
+                = {2, 325, 9'375, 28'178, 450'775, 9'780'504, 1'795'265'022};
+
+            auto const mont = saga::montgomery_64(num);
+            auto odd_part = num - 1;
+            auto power_of_two = 0;
+            for(; odd_part % 2 == 0; odd_part /= 2)
+            {
+                ++power_of_two;
+            }
+
+            auto const one = mont.one();
+            auto const minus_one = mont.negate(one);
+
+            for(auto const & base : bases)
+            {
+                if(base % num == 0)
+                {
+                    continue;
+                }
+
+                auto value = mont.power(mont.to_montgomery(base), odd_part);
+
+                if(value == one || value == minus_one)
+                {
+                    continue;
+                }
+
+                auto index = 1;
+                for(; index < power_of_two && value != minus_one; ++index)
+                {
+                    value = mont.multiply(value, value);
+                }
+
+                if(value != minus_one)
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+    };
+
+    inline constexpr auto const is_prime = is_prime_fn{};
 }
 
 #endif
@@ -0,0 +1,400 @@
+/* (c) 2026 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки SAGA.
+
+SAGA -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#ifndef Z_SAGA_NUMERIC_LINEAR_SIEVE_HPP_INCLUDED
+#define Z_SAGA_NUMERIC_LINEAR_SIEVE_HPP_INCLUDED
+
+/** @file saga/numeric/linear_sieve.hpp
+ @brief Линейное решето (решето Эйлера) и таблицы мультипликативных функций
+
+ Каждое составное число вычёркивается ровно один раз -- своим наименьшим простым делителем,
+ поэтому за один проход, требующий O(n) операций, можно заполнить таблицы наименьших простых
+ делителей, функции Эйлера, функции Мёбиуса, количества и суммы делителей.
+*/
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace saga
+{
+    /// @brief Флаги таблиц, заполняемых линейным решетом
+    namespace linear_sieve_tables
+    {
+        inline constexpr unsigned smallest_prime_factor = 1u << 0;
+        inline constexpr unsigned euler_phi = 1u << 1;
+        inline constexpr unsigned moebius = 1u << 2;
+        inline constexpr unsigned divisor_count = 1u << 3;
+        inline constexpr unsigned divisor_sum = 1u << 4;
+
+        inline constexpr unsigned all
+            = smallest_prime_factor | euler_phi | moebius | divisor_count | divisor_sum;
+    }
+    // namespace linear_sieve_tables
+
+    namespace detail
+    {
+        /** @brief Заполнение таблиц линейным решетом для чисел, меньших @c n_max
+        @param primes контейнер, в который добавляются найденные простые числа
+        @param marks одна из заполняемых таблиц, кроме таблицы функции Мёбиуса, с нулевыми
+        начальными значениями: нулевое значение в ней означает, что число ещё не вычеркнуто, то
+        есть является простым
+        @param first_factors, phi, mu, d_count, d_sum таблицы наименьших простых делителей, функции
+        Эйлера, функции Мёбиуса, количества и суммы делителей. Нулевые указатели соответствуют
+        незапрошенным таблицам.
+
+        Если таблица наименьших простых делителей не запрошена, то для определения того, делит ли
+        простое число текущее, используется деление с остатком. Это медленнее, но позволяет не
+        выделять память под таблицу, которая не нужна вызывающей стороне.
+        */
+        template <class Value, class Sum, class Prime, class Mark>
+        void linear_sieve_fill(std::size_t n_max, std::vector<Prime> & primes
+                              , Mark const * marks, Value * first_factors, Value * phi
+                              , std::int8_t * mu, Value * d_count, Sum * d_sum)
+        {
+            assert(marks != nullptr || n_max < 2);
+
+            // Показатель и сумма делителей степени наименьшего простого делителя
+            std::vector<std::uint8_t> exponents(d_count ? n_max : 0, 0);
+            std::vector<Sum> prime_power_sums(d_sum ? n_max : 0, Sum(0));
+
+            auto * const exps = exponents.empty() ? nullptr : exponents.data();
+            auto * const pp_sums = prime_power_sums.empty() ? nullptr : prime_power_sums.data();
+
+            if(n_max > 1)
+            {
+                if(first_factors)
+                {
+                    first_factors[1] = Value(1);
+                }
+
+                if(phi)
+                {
+                    phi[1] = Value(1);
+                }
+
+                if(mu)
+                {
+                    mu[1] = 1;
+                }
+
+                if(d_count && exps)
+                {
+                    d_count[1] = Value(1);
+                    exps[1] = 0;
+                }
+
+                if(d_sum && pp_sums)
+                {
+                    d_sum[1] = Sum(1);
+                    pp_sums[1] = Sum(1);
+                }
+            }
+
+            for(auto num = std::size_t(2); num < n_max; ++num)
+            {
+                if(marks[num] == 0)
+                {
+                    primes.push_back(Prime(num));
+
+                    if(first_factors)
+                    {
+                        first_factors[num] = Value(num);
+                    }
+
+                    if(phi)
+                    {
+                        phi[num] = Value(num - 1);
+                    }
+
+                    if(mu)
+                    {
+                        mu[num] = -1;
+                    }
+
+                    if(d_count && exps)
+                    {
+                        d_count[num] = Value(2);
+                        exps[num] = 1;
+                    }
+
+                    if(d_sum && pp_sums)
+                    {
+                        d_sum[num] = Sum(num + 1);
+                        pp_sums[num] = Sum(num + 1);
+                    }
+                }
+
+                for(auto const & prime : primes)
+                {
+                    auto const product = num * prime;
+
+                    if(product >= n_max)
+                    {
+                        break;
+                    }
+
+                    auto const divides = first_factors ? Value(prime) == first_factors[num]
+                                                       : num % prime == 0;
+
+                    if(first_factors)
+                    {
+                        first_factors[product] = Value(prime);
+                    }
+
+                    if(divides)
+                    {
+                        // prime делит num: показатель наименьшего простого делителя растёт
+                        if(phi)
+                        {
+                            phi[product] = Value(phi[num] * prime);
+                        }
+
+                        if(d_count && exps)
+                        {
+                            auto const exponent = exps[num];
+
+                            exps[product] = std::uint8_t(exponent + 1);
+                            d_count[product] = Value(d_count[num] / (exponent + 1)
+                                                     * (exponent + 2));
+                        }
+
+                        if(d_sum && pp_sums)
+                        {
+                            auto const power_sum = Sum(pp_sums[num] * prime + 1);
+
+                            pp_sums[product] = power_sum;
+                            d_sum[product] = Sum(d_sum[num] / pp_sums[num] * power_sum);
+                        }
+
+                        break;
+                    }
+
+                    // prime взаимно просто с num: функции мультипликативны
+                    if(phi)
+                    {
+                        phi[product] = Value(phi[num] * (prime - 1));
+                    }
+
+                    if(mu)
+                    {
+                        mu[product] = std::int8_t(-mu[num]);
+                    }
+
+                    if(d_count && exps)
+                    {
+                        exps[product] = 1;
+                        d_count[product] = Value(d_count[num] * 2);
+                    }
+
+                    if(d_sum && pp_sums)
+                    {
+                        pp_sums[product] = Sum(Sum(prime) + 1);
+                        d_sum[product] = Sum(d_sum[num] * (prime + 1));
+                    }
+                }
+            }
+        }
+    }
+    // namespace detail
+
+    /** @brief Линейное решето, заполняющее таблицы для чисел, меньших заданной границы
+
+    Таблицы, которые не были запрошены, остаются пустыми. Для чисел 0 и 1 таблицы содержат:
+    наименьший простой делитель 0 и 1, функция Эйлера 0 и 1, функция Мёбиуса 0 и 1, количество
+    делителей 0 и 1, сумма делителей 0 и 1.
+
+    @tparam UInt беззнаковый тип элементов таблиц простых чисел, наименьших простых делителей,
+    функции Эйлера и количества делителей. Суммы делителей хранятся в 64-битном типе.
+    */
+    template <class UInt = std::uint32_t>
+    class linear_sieve
+    {
+        static_assert(std::numeric_limits<UInt>::is_integer && !std::numeric_limits<UInt>::is_signed
+                      , "Unsigned integral type expected");
+
+    public:
+        // Типы
+        using value_type = UInt;
+        using sum_type = std::uint64_t;
+
+        // Создание, копирование, уничтожение
+        /** @brief Конструктор
+        @param n_max верхняя граница (не включается) чисел, для которых заполняются таблицы
+        @param tables набор флагов из saga::linear_sieve_tables
+        @pre <tt>n_max - 1</tt> представимо в типе @c UInt
+        */
+        linear_sieve(std::size_t n_max, unsigned tables)
+        {
+            assert(n_max == 0 || n_max - 1 <= std::numeric_limits<UInt>::max());
+
+            namespace flags = saga::linear_sieve_tables;
+
+            // Таблица наименьших простых делителей нужна для определения простоты, если не
+            // запрошено ни одной другой таблицы, где простые числа отмечены нулём
+            auto const marked_tables = flags::euler_phi | flags::divisor_count | flags::divisor_sum;
+            auto const has_marks = (tables & marked_tables) != 0;
+
+            if((tables & flags::smallest_prime_factor) || !has_marks)
+            {
+                this->smallest_prime_factor_.assign(n_max, 0);
+            }
+
+            if(tables & flags::euler_phi)
+            {
+                this->euler_phi_.assign(n_max, 0);
+            }
+
+            if(tables & flags::moebius)
+            {
+                this->moebius_.assign(n_max, 0);
+            }
+
+            if(tables & flags::divisor_count)
+            {
+                this->divisor_count_.assign(n_max, 0);
+            }
+
+            if(tables & flags::divisor_sum)
+            {
+                this->divisor_sum_.assign(n_max, 0);
+            }
+
+            auto const data_or_null = [](auto & table)
+                { return table.empty() ? nullptr : table.data(); };
+
+            auto * const first_factors = data_or_null(this->smallest_prime_factor_);
+            auto * const phi = data_or_null(this->euler_phi_);
+            auto * const d_count = data_or_null(this->divisor_count_);
+            auto * const d_sum = data_or_null(this->divisor_sum_);
+
+            if(first_factors)
+            {
+                detail::linear_sieve_fill<UInt, sum_type>
+                    (n_max, this->primes_, first_factors, first_factors, phi
+                    , data_or_null(this->moebius_), d_count, d_sum);
+            }
+            else if(phi)
+            {
+                detail::linear_sieve_fill<UInt, sum_type>
+                    (n_max, this->primes_, phi, first_factors, phi
+                    , data_or_null(this->moebius_), d_count, d_sum);
+            }
+            else if(d_count)
+            {
+                detail::linear_sieve_fill<UInt, sum_type>
+                    (n_max, this->primes_, d_count, first_factors, phi
+                    , data_or_null(this->moebius_), d_count, d_sum);
+            }
+            else
+            {
+                detail::linear_sieve_fill<UInt, sum_type>
+                    (n_max, this->primes_, d_sum, first_factors, phi
+                    , data_or_null(this->moebius_), d_count, d_sum);
+            }
+
+            if(!(tables & flags::smallest_prime_factor))
+            {
+                this->smallest_prime_factor_ = {};
+            }
+        }
+
+        // Таблицы
+        /** Перегрузки для временных объектов позволяют забрать таблицу без копирования:
+        @code
+        auto phi = saga::linear_sieve<>(n_max, saga::linear_sieve_tables::euler_phi).euler_phi();
+        @endcode
+        */
+        ///@{
+        /// @brief Простые числа, меньшие границы, в порядке возрастания
+        std::vector<UInt> const & primes() const &
+        {
+            return this->primes_;
+        }
+
+        std::vector<UInt> primes() &&
+        {
+            return std::move(this->primes_);
+        }
+        ///@}
+
+        std::vector<UInt> const & smallest_prime_factors() const &
+        {
+            return this->smallest_prime_factor_;
+        }
+
+        std::vector<UInt> smallest_prime_factors() &&
+        {
+            return std::move(this->smallest_prime_factor_);
+        }
+
+        std::vector<UInt> const & euler_phi() const &
+        {
+            return this->euler_phi_;
+        }
+
+        std::vector<UInt> euler_phi() &&
+        {
+            return std::move(this->euler_phi_);
+        }
+
+        std::vector<std::int8_t> const & moebius() const &
+        {
+            return this->moebius_;
+        }
+
+        std::vector<std::int8_t> moebius() &&
+        {
+            return std::move(this->moebius_);
+        }
+
+        std::vector<UInt> const & divisor_counts() const &
+        {
+            return this->divisor_count_;
+        }
+
+        std::vector<UInt> divisor_counts() &&
+        {
+            return std::move(this->divisor_count_);
+        }
+
+        std::vector<sum_type> const & divisor_sums() const &
+        {
+            return this->divisor_sum_;
+        }
+
+        std::vector<sum_type> divisor_sums() &&
+        {
+            return std::move(this->divisor_sum_);
+        }
+
+    private:
+        std::vector<UInt> primes_;
+        std::vector<UInt> smallest_prime_factor_;
+        std::vector<UInt> euler_phi_;
+        std::vector<std::int8_t> moebius_;
+        std::vector<UInt> divisor_count_;
+        std::vector<sum_type> divisor_sum_;
+    };
+}
+// namespace saga
+
+#endif
+// Z_SAGA_NUMERIC_LINEAR_SIEVE_HPP_INCLUDED
@@ -0,0 +1,400 @@
+/* (c) 2026 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки SAGA.
+
+SAGA -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#ifndef Z_SAGA_NUMERIC_MODULAR_HPP_INCLUDED
+#define Z_SAGA_NUMERIC_MODULAR_HPP_INCLUDED
+
+/** @file saga/numeric/modular.hpp
+ @brief Вычеты по модулю: тип с модулем, заданным во время компиляции или выполнения
+
+ Класс modular_integer хранит только представление вычета, а модуль и способ редукции
+ определяются параметром шаблона:
+ @li static_modulus -- модуль задан во время компиляции: модули меньше 2^32 используют редукцию
+ Барретта (barrett_32), а нечётные модули до 2^64 -- форму Монтгомери (montgomery_64);
+ @li runtime_modulus -- модуль задаётся во время выполнения и хранится в статической переменной,
+ своей для каждого типа-метки.
+
+ Произведения вычисляются в 128-битных числах, деление при умножении не используется.
+*/
+
+#include <saga/algorithm/result_types.hpp>
+#include <saga/cursor/cursor_traits.hpp>
+#include <saga/numeric/barrett.hpp>
+#include <saga/numeric/montgomery.hpp>
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <type_traits>
+#include <vector>
+
+namespace saga
+{
+    namespace detail
+    {
+        // Перевод чисел в представление, используемое алгоритмом редукции, и обратно
+        template <class Engine>
+        struct modular_representation;
+
+        template <>
+        struct modular_representation<saga::montgomery_64>
+        {
+            static constexpr std::uint64_t
+            encode(saga::montgomery_64 const & engine, std::uint64_t num) noexcept
+            {
+                return engine.to_montgomery(num);
+            }
+
+            static constexpr std::uint64_t
+            decode(saga::montgomery_64 const & engine, std::uint64_t num) noexcept
+            {
+                return engine.from_montgomery(num);
+            }
+        };
+
+        template <>
+        struct modular_representation<saga::barrett_32>
+        {
+            static constexpr std::uint32_t
+            encode(saga::barrett_32 const & engine, std::uint64_t num) noexcept
+            {
+                return engine.reduce(num);
+            }
+
+            static constexpr std::uint32_t
+            decode(saga::barrett_32 const &, std::uint32_t num) noexcept
+            {
+                return num;
+            }
+        };
+
+        /** @brief Обратный к @c num по модулю @c modulus (расширенный алгоритм Евклида)
+        @pre <tt>gcd(num, modulus) == 1</tt>
+        */
+        constexpr std::uint64_t inverse_modulo(std::uint64_t num, std::uint64_t modulus) noexcept
+        {
+            // Инвариант: old_coef * num == old_rest и coef * num == rest по модулю modulus,
+            // коэффициенты хранятся со знаком, определяемым чётностью шага
+            auto old_rest = modulus;
+            auto rest = num % modulus;
+            auto old_coef = std::uint64_t(0);
+            auto coef = std::uint64_t(1);
+            auto negative = false;
+
+            for(; rest != 0; negative = !negative)
+            {
+                auto const quotient = old_rest / rest;
+
+                auto const next_rest = old_rest - quotient * rest;
+                auto const next_coef = old_coef + quotient * coef;
+
+                old_rest = rest;
+                old_coef = coef;
+                rest = next_rest;
+                coef = next_coef;
+            }
+
+            assert(old_rest == 1);
+
+            return negative ? old_coef : modulus - old_coef;
+        }
+    }
+    // namespace detail
+
+    /** @brief Модуль, заданный во время компиляции
+    @pre <tt>Modulus > 1</tt>, модули не меньше 2^32 должны быть нечётными
+    */
+    template <std::uint64_t Modulus>
+    class static_modulus
+    {
+        static_assert(Modulus > 1, "");
+        static_assert((Modulus >> 32) == 0 || Modulus % 2 == 1
+                      , "Even moduli are supported only below 2^32");
+
+    public:
+        // Типы
+        using engine_type = std::conditional_t<(Modulus >> 32) == 0
+                                              , saga::barrett_32, saga::montgomery_64>;
+
+        // Алгоритм редукции
+        static constexpr engine_type const & engine() noexcept
+        {
+            return static_modulus::engine_;
+        }
+
+    private:
+        static constexpr engine_type engine_{typename engine_type::value_type(Modulus)};
+    };
+
+    /** @brief Модуль, задаваемый во время выполнения
+    @tparam Tag тип-метка, позволяющий одновременно использовать несколько модулей
+    @tparam Engine алгоритм редукции: montgomery_64 (нечётные модули) или barrett_32
+
+    Модуль хранится в статической переменной и разделяется всеми потоками, поэтому его следует
+    задавать до начала вычислений. Вычеты, полученные при другом значении модуля, после его
+    изменения становятся недействительными.
+    */
+    template <class Tag, class Engine = saga::montgomery_64>
+    class runtime_modulus
+    {
+    public:
+        // Типы
+        using engine_type = Engine;
+
+        // Модуль
+        static void set_modulus(typename engine_type::value_type modulus)
+        {
+            runtime_modulus::engine_ = engine_type(modulus);
+            runtime_modulus::is_set_ = true;
+        }
+
+        // Алгоритм редукции
+        static engine_type const & engine() noexcept
+        {
+            assert(runtime_modulus::is_set_);
+
+            return runtime_modulus::engine_;
+        }
+
+    private:
+        inline static engine_type engine_{3};
+        inline static bool is_set_ = false;
+    };
+
+    template <class Modulus>
+    class modular_integer
+    {
+    public:
+        // Типы
+        using modulus_type = Modulus;
+        using engine_type = typename Modulus::engine_type;
+        using representation_type = typename engine_type::value_type;
+
+    private:
+        using Representation = detail::modular_representation<engine_type>;
+
+    public:
+        // Создание, копирование, уничтожение
+        constexpr modular_integer() = default;
+
+        template <class IntType, class = std::enable_if_t<std::is_integral<IntType>{}>>
+        constexpr modular_integer(IntType num) noexcept
+        {
+            if constexpr (std::is_signed<IntType>{})
+            {
+                if(num < 0)
+                {
+                    auto const magnitude = 0 - static_cast<std::uint64_t>(num);
+
+                    this->value_ = engine().negate(Representation::encode(engine(), magnitude));
+                    return;
+                }
+            }
+
+            this->value_ = Representation::encode(engine(), static_cast<std::uint64_t>(num));
+        }
+
+        // Свойства
+        static constexpr std::uint64_t modulus() noexcept
+        {
+            return modular_integer::engine().modulus();
+        }
+
+        /// @brief Наименьший неотрицательный вычет
+        constexpr std::uint64_t value() const noexcept
+        {
+            return Representation::decode(engine(), this->value_);
+        }
+
+        /// @brief Представление, используемое алгоритмом редукции
+        constexpr representation_type representation() const noexcept
+        {
+            return this->value_;
+        }
+
+        // Операции
+        constexpr modular_integer power(std::uint64_t exponent) const noexcept
+        {
+            return modular_integer(engine().power(this->value_, exponent), representation_tag{});
+        }
+
+        /** @brief Обратный элемент
+        @pre вычет взаимно прост с модулем
+        */
+        constexpr modular_integer inverse() const noexcept
+        {
+            return modular_integer(detail::inverse_modulo(this->value(), modulus()));
+        }
+
+        constexpr modular_integer operator-() const noexcept
+        {
+            return modular_integer(engine().negate(this->value_), representation_tag{});
+        }
+
+        constexpr modular_integer & operator+=(modular_integer const & rhs) noexcept
+        {
+            this->value_ = engine().add(this->value_, rhs.value_);
+
+            return *this;
+        }
+
+        constexpr modular_integer & operator-=(modular_integer const & rhs) noexcept
+        {
+            this->value_ = engine().subtract(this->value_, rhs.value_);
+
+            return *this;
+        }
+
+        constexpr modular_integer & operator*=(modular_integer const & rhs) noexcept
+        {
+            this->value_ = engine().multiply(this->value_, rhs.value_);
+
+            return *this;
+        }
+
+        /// @pre @c rhs взаимно прост с модулем
+        constexpr modular_integer & operator/=(modular_integer const & rhs) noexcept
+        {
+            return *this *= rhs.inverse();
+        }
+
+        // Арифметические операции
+        friend constexpr modular_integer
+        operator+(modular_integer lhs, modular_integer const & rhs) noexcept
+        {
+            return lhs += rhs;
+        }
+
+        friend constexpr modular_integer
+        operator-(modular_integer lhs, modular_integer const & rhs) noexcept
+        {
+            return lhs -= rhs;
+        }
+
+        friend constexpr modular_integer
+        operator*(modular_integer lhs, modular_integer const & rhs) noexcept
+        {
+            return lhs *= rhs;
+        }
+
+        friend constexpr modular_integer
+        operator/(modular_integer lhs, modular_integer const & rhs) noexcept
+        {
+            return lhs /= rhs;
+        }
+
+        // Равенство
+        friend constexpr bool
+        operator==(modular_integer const & lhs, modular_integer const & rhs) noexcept
+        {
+            return lhs.value_ == rhs.value_;
+        }
+
+        friend constexpr bool
+        operator!=(modular_integer const & lhs, modular_integer const & rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+
+        // Вывод
+        template <class CharT, class Traits>
+        friend std::basic_ostream<CharT, Traits> &
+        operator<<(std::basic_ostream<CharT, Traits> & out, modular_integer const & num)
+        {
+            return out << num.value();
+        }
+
+    private:
+        struct representation_tag {};
+
+        constexpr modular_integer(representation_type value, representation_tag) noexcept
+         : value_(value)
+        {}
+
+        static constexpr engine_type const & engine() noexcept
+        {
+            return Modulus::engine();
+        }
+
+        representation_type value_ = 0;
+    };
+
+    template <std::uint64_t Modulus>
+    using static_modular_integer = modular_integer<static_modulus<Modulus>>;
+
+    struct modular_inverses_fn
+    {
+        /** @brief Запись в @c out обратных к элементам @c in
+
+        Используется приём Монтгомери: вычисляются префиксные произведения, обращается только
+        произведение всех элементов, а затем обратные восстанавливаются проходом в обратном
+        направлении. Требуется <tt>3 * (n - 1)</tt> умножений и одно обращение.
+
+        Элементы @c in читаются до начала записи, поэтому @c out может ссылаться на те же
+        элементы. Если @c out исчерпывается раньше, то оставшиеся обратные не записываются.
+
+        @pre все элементы @c in взаимно просты с модулем
+        @return Курсор @c in, пройденный до конца, и непройденная часть @c out
+        */
+        template <class InputCursor, class OutputCursor>
+        in_out_result<InputCursor, OutputCursor>
+        operator()(InputCursor in, OutputCursor out) const
+        {
+            using Value = saga::cursor_value_t<InputCursor>;
+
+            // prefix[k] -- произведение первых k + 1 элементов
+            std::vector<Value> values;
+            std::vector<Value> prefix;
+
+            for(; !!in; ++in)
+            {
+                values.push_back(*in);
+                prefix.push_back(prefix.empty() ? values.back() : prefix.back() * values.back());
+            }
+
+            if(values.empty())
+            {
+                return {std::move(in), std::move(out)};
+            }
+
+            auto inverse = prefix.back().inverse();
+
+            for(auto index = values.size() - 1; index > 0; --index)
+            {
+                auto const current = values[index];
+                values[index] = inverse * prefix[index - 1];
+                inverse *= current;
+            }
+
+            values.front() = inverse;
+
+            for(auto index = std::size_t(0); index < values.size() && !!out; ++index)
+            {
+                out << values[index];
+            }
+
+            return {std::move(in), std::move(out)};
+        }
+    };
+
+    inline constexpr auto const modular_inverses = modular_inverses_fn{};
+}
+// namespace saga
+
+#endif
+// Z_SAGA_NUMERIC_MODULAR_HPP_INCLUDED
@@ -0,0 +1,169 @@
+/* (c) 2026 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки SAGA.
+
+SAGA -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#ifndef Z_SAGA_NUMERIC_MONTGOMERY_HPP_INCLUDED
+#define Z_SAGA_NUMERIC_MONTGOMERY_HPP_INCLUDED
+
+/** @file saga/numeric/montgomery.hpp
+ @brief Арифметика по нечётному 64-битному модулю в форме Монтгомери
+
+ Число x представляется остатком x * 2^64 по модулю n. Умножение в этой форме требует двух
+ умножений 64-битных чисел с 128-битным результатом и не использует деления.
+*/
+
+#include <saga/detail/uint128.hpp>
+
+#include <cassert>
+#include <cstdint>
+
+namespace saga
+{
+    class montgomery_64
+    {
+    public:
+        // Типы
+        using value_type = std::uint64_t;
+
+        // Создание, копирование, уничтожение
+        /** @brief Конструктор
+        @pre @c modulus нечётно и больше 1
+        */
+        constexpr explicit montgomery_64(value_type modulus) noexcept
+         : modulus_(modulus)
+         , inverse_(montgomery_64::inverse_modulo_2_64(modulus))
+         , one_((0 - modulus) % modulus)
+         , r_squared_(montgomery_64::r_squared(modulus, this->one_))
+        {
+            assert(modulus % 2 == 1 && modulus > 1);
+        }
+
+        // Свойства
+        constexpr value_type modulus() const noexcept
+        {
+            return this->modulus_;
+        }
+
+        // Преобразования
+        constexpr value_type to_montgomery(value_type num) const noexcept
+        {
+            return this->multiply(num % this->modulus_, this->r_squared_);
+        }
+
+        constexpr value_type from_montgomery(value_type num) const noexcept
+        {
+            return this->reduce(0, num);
+        }
+
+        /// @brief Единица в форме Монтгомери
+        constexpr value_type one() const noexcept
+        {
+            return this->one_;
+        }
+
+        // Операции над числами в форме Монтгомери
+        constexpr value_type add(value_type lhs, value_type rhs) const noexcept
+        {
+            assert(lhs < this->modulus_ && rhs < this->modulus_);
+
+            auto const sum = lhs + rhs;
+
+            return sum - ((sum < lhs || sum >= this->modulus_) ? this->modulus_ : 0);
+        }
+
+        constexpr value_type subtract(value_type lhs, value_type rhs) const noexcept
+        {
+            assert(lhs < this->modulus_ && rhs < this->modulus_);
+
+            return lhs - rhs + ((lhs < rhs) ? this->modulus_ : 0);
+        }
+
+        constexpr value_type negate(value_type num) const noexcept
+        {
+            return this->subtract(0, num);
+        }
+
+        constexpr value_type multiply(value_type lhs, value_type rhs) const noexcept
+        {
+            auto const product = detail::multiply_wide_64(lhs, rhs);
+
+            return this->reduce(product.high, product.low);
+        }
+
+        constexpr value_type power(value_type base, std::uint64_t exponent) const noexcept
+        {
+            auto result = this->one_;
+
+            for(; exponent > 0; exponent /= 2)
+            {
+                if(exponent % 2 == 1)
+                {
+                    result = this->multiply(result, base);
+                }
+
+                base = this->multiply(base, base);
+            }
+
+            return result;
+        }
+
+    private:
+        // Редукция Монтгомери: (high * 2^64 + low) * 2^(-64) mod n при high < n
+        constexpr value_type reduce(value_type high, value_type low) const noexcept
+        {
+            auto const factor = low * this->inverse_;
+            auto const correction = detail::multiply_high_64(factor, this->modulus_);
+
+            return high - correction + ((high < correction) ? this->modulus_ : 0);
+        }
+
+        // Обратный к нечётному числу по модулю 2^64: метод Ньютона удваивает число верных битов
+        static constexpr value_type inverse_modulo_2_64(value_type num) noexcept
+        {
+            auto result = num;
+
+            for(auto iteration = 0; iteration < 5; ++iteration)
+            {
+                result *= 2 - num * result;
+            }
+
+            return result;
+        }
+
+        // 2^128 mod n: удвоение 2^64 mod n ещё 64 раза
+        static constexpr value_type r_squared(value_type modulus, value_type one) noexcept
+        {
+            auto result = one;
+
+            for(auto iteration = 0; iteration < 64; ++iteration)
+            {
+                result = (result >= modulus - result) ? result - (modulus - result)
+                                                      : result + result;
+            }
+
+            return result;
+        }
+
+        value_type modulus_;
+        value_type inverse_;
+        value_type one_;
+        value_type r_squared_;
+    };
+}
+// namespace saga
+
+#endif
+// Z_SAGA_NUMERIC_MONTGOMERY_HPP_INCLUDED
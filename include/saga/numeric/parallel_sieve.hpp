@@ -0,0 +1,444 @@
+/* (c) 2026 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки SAGA.
+
+SAGA -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#ifndef Z_SAGA_NUMERIC_PARALLEL_SIEVE_HPP_INCLUDED
+#define Z_SAGA_NUMERIC_PARALLEL_SIEVE_HPP_INCLUDED
+
+/** @file saga/numeric/parallel_sieve.hpp
+ @brief Многопоточное сегментированное решето Эратосфена, подсчёт количества и суммы простых чисел
+
+ Интервал разбивается на порции из нескольких сегментов, которые обрабатываются набором потоков.
+ Результаты обработки порций передаются вызывающему потоку строго в порядке возрастания чисел,
+ причём одновременно хранится не более двух порций на поток.
+*/
+
+#include <saga/numeric/segmented_sieve.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace saga
+{
+    namespace detail
+    {
+        inline unsigned default_thread_count()
+        {
+            auto const result = std::thread::hardware_concurrency();
+
+            return (result == 0) ? 1 : result;
+        }
+
+        /** @brief Вызывает @c fun для каждого числа из <tt>[lo, hi)</tt>, которому соответствует
+        установленный бит сегмента решета
+        @pre @c num_bytes кратно 8
+        */
+        template <class Function>
+        void for_each_sieved_number(std::uint8_t const * segment
+                                   , wheel_sieve::number_type first_byte, std::size_t num_bytes
+                                   , wheel_sieve::number_type lo, wheel_sieve::number_type hi
+                                   , Function && fun)
+        {
+            assert(num_bytes % 8 == 0);
+
+            for(auto pos = std::size_t(0); pos < num_bytes; pos += 8)
+            {
+                auto word = detail::load_sieve_word(segment + pos);
+
+                for(; word != 0; word &= word - 1)
+                {
+                    auto const index = detail::countr_zero_64(word);
+                    auto const num = wheel_sieve::number(first_byte + pos + index / 8, index % 8);
+
+                    if(lo <= num && num < hi)
+                    {
+                        fun(num);
+                    }
+                }
+            }
+        }
+
+        /** @brief Количество чисел из <tt>[lo, hi)</tt>, которым соответствуют установленные биты
+        сегмента решета
+        @pre @c num_bytes кратно 8
+        */
+        inline std::uint64_t
+        count_sieved_numbers(std::uint8_t const * segment
+                            , wheel_sieve::number_type first_byte, std::size_t num_bytes
+                            , wheel_sieve::number_type lo, wheel_sieve::number_type hi)
+        {
+            assert(num_bytes % 8 == 0);
+
+            auto result = std::uint64_t(0);
+
+            for(auto pos = std::size_t(0); pos < num_bytes; pos += 8)
+            {
+                auto const word_first = wheel_sieve::numbers_per_byte * (first_byte + pos);
+                auto const word_last = word_first + 8 * wheel_sieve::numbers_per_byte;
+
+                if(lo <= word_first && word_last <= hi)
+                {
+                    result += detail::popcount_64(detail::load_sieve_word(segment + pos));
+                }
+                else
+                {
+                    detail::for_each_sieved_number(segment + pos, first_byte + pos, 8, lo, hi
+                                                   , [&result](auto) { ++result; });
+                }
+            }
+
+            return result;
+        }
+
+        /** @brief Параллельное просеивание полуинтервала <tt>[lo, hi)</tt>
+        @param process функциональный объект, вызываемый в рабочем потоке для каждого сегмента
+        порции: <tt>process(result, segment, first_byte, num_bytes)</tt>
+        @param consume функциональный объект, вызываемый в вызывающем потоке для результата каждой
+        порции в порядке их следования
+        */
+        template <class ChunkResult, class ProcessSegment, class Consume>
+        void parallel_sieve(wheel_sieve::number_type lo, wheel_sieve::number_type hi
+                           , unsigned num_threads, ProcessSegment process, Consume consume)
+        {
+            using number_type = wheel_sieve::number_type;
+
+            constexpr auto segment_bytes = number_type(wheel_sieve::default_segment_bytes);
+            constexpr auto chunk_bytes = 16 * segment_bytes;
+
+            auto const first_byte = lo / wheel_sieve::numbers_per_byte;
+            auto const last_byte
+                = (hi + wheel_sieve::numbers_per_byte - 1) / wheel_sieve::numbers_per_byte;
+
+            if(lo >= hi || first_byte >= last_byte)
+            {
+                return;
+            }
+
+            auto const num_chunks
+                = std::size_t((last_byte - first_byte + chunk_bytes - 1) / chunk_bytes);
+
+            wheel_sieve const prototype(hi);
+
+            auto const run_chunk = [&](wheel_sieve & sieve, std::vector<std::uint8_t> & segment
+                                      , std::size_t chunk)
+            {
+                ChunkResult result{};
+
+                auto const chunk_first = first_byte + chunk * chunk_bytes;
+                auto const chunk_last = std::min(chunk_first + chunk_bytes, last_byte);
+
+                sieve.seek(chunk_first);
+
+                for(auto pos = chunk_first; pos < chunk_last; pos += segment_bytes)
+                {
+                    auto const num = (std::min(segment_bytes, chunk_last - pos) + 7) / 8 * 8;
+
+                    sieve.sieve(segment.data(), std::size_t(num));
+                    process(result, static_cast<std::uint8_t const *>(segment.data()), pos
+                            , std::size_t(num));
+                }
+
+                return result;
+            };
+
+            auto const thread_count
+                = std::size_t(std::clamp<std::size_t>(num_threads, 1, num_chunks));
+
+            if(thread_count == 1)
+            {
+                auto sieve = prototype;
+                std::vector<std::uint8_t> segment(segment_bytes);
+
+                for(auto chunk = std::size_t(0); chunk < num_chunks; ++chunk)
+                {
+                    consume(run_chunk(sieve, segment, chunk));
+                }
+
+                return;
+            }
+
+            // Упорядочивание результатов: порция chunk хранится в slots[chunk % window]
+            auto const window = 2 * thread_count;
+
+            std::mutex mutex;
+            std::condition_variable condition;
+            std::vector<std::optional<ChunkResult>> slots(window);
+            auto next_chunk = std::size_t(0);
+            auto consumed = std::size_t(0);
+            auto stop = false;
+            std::exception_ptr error;
+
+            auto const worker = [&]
+            {
+                auto sieve = prototype;
+                std::vector<std::uint8_t> segment(segment_bytes);
+
+                for(;;)
+                {
+                    auto chunk = std::size_t(0);
+                    {
+                        std::unique_lock<std::mutex> lock(mutex);
+
+                        condition.wait(lock, [&]
+                        {
+                            return stop || next_chunk == num_chunks
+                                   || next_chunk < consumed + window;
+                        });
+
+                        if(stop || next_chunk == num_chunks)
+                        {
+                            return;
+                        }
+
+                        chunk = next_chunk++;
+                    }
+
+                    std::optional<ChunkResult> result;
+
+                    try
+                    {
+                        result.emplace(run_chunk(sieve, segment, chunk));
+                    }
+                    catch(...)
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        error = std::current_exception();
+                        stop = true;
+                        condition.notify_all();
+                        return;
+                    }
+
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        slots[chunk % window] = std::move(result);
+                    }
+                    condition.notify_all();
+                }
+            };
+
+            std::vector<std::thread> pool;
+
+            auto const stop_and_join = [&]
+            {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    stop = true;
+                }
+                condition.notify_all();
+
+                for(auto & thread : pool)
+                {
+                    thread.join();
+                }
+            };
+
+            try
+            {
+                pool.reserve(thread_count);
+
+                for(auto index = std::size_t(0); index < thread_count; ++index)
+                {
+                    pool.emplace_back(worker);
+                }
+
+                for(auto chunk = std::size_t(0); chunk < num_chunks; ++chunk)
+                {
+                    std::optional<ChunkResult> result;
+                    {
+                        std::unique_lock<std::mutex> lock(mutex);
+
+                        condition.wait(lock, [&]
+                                       { return stop || slots[chunk % window].has_value(); });
+
+                        if(stop)
+                        {
+                            break;
+                        }
+
+                        result = std::move(slots[chunk % window]);
+                        slots[chunk % window].reset();
+                        ++consumed;
+                    }
+                    condition.notify_all();
+
+                    consume(std::move(*result));
+                }
+            }
+            catch(...)
+            {
+                stop_and_join();
+                throw;
+            }
+
+            stop_and_join();
+
+            if(error)
+            {
+                std::rethrow_exception(error);
+            }
+        }
+
+        template <class IntType>
+        wheel_sieve::number_type to_sieve_bound(IntType const & num)
+        {
+            return (num < IntType(0)) ? 0 : wheel_sieve::number_type(num);
+        }
+
+        inline constexpr wheel_sieve::number_type wheel_primes[] = {2, 3, 5};
+    }
+    // namespace detail
+
+    /** @brief Копирование простых чисел из полуинтервала <tt>[lo, hi)</tt> в порядке возрастания
+    с использованием нескольких потоков
+    */
+    struct copy_primes_in_parallel_fn
+    {
+        template <class IntType, class OutputCursor>
+        OutputCursor
+        operator()(IntType lo, IntType hi, OutputCursor out
+                   , unsigned num_threads = detail::default_thread_count()) const
+        {
+            auto const first = detail::to_sieve_bound(lo);
+            auto const last = detail::to_sieve_bound(hi);
+
+            for(auto const & prime : detail::wheel_primes)
+            {
+                if(first <= prime && prime < last)
+                {
+                    out << IntType(prime);
+                }
+            }
+
+            auto const process = [first, last](std::vector<IntType> & result
+                                              , std::uint8_t const * segment
+                                              , wheel_sieve::number_type first_byte
+                                              , std::size_t num_bytes)
+            {
+                detail::for_each_sieved_number(segment, first_byte, num_bytes, first, last
+                                               , [&result](wheel_sieve::number_type num)
+                                                 { result.push_back(IntType(num)); });
+            };
+
+            detail::parallel_sieve<std::vector<IntType>>
+                (first, last, num_threads, process, [&out](std::vector<IntType> && primes)
+            {
+                for(auto const & prime : primes)
+                {
+                    out << prime;
+                }
+            });
+
+            return out;
+        }
+    };
+
+    /** @brief Количество простых чисел, не превосходящих @c n_max
+
+    Простые числа не сохраняются: подсчитываются установленные биты сегментов решета.
+    */
+    struct prime_count_fn
+    {
+        template <class IntType>
+        IntType operator()(IntType n_max
+                          , unsigned num_threads = detail::default_thread_count()) const
+        {
+            if(n_max < IntType(2))
+            {
+                return IntType(0);
+            }
+
+            auto const last = wheel_sieve::number_type(n_max) + 1;
+
+            auto result = IntType(0);
+
+            for(auto const & prime : detail::wheel_primes)
+            {
+                result += IntType(prime < last);
+            }
+
+            auto const process = [last](std::uint64_t & count, std::uint8_t const * segment
+                                       , wheel_sieve::number_type first_byte
+                                       , std::size_t num_bytes)
+            {
+                count += detail::count_sieved_numbers(segment, first_byte, num_bytes, 0, last);
+            };
+
+            detail::parallel_sieve<std::uint64_t>
+                (0, last, num_threads, process
+                , [&result](std::uint64_t count) { result += IntType(count); });
+
+            return result;
+        }
+    };
+
+    /** @brief Сумма простых чисел, не превосходящих @c n_max
+
+    Простые числа не сохраняются. Сумма накапливается в типе @c IntType.
+    */
+    struct prime_sum_fn
+    {
+        template <class IntType>
+        IntType operator()(IntType n_max
+                          , unsigned num_threads = detail::default_thread_count()) const
+        {
+            if(n_max < IntType(2))
+            {
+                return IntType(0);
+            }
+
+            auto const last = wheel_sieve::number_type(n_max) + 1;
+
+            auto result = IntType(0);
+
+            for(auto const & prime : detail::wheel_primes)
+            {
+                if(prime < last)
+                {
+                    result += IntType(prime);
+                }
+            }
+
+            auto const process = [last](IntType & sum, std::uint8_t const * segment
+                                       , wheel_sieve::number_type first_byte
+                                       , std::size_t num_bytes)
+            {
+                detail::for_each_sieved_number(segment, first_byte, num_bytes, 0, last
+                                               , [&sum](wheel_sieve::number_type num)
+                                                 { sum += IntType(num); });
+            };
+
+            detail::parallel_sieve<IntType>
+                (0, last, num_threads, process, [&result](IntType sum) { result += sum; });
+
+            return result;
+        }
+    };
+
+    inline constexpr auto const copy_primes_in_parallel = copy_primes_in_parallel_fn{};
+    inline constexpr auto const prime_count = prime_count_fn{};
+    inline constexpr auto const prime_sum = prime_sum_fn{};
+}
+// namespace saga
+
+#endif
+// Z_SAGA_NUMERIC_PARALLEL_SIEVE_HPP_INCLUDED
@@ -20,16 +20,128 @@ SAGA -- это свободной программное обеспечение:
 
 /** @file saga/numeric/polynomial.hpp
  @brief Многочлены и алгоритмы для них
+
+ Многочлены и формальные степенные ряды с коэффициентами-вычетами (modular_integer)
+ представляются векторами коэффициентов, начиная с младшего. Умножение длинных многочленов
+ выполняется с помощью теоретико-числового преобразования (NTT): непосредственно, если модуль --
+ простое число вида c * 2^k + 1 с достаточно большим k, иначе по трём таким простым модулям с
+ восстановлением коэффициентов по китайской теореме об остатках. Обращение и логарифм степенных
+ рядов вычисляются методом Ньютона, значения в нескольких точках -- с помощью дерева
+ произведений. Для значений многочлена с коэффициентами с плавающей точкой во многих точках
+ предназначены пакетные варианты polynomial_horner и polynomial_estrin.
 */
 
+#include <saga/algorithm.hpp>
+#include <saga/algorithm/result_types.hpp>
+#include <saga/cursor/cursor_traits.hpp>
+#include <saga/cursor/subrange.hpp>
+#include <saga/detail/simd_polynomial.hpp>
+#include <saga/numeric/factorize.hpp>
+#include <saga/numeric/modular.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
 #include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace saga
 {
+    namespace detail
+    {
+        /// @brief Тип элементов непрерывного курсора, доступных для записи через @c data()
+        template <class Cursor, class SFINAE = void>
+        struct contiguous_output_element
+        {
+            using type = void;
+        };
+
+        template <class Cursor>
+        struct contiguous_output_element<Cursor
+                                        , std::enable_if_t<saga::is_contiguous_cursor<Cursor>{}>>
+         : std::remove_pointer<decltype(std::declval<Cursor &>().data())>
+        {};
+
+        template <class T, class InputCursor>
+        std::vector<T> polynomial_coefficients(InputCursor cur)
+        {
+            std::vector<T> result;
+
+            for(; !!cur; ++cur)
+            {
+                result.push_back(T(*cur));
+            }
+
+            return result;
+        }
+
+        /** @brief Вычисление значений в точках курсора @c points с записью в @c out
+
+        Точки непрерывного курсора передаются @c evaluate без копирования, точки других курсоров
+        произвольного доступа предварительно копируются в буфер. Если @c out -- непрерывный курсор
+        с тем же типом элементов, то значения записываются непосредственно в его память, иначе --
+        через временный буфер.
+        */
+        template <class RandomAccessCursor, class OutputCursor, class Evaluate>
+        unary_transform_result<RandomAccessCursor, OutputCursor>
+        polynomial_evaluate_batch(RandomAccessCursor points, OutputCursor out, Evaluate evaluate)
+        {
+            using T = saga::cursor_value_t<RandomAccessCursor>;
+            using Output = typename detail::contiguous_output_element<OutputCursor>::type;
+
+            auto num = static_cast<std::size_t>(points.size());
+
+            std::vector<T> buffer;
+            auto first = static_cast<T const *>(nullptr);
+
+            if constexpr (saga::is_contiguous_cursor<RandomAccessCursor>{})
+            {
+                first = detail::simd_data(points);
+            }
+            else
+            {
+                buffer.reserve(num);
+                saga::copy(points, saga::back_inserter(buffer));
+                first = buffer.data();
+            }
+
+            if constexpr (std::is_same<Output, T>{})
+            {
+                num = std::min(num, static_cast<std::size_t>(out.size()));
+
+                evaluate(first, num, out.data());
+
+                points.drop_front(static_cast<cursor_difference_t<RandomAccessCursor>>(num));
+                out.drop_front(static_cast<cursor_difference_t<OutputCursor>>(num));
+
+                return {std::move(points), std::move(out)};
+            }
+            else
+            {
+                std::vector<T> values(num);
+
+                evaluate(first, num, values.data());
+
+                auto result = saga::copy(saga::cursor::all(values), std::move(out));
+
+                num -= static_cast<std::size_t>(result.in.size());
+
+                points.drop_front(static_cast<cursor_difference_t<RandomAccessCursor>>(num));
+
+                return {std::move(points), std::move(result.out)};
+            }
+        }
+    }
+    // namespace detail
+
     struct polynomial_horner_fn
     {
     public:
-        template <class InputCursor, class T, class Result>
+        template <class InputCursor, class T, class Result
+                 , class = std::enable_if_t<!saga::is_random_access_cursor<T>{}>>
         constexpr
         Result operator()(InputCursor cur, T const & arg, Result const & zero) const
         {
@@ -42,9 +154,767 @@ namespace saga
 
             return result;
         }
+
+        /** @brief Значения многочлена в точках курсора произвольного доступа @c points
+        @param cur курсор, задающий коэффициенты многочлена, начиная со старшего
+        @param out выходной курсор для записи значений, может ссылаться на те же элементы, что и
+        @c points
+        @return Непройденные части курсоров @c points и @c out
+
+        Коэффициенты читаются один раз, затем вычисляются несколько независимых цепочек схемы
+        Горнера одновременно. Для float и double на процессорах с AVX2 и FMA используются
+        векторные команды; из-за умножения со сложением с одним округлением результат может
+        отличаться от вычисленного для одной точки в последних битах. Если курсоры @c points и
+        @c out непрерывные, то значения вычисляются без промежуточных копий.
+        */
+        template <class InputCursor, class RandomAccessCursor, class OutputCursor
+                 , class = std::enable_if_t<saga::is_random_access_cursor<RandomAccessCursor>{}>>
+        unary_transform_result<RandomAccessCursor, OutputCursor>
+        operator()(InputCursor cur, RandomAccessCursor points, OutputCursor out) const
+        {
+            using T = saga::cursor_value_t<RandomAccessCursor>;
+
+            auto const coefficients = detail::polynomial_coefficients<T>(std::move(cur));
+
+            auto const evaluate = [&](T const * first, std::size_t num, T * result)
+            {
+                if(coefficients.empty())
+                {
+                    std::fill(result, result + num, T(0));
+                    return;
+                }
+
+                detail::simd_polynomial_horner(coefficients.data(), coefficients.size()
+                                              , first, num, result);
+            };
+
+            return detail::polynomial_evaluate_batch(std::move(points), std::move(out), evaluate);
+        }
     };
 
     inline constexpr auto const polynomial_horner = polynomial_horner_fn{};
+
+    /** @brief Вычисление значений многочлена по схеме Эстрина
+
+    Глубина цепочки зависимых операций логарифмически зависит от степени многочлена, поэтому для
+    многочленов высокой степени и небольшого количества точек эта схема может оказаться быстрее
+    схемы Горнера. Если точек много, то задержку скрывают независимые цепочки пакетного варианта
+    polynomial_horner, и он, как правило, быстрее, так как выполняет меньше умножений. Погрешность
+    округления для чисел с плавающей точкой у двух схем различается.
+    */
+    struct polynomial_estrin_fn
+    {
+    public:
+        /** @brief Значения многочлена в точках курсора произвольного доступа @c points
+        @param cur курсор, задающий коэффициенты многочлена, начиная со старшего (как для
+        polynomial_horner)
+        @param out выходной курсор для записи значений, может ссылаться на те же элементы, что и
+        @c points
+        @return Непройденные части курсоров @c points и @c out
+        */
+        template <class InputCursor, class RandomAccessCursor, class OutputCursor
+                 , class = std::enable_if_t<saga::is_random_access_cursor<RandomAccessCursor>{}>>
+        unary_transform_result<RandomAccessCursor, OutputCursor>
+        operator()(InputCursor cur, RandomAccessCursor points, OutputCursor out) const
+        {
+            using T = saga::cursor_value_t<RandomAccessCursor>;
+
+            auto coefficients = detail::polynomial_coefficients<T>(std::move(cur));
+
+            std::reverse(coefficients.begin(), coefficients.end());
+
+            // Векторная реализация обрабатывает до восьми точек одновременно
+            std::vector<T> scratch((coefficients.size() + 1) / 2 * 8, T(0));
+
+            auto const evaluate = [&](T const * first, std::size_t num, T * result)
+            {
+                if(coefficients.empty())
+                {
+                    std::fill(result, result + num, T(0));
+                    return;
+                }
+
+                detail::simd_polynomial_estrin(coefficients.data(), coefficients.size()
+                                              , first, num, result, scratch.data());
+            };
+
+            return detail::polynomial_evaluate_batch(std::move(points), std::move(out), evaluate);
+        }
+    };
+
+    inline constexpr auto const polynomial_estrin = polynomial_estrin_fn{};
+
+    namespace detail
+    {
+        // Пороги переключения алгоритмов
+        inline constexpr std::size_t polynomial_ntt_threshold = 64;
+        inline constexpr std::size_t polynomial_evaluate_threshold = 64;
+
+        /// @brief Наибольшая степень двойки, делящая <tt>modulus - 1</tt>
+        constexpr std::uint64_t ntt_max_size(std::uint64_t modulus) noexcept
+        {
+            auto const order = modulus - 1;
+
+            return order & (0 - order);
+        }
+
+        /** @brief Поиск первообразного корня по простому модулю
+        @pre модуль -- простое число
+        */
+        template <class Modular>
+        Modular find_primitive_root()
+        {
+            auto const order = Modular::modulus() - 1;
+            auto const factors = saga::factorize(order);
+
+            for(auto candidate = std::uint64_t(2);; ++candidate)
+            {
+                auto const root = Modular(candidate);
+
+                auto const is_generator
+                    = std::all_of(factors.begin(), factors.end()
+                                 , [&](auto const & factor)
+                                   { return root.power(order / factor.prime) != Modular(1); });
+
+                if(is_generator)
+                {
+                    return root;
+                }
+            }
+        }
+
+        /** @brief Первообразный корень по простому модулю
+        @pre модуль -- простое число
+
+        Поиск требует разложения <tt>modulus - 1</tt> на множители, поэтому найденный корень
+        запоминается. Модуль runtime_modulus может меняться, поэтому вместе с корнем хранится
+        модуль, для которого он найден.
+        */
+        template <class Modular>
+        Modular primitive_root()
+        {
+            thread_local auto cache = std::pair<std::uint64_t, std::uint64_t>(0, 0);
+
+            auto const modulus = Modular::modulus();
+
+            if(cache.first != modulus)
+            {
+                cache.second = detail::find_primitive_root<Modular>().value();
+                cache.first = modulus;
+            }
+
+            return Modular(cache.second);
+        }
+
+        /** @brief Теоретико-числовое преобразование длины @c size
+
+        Прямое преобразование (прореживание по частоте) выдаёт значения в двоично-инверсном
+        порядке, а обратное (прореживание по времени) принимает их в этом же порядке, поэтому
+        перестановка элементов не требуется.
+        */
+        template <class Modular>
+        class polynomial_ntt
+        {
+        public:
+            /**
+            @pre @c size -- степень двойки, не меньшая 2 и делящая <tt>modulus - 1</tt>
+            @pre модуль -- простое число
+            */
+            explicit polynomial_ntt(std::size_t size)
+             : size_(size)
+             , roots_(size)
+             , inverse_roots_(size)
+             , scale_(Modular(size).inverse())
+            {
+                assert(size >= 2 && (size & (size - 1)) == 0);
+                assert(detail::ntt_max_size(Modular::modulus()) % size == 0);
+
+                auto const root
+                    = detail::primitive_root<Modular>().power((Modular::modulus() - 1) / size);
+
+                // Корни для этапа длины len хранятся с позиции len
+                polynomial_ntt::fill_roots(this->roots_, root);
+                polynomial_ntt::fill_roots(this->inverse_roots_, root.inverse());
+            }
+
+            std::size_t size() const
+            {
+                return this->size_;
+            }
+
+            void forward(Modular * data) const
+            {
+                for(auto len = this->size_ / 2; len > 0; len /= 2)
+                {
+                    auto const * const roots = this->roots_.data() + len;
+
+                    for(auto first = std::size_t(0); first < this->size_; first += 2 * len)
+                    {
+                        for(auto index = std::size_t(0); index < len; ++index)
+                        {
+                            auto const lhs = data[first + index];
+                            auto const rhs = data[first + index + len];
+
+                            data[first + index] = lhs + rhs;
+                            data[first + index + len] = (lhs - rhs) * roots[index];
+                        }
+                    }
+                }
+            }
+
+            void inverse(Modular * data) const
+            {
+                for(auto len = std::size_t(1); len < this->size_; len *= 2)
+                {
+                    auto const * const roots = this->inverse_roots_.data() + len;
+
+                    for(auto first = std::size_t(0); first < this->size_; first += 2 * len)
+                    {
+                        for(auto index = std::size_t(0); index < len; ++index)
+                        {
+                            auto const lhs = data[first + index];
+                            auto const rhs = data[first + index + len] * roots[index];
+
+                            data[first + index] = lhs + rhs;
+                            data[first + index + len] = lhs - rhs;
+                        }
+                    }
+                }
+
+                for(auto index = std::size_t(0); index < this->size_; ++index)
+                {
+                    data[index] *= this->scale_;
+                }
+            }
+
+        private:
+            static void fill_roots(std::vector<Modular> & roots, Modular root)
+            {
+                auto const half = roots.size() / 2;
+
+                auto power = Modular(1);
+
+                for(auto index = std::size_t(0); index < half; ++index)
+                {
+                    roots[half + index] = power;
+                    power *= root;
+                }
+
+                for(auto len = half / 2; len > 0; len /= 2)
+                {
+                    for(auto index = std::size_t(0); index < len; ++index)
+                    {
+                        roots[len + index] = roots[2 * len + 2 * index];
+                    }
+                }
+            }
+
+            std::size_t size_;
+            std::vector<Modular> roots_;
+            std::vector<Modular> inverse_roots_;
+            Modular scale_;
+        };
+
+        inline std::size_t ntt_size_for(std::size_t result_size)
+        {
+            auto size = std::size_t(2);
+
+            for(; size < result_size;)
+            {
+                size *= 2;
+            }
+
+            return size;
+        }
+
+        template <class Modular>
+        std::vector<Modular>
+        polynomial_multiply_basecase(std::vector<Modular> const & lhs
+                                    , std::vector<Modular> const & rhs)
+        {
+            std::vector<Modular> result(lhs.size() + rhs.size() - 1);
+
+            for(auto i = std::size_t(0); i < lhs.size(); ++i)
+            {
+                for(auto j = std::size_t(0); j < rhs.size(); ++j)
+                {
+                    result[i + j] += lhs[i] * rhs[j];
+                }
+            }
+
+            return result;
+        }
+
+        /** @brief Умножение с помощью NTT по модулю коэффициентов
+        @pre модуль -- простое число, <tt>modulus - 1</tt> делится на степень двойки, не меньшую
+        <tt>lhs.size() + rhs.size() - 1</tt>
+        */
+        template <class Modular>
+        std::vector<Modular>
+        polynomial_multiply_ntt(std::vector<Modular> const & lhs, std::vector<Modular> const & rhs)
+        {
+            auto const result_size = lhs.size() + rhs.size() - 1;
+            auto const ntt = detail::polynomial_ntt<Modular>(detail::ntt_size_for(result_size));
+
+            std::vector<Modular> result(ntt.size());
+            std::copy(lhs.begin(), lhs.end(), result.begin());
+            ntt.forward(result.data());
+
+            if(&lhs == &rhs)
+            {
+                for(auto & value : result)
+                {
+                    value *= value;
+                }
+            }
+            else
+            {
+                std::vector<Modular> other(ntt.size());
+                std::copy(rhs.begin(), rhs.end(), other.begin());
+                ntt.forward(other.data());
+
+                for(auto index = std::size_t(0); index < result.size(); ++index)
+                {
+                    result[index] *= other[index];
+                }
+            }
+
+            ntt.inverse(result.data());
+            result.resize(result_size);
+
+            return result;
+        }
+
+        // Простые числа для умножения по произвольному модулю
+        using polynomial_crt_0 = saga::static_modular_integer<998'244'353>;
+        using polynomial_crt_1 = saga::static_modular_integer<167'772'161>;
+        using polynomial_crt_2 = saga::static_modular_integer<469'762'049>;
+
+        template <class Target, class Modular>
+        std::vector<Target> polynomial_convert(std::vector<Modular> const & poly)
+        {
+            std::vector<Target> result;
+            result.reserve(poly.size());
+
+            for(auto const & coefficient : poly)
+            {
+                result.emplace_back(coefficient.value());
+            }
+
+            return result;
+        }
+
+        template <class Target, class Modular>
+        std::vector<Target>
+        polynomial_multiply_by(std::vector<Modular> const & lhs, std::vector<Modular> const & rhs)
+        {
+            auto const lhs_converted = detail::polynomial_convert<Target>(lhs);
+
+            if(&lhs == &rhs)
+            {
+                return detail::polynomial_multiply_ntt(lhs_converted, lhs_converted);
+            }
+
+            return detail::polynomial_multiply_ntt(lhs_converted
+                                                  , detail::polynomial_convert<Target>(rhs));
+        }
+
+        /** @brief Умножение по произвольному модулю через три простых модуля
+
+        Коэффициенты точного произведения меньше <tt>n * modulus^2</tt>, что при
+        <tt>modulus < 2^31</tt> меньше произведения трёх простых модулей, поэтому они однозначно
+        восстанавливаются алгоритмом Гарнера.
+
+        @pre <tt>modulus < 2^31</tt>, <tt>lhs.size() + rhs.size() - 1 <= 2^23</tt>
+        */
+        template <class Modular>
+        std::vector<Modular>
+        polynomial_multiply_crt(std::vector<Modular> const & lhs, std::vector<Modular> const & rhs)
+        {
+            assert(Modular::modulus() < (std::uint64_t(1) << 31));
+
+            using Mod0 = detail::polynomial_crt_0;
+            using Mod1 = detail::polynomial_crt_1;
+            using Mod2 = detail::polynomial_crt_2;
+
+            auto const result_0 = detail::polynomial_multiply_by<Mod0>(lhs, rhs);
+            auto const result_1 = detail::polynomial_multiply_by<Mod1>(lhs, rhs);
+            auto const result_2 = detail::polynomial_multiply_by<Mod2>(lhs, rhs);
+
+            auto const inverse_01 = Mod1(Mod0::modulus()).inverse();
+            auto const inverse_012 = (Mod2(Mod0::modulus()) * Mod2(Mod1::modulus())).inverse();
+
+            auto const modulus_0 = Modular(Mod0::modulus());
+            auto const modulus_01 = modulus_0 * Modular(Mod1::modulus());
+
+            std::vector<Modular> result;
+            result.reserve(result_0.size());
+
+            for(auto index = std::size_t(0); index < result_0.size(); ++index)
+            {
+                // x = r0 + p0 * y1 + p0 * p1 * y2
+                auto const r0 = result_0[index].value();
+                auto const y1 = ((result_1[index] - Mod1(r0)) * inverse_01).value();
+                auto const y2 = ((result_2[index] - Mod2(r0) - Mod2(Mod0::modulus()) * Mod2(y1))
+                                 * inverse_012).value();
+
+                result.push_back(Modular(r0) + modulus_0 * Modular(y1) + modulus_01 * Modular(y2));
+            }
+
+            return result;
+        }
+
+        template <class Modular>
+        void polynomial_truncate(std::vector<Modular> & poly, std::size_t num)
+        {
+            if(poly.size() > num)
+            {
+                poly.resize(num);
+            }
+        }
+    }
+    // namespace detail
+
+    struct polynomial_multiply_fn
+    {
+        /** @brief Произведение многочленов
+        @pre Если модуль не является простым числом вида <tt>c * 2^k + 1</tt>, где @c 2^k не
+        меньше размера результата, то модуль меньше 2^31, а размер результата не больше 2^23
+        */
+        template <class Modular>
+        std::vector<Modular>
+        operator()(std::vector<Modular> const & lhs, std::vector<Modular> const & rhs) const
+        {
+            if(lhs.empty() || rhs.empty())
+            {
+                return {};
+            }
+
+            if(std::min(lhs.size(), rhs.size()) < detail::polynomial_ntt_threshold)
+            {
+                return detail::polynomial_multiply_basecase(lhs, rhs);
+            }
+
+            auto const ntt_size = detail::ntt_size_for(lhs.size() + rhs.size() - 1);
+
+            if(detail::ntt_max_size(Modular::modulus()) % ntt_size == 0
+               && saga::is_prime(Modular::modulus()))
+            {
+                return detail::polynomial_multiply_ntt(lhs, rhs);
+            }
+
+            return detail::polynomial_multiply_crt(lhs, rhs);
+        }
+    };
+
+    inline constexpr auto const polynomial_multiply = polynomial_multiply_fn{};
+
+    struct polynomial_inverse_fn
+    {
+        /** @brief Первые @c num коэффициентов степенного ряда, обратного к @c series
+
+        Метод Ньютона: если <tt>f g = 1 + O(x^k)</tt>, то для <tt>g' = g (2 - f g)</tt>
+        выполняется <tt>f g' = 1 + O(x^(2k))</tt>.
+
+        @pre <tt>series[0]</tt> обратим
+        */
+        template <class Modular>
+        std::vector<Modular> operator()(std::vector<Modular> const & series, std::size_t num) const
+        {
+            assert(!series.empty());
+
+            if(num == 0)
+            {
+                return {};
+            }
+
+            auto const is_ntt_prime = saga::is_prime(Modular::modulus());
+
+            std::vector<Modular> result{series.front().inverse()};
+
+            for(auto size = std::size_t(1); size < num; size *= 2)
+            {
+                if(is_ntt_prime && detail::ntt_max_size(Modular::modulus()) % (2 * size) == 0)
+                {
+                    polynomial_inverse_fn::newton_step_ntt(series, result, size);
+                }
+                else
+                {
+                    polynomial_inverse_fn::newton_step(series, result, size);
+                }
+            }
+
+            result.resize(num);
+
+            return result;
+        }
+
+    private:
+        template <class Modular>
+        static void newton_step(std::vector<Modular> const & series
+                               , std::vector<Modular> & result, std::size_t size)
+        {
+            std::vector<Modular> head(series.begin()
+                                     , series.begin() + std::min(2 * size, series.size()));
+
+            auto correction = saga::polynomial_multiply(head, result);
+            detail::polynomial_truncate(correction, 2 * size);
+
+            for(auto & coefficient : correction)
+            {
+                coefficient = -coefficient;
+            }
+
+            correction.front() += Modular(2);
+
+            result = saga::polynomial_multiply(result, correction);
+            result.resize(2 * size);
+        }
+
+        /* Шаг Ньютона с циклическими свёртками длины 2k: в f g mod (x^(2k) - 1) младшие k
+        коэффициентов искажены переносом, а старшие совпадают с коэффициентами f g, и только они
+        нужны для вычисления старших k коэффициентов g'. Требуется пять преобразований длины 2k
+        вместо шести преобразований длины 4k при двух умножениях общего вида.
+        */
+        template <class Modular>
+        static void newton_step_ntt(std::vector<Modular> const & series
+                                   , std::vector<Modular> & result, std::size_t size)
+        {
+            auto const ntt = detail::polynomial_ntt<Modular>(2 * size);
+
+            std::vector<Modular> product(2 * size);
+            std::copy(series.begin(), series.begin() + std::min(2 * size, series.size())
+                     , product.begin());
+
+            std::vector<Modular> inverse(2 * size);
+            std::copy(result.begin(), result.end(), inverse.begin());
+
+            ntt.forward(product.data());
+            ntt.forward(inverse.data());
+
+            for(auto index = std::size_t(0); index < 2 * size; ++index)
+            {
+                product[index] *= inverse[index];
+            }
+
+            ntt.inverse(product.data());
+
+            std::fill(product.begin(), product.begin() + size, Modular(0));
+
+            ntt.forward(product.data());
+
+            for(auto index = std::size_t(0); index < 2 * size; ++index)
+            {
+                product[index] *= inverse[index];
+            }
+
+            ntt.inverse(product.data());
+
+            result.resize(2 * size);
+
+            for(auto index = size; index < 2 * size; ++index)
+            {
+                result[index] = -product[index];
+            }
+        }
+    };
+
+    inline constexpr auto const polynomial_inverse = polynomial_inverse_fn{};
+
+    struct polynomial_log_fn
+    {
+        /** @brief Первые @c num коэффициентов логарифма степенного ряда: <tt>log f = ∫ f' / f</tt>
+        @pre <tt>series[0] == 1</tt>
+        @pre модуль -- простое число, большее @c num
+        */
+        template <class Modular>
+        std::vector<Modular> operator()(std::vector<Modular> const & series, std::size_t num) const
+        {
+            assert(!series.empty() && series.front() == Modular(1));
+
+            if(num <= 1)
+            {
+                return std::vector<Modular>(num);
+            }
+
+            std::vector<Modular> derivative;
+
+            for(auto index = std::size_t(1); index < std::min(series.size(), num); ++index)
+            {
+                derivative.push_back(series[index] * Modular(index));
+            }
+
+            if(derivative.empty())
+            {
+                return std::vector<Modular>(num);
+            }
+
+            auto quotient = saga::polynomial_multiply(derivative
+                                                     , saga::polynomial_inverse(series, num - 1));
+            quotient.resize(num - 1);
+
+            // Интегрирование: деление на 1, 2, ..., num - 1
+            std::vector<Modular> inverses;
+            inverses.reserve(num - 1);
+
+            for(auto index = std::size_t(1); index < num; ++index)
+            {
+                inverses.emplace_back(index);
+            }
+
+            saga::modular_inverses(saga::cursor::all(inverses), saga::cursor::all(inverses));
+
+            std::vector<Modular> result(num);
+
+            for(auto index = std::size_t(1); index < num; ++index)
+            {
+                result[index] = quotient[index - 1] * inverses[index - 1];
+            }
+
+            return result;
+        }
+    };
+
+    inline constexpr auto const polynomial_log = polynomial_log_fn{};
+
+    struct polynomial_evaluate_fn
+    {
+        /** @brief Значения многочлена в заданных точках
+
+        Строится дерево произведений <tt>(x - a_i)</tt> по группам точек, затем остаток от деления
+        многочлена на произведение для узла передаётся его потомкам. В листьях значения
+        вычисляются по схеме Горнера.
+
+        @pre модуль -- простое число
+        */
+        template <class Modular>
+        std::vector<Modular>
+        operator()(std::vector<Modular> const & poly, std::vector<Modular> const & points) const
+        {
+            std::vector<Modular> result(points.size());
+
+            if(points.empty())
+            {
+                return result;
+            }
+
+            std::vector<std::vector<Modular>> tree;
+            polynomial_evaluate_fn::build(tree, points, 0, points.size(), 1);
+
+            polynomial_evaluate_fn::evaluate(tree, poly, points, 0, points.size(), 1, result);
+
+            return result;
+        }
+
+    private:
+        template <class Modular>
+        static void build(std::vector<std::vector<Modular>> & tree
+                         , std::vector<Modular> const & points
+                         , std::size_t first, std::size_t last, std::size_t node)
+        {
+            if(tree.size() <= node)
+            {
+                tree.resize(node + 1);
+            }
+
+            if(last - first <= detail::polynomial_evaluate_threshold)
+            {
+                auto & product = tree[node];
+                product.assign(1, Modular(1));
+
+                for(auto index = first; index < last; ++index)
+                {
+                    product.push_back(Modular(0));
+
+                    for(auto pos = product.size() - 1; pos > 0; --pos)
+                    {
+                        product[pos] = product[pos - 1] - product[pos] * points[index];
+                    }
+
+                    product[0] = -product[0] * points[index];
+                }
+
+                return;
+            }
+
+            auto const middle = first + (last - first) / 2;
+
+            polynomial_evaluate_fn::build(tree, points, first, middle, 2 * node);
+            polynomial_evaluate_fn::build(tree, points, middle, last, 2 * node + 1);
+
+            tree[node] = saga::polynomial_multiply(tree[2 * node], tree[2 * node + 1]);
+        }
+
+        template <class Modular>
+        static void evaluate(std::vector<std::vector<Modular>> const & tree
+                            , std::vector<Modular> poly, std::vector<Modular> const & points
+                            , std::size_t first, std::size_t last, std::size_t node
+                            , std::vector<Modular> & result)
+        {
+            poly = polynomial_evaluate_fn::remainder(std::move(poly), tree[node]);
+
+            if(last - first <= detail::polynomial_evaluate_threshold)
+            {
+                for(auto index = first; index < last; ++index)
+                {
+                    auto value = Modular(0);
+
+                    for(auto pos = poly.size(); pos > 0; --pos)
+                    {
+                        value = value * points[index] + poly[pos - 1];
+                    }
+
+                    result[index] = value;
+                }
+
+                return;
+            }
+
+            auto const middle = first + (last - first) / 2;
+
+            polynomial_evaluate_fn::evaluate(tree, poly, points, first, middle, 2 * node, result);
+            polynomial_evaluate_fn::evaluate(tree, std::move(poly), points, middle, last
+                                            , 2 * node + 1, result);
+        }
+
+        // Остаток от деления на приведённый многочлен через обращение перевёрнутого делителя
+        template <class Modular>
+        static std::vector<Modular>
+        remainder(std::vector<Modular> poly, std::vector<Modular> const & divisor)
+        {
+            assert(!divisor.empty() && divisor.back() == Modular(1));
+
+            if(poly.size() < divisor.size())
+            {
+                return poly;
+            }
+
+            auto const quotient_size = poly.size() - divisor.size() + 1;
+
+            std::vector<Modular> reversed_poly(poly.rbegin(), poly.rbegin() + quotient_size);
+            std::vector<Modular> reversed_divisor(divisor.rbegin(), divisor.rend());
+
+            auto quotient
+                = saga::polynomial_multiply(reversed_poly
+                                           , saga::polynomial_inverse(reversed_divisor
+                                                                     , quotient_size));
+            quotient.resize(quotient_size);
+            std::reverse(quotient.begin(), quotient.end());
+
+            auto const product = saga::polynomial_multiply(quotient, divisor);
+
+            poly.resize(divisor.size() - 1);
+
+            for(auto index = std::size_t(0); index < poly.size(); ++index)
+            {
+                poly[index] -= product[index];
+            }
+
+            return poly;
+        }
+    };
+
+    inline constexpr auto const polynomial_evaluate = polynomial_evaluate_fn{};
 }
 // namespace saga
 
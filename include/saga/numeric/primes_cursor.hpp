@@ -18,8 +18,22 @@ SAGA -- это свободной программное обеспечение:
 #ifndef Z_SAGA_NUMERIC_PRIMES_CURSOR_HPP_INCLUDED
 #define Z_SAGA_NUMERIC_PRIMES_CURSOR_HPP_INCLUDED
 
+/** @file saga/numeric/primes_cursor.hpp
+ @brief Курсор, последовательно накапливающий простые числа
+
+ Очередные простые числа берутся из сегментированного решета, применяемого к интервалам
+ [b, 2b) с удваивающейся границей b, поэтому в среднем на одно простое число приходится
+ O(log log n) операций. Когда граница достигает наибольшего значения типа, курсор исчерпывается
+ после последнего представимого простого числа.
+*/
+
 #include <saga/cursor/cursor_facade.hpp>
 #include <saga/numeric/is_prime.hpp>
+#include <saga/numeric/segmented_sieve.hpp>
+
+#include <cassert>
+#include <limits>
+#include <vector>
 
 namespace saga
 {
@@ -38,6 +52,8 @@ namespace saga
         // Создание, копирование, уничтожение
         primes_cursor()
          : primes_(1, IntType(2))
+         , segment_(IntType(3), primes_cursor::initial_bound)
+         , bound_(primes_cursor::initial_bound)
         {}
 
         primes_cursor(primes_cursor const &) = delete;
@@ -49,7 +65,7 @@ namespace saga
         // Курсор ввода
         bool operator!() const
         {
-            return false;
+            return this->exhausted_;
         }
 
         reference front() const
@@ -64,22 +80,52 @@ namespace saga
 
         void drop_front()
         {
-            auto num = this->primes_.back() + 1 + this->primes_.back() % 2;
+            assert(!!*this);
 
-            for(;;)
+            using Limits = std::numeric_limits<IntType>;
+
+            if(!this->segment_ && this->bound_ < Limits::max())
             {
-                if(saga::is_prime_sorted(num, this->primes_, saga::unsafe_tag_t{}))
+                auto const lo = this->bound_;
+
+                this->bound_ = (lo <= Limits::max() / 2) ? IntType(2 * lo) : Limits::max();
+
+                this->segment_ = saga::primes_in_cursor<IntType>(lo, this->bound_);
+            }
+
+            if(!this->segment_)
+            {
+                // Интервалы не включают верхнюю границу, поэтому наибольшее значение типа
+                // проверяется отдельно
+                if(!this->max_checked_)
                 {
-                    this->primes_.push_back(num);
-                    break;
+                    this->max_checked_ = true;
+
+                    if(saga::is_prime(Limits::max()))
+                    {
+                        this->primes_.push_back(Limits::max());
+                        return;
+                    }
                 }
 
-                num += ((num % 6 == 1) ? 4 : 2);
+                this->exhausted_ = true;
+                return;
             }
+
+            this->primes_.push_back(this->segment_.front());
+            this->segment_.drop_front();
         }
 
     private:
+        static constexpr IntType initial_bound
+            = (std::numeric_limits<IntType>::max() < 1024) ? std::numeric_limits<IntType>::max()
+                                                          : IntType(1024);
+
         Container primes_;
+        saga::primes_in_cursor<IntType> segment_;
+        IntType bound_;
+        bool max_checked_ = false;
+        bool exhausted_ = false;
     };
 }
 
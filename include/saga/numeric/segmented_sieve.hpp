@@ -0,0 +1,534 @@
+/* (c) 2026 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки SAGA.
+
+SAGA -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#ifndef Z_SAGA_NUMERIC_SEGMENTED_SIEVE_HPP_INCLUDED
+#define Z_SAGA_NUMERIC_SEGMENTED_SIEVE_HPP_INCLUDED
+
+/** @file saga/numeric/segmented_sieve.hpp
+ @brief Сегментированное решето Эратосфена с колесом по модулю 30
+
+ Каждый байт решета представляет 30 последовательных натуральных чисел: его биты соответствуют
+ восьми остаткам от деления на 30, взаимно простым с 30. Числа, кратные 7, 11, 13 и 17,
+ вычёркиваются копированием заранее вычисленного периодического образца, остальные простые
+ числа, не превосходящие квадратного корня из верхней границы, вычёркивают свои кратные
+ посегментно. Размер сегмента по умолчанию выбран так, чтобы сегмент помещался в кэш данных
+ первого уровня.
+*/
+
+#include <saga/cursor/cursor_facade.hpp>
+#include <saga/math.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+namespace saga
+{
+    namespace detail
+    {
+        struct wheel30_tables
+        {
+            // Остатки от деления на 30, взаимно простые с 30, и расстояния до следующего из них
+            std::uint8_t residues[8];
+            std::uint8_t gaps[8];
+
+            // Номер остатка среди взаимно простых с 30 или 8, если остаток не взаимно прост с 30
+            std::uint8_t index[30];
+
+            // Расстояние до ближайшего не меньшего числа, взаимно простого с 30
+            std::uint8_t to_coprime[30];
+
+            /* Для простого числа p с номером остатка i и множителя m с номером остатка j:
+            bit[i][j] -- номер бита, соответствующего произведению p * m, carry[i][j] -- перенос
+            номера байта при переходе к следующему множителю, взаимно простому с 30.
+            */
+            std::uint8_t bit[8][8];
+            std::uint8_t carry[8][8];
+        };
+
+        constexpr wheel30_tables make_wheel30_tables()
+        {
+            wheel30_tables result{};
+
+            auto num = 0;
+            for(auto rest = 0; rest < 30; ++rest)
+            {
+                result.index[rest] = 8;
+
+                if(rest % 2 != 0 && rest % 3 != 0 && rest % 5 != 0)
+                {
+                    result.index[rest] = std::uint8_t(num);
+                    result.residues[num] = std::uint8_t(rest);
+                    ++num;
+                }
+            }
+
+            for(auto index = 0; index < 8; ++index)
+            {
+                auto const next = (index == 7) ? 31 : result.residues[index + 1];
+                result.gaps[index] = std::uint8_t(next - result.residues[index]);
+            }
+
+            for(auto rest = 0; rest < 30; ++rest)
+            {
+                auto offset = 0;
+                for(; result.index[(rest + offset) % 30] == 8; ++offset)
+                {}
+
+                result.to_coprime[rest] = std::uint8_t(offset);
+            }
+
+            for(auto prime = 0; prime < 8; ++prime)
+            {
+                auto const pr = result.residues[prime];
+
+                for(auto mult = 0; mult < 8; ++mult)
+                {
+                    auto const mr = result.residues[mult];
+
+                    result.bit[prime][mult] = result.index[(pr * mr) % 30];
+                    result.carry[prime][mult]
+                        = std::uint8_t(pr * (mr + result.gaps[mult]) / 30 - pr * mr / 30);
+                }
+            }
+
+            return result;
+        }
+
+        inline constexpr wheel30_tables wheel30 = make_wheel30_tables();
+
+        /// @brief Количество младших нулевых битов ненулевого числа
+        inline unsigned countr_zero_64(std::uint64_t word)
+        {
+            assert(word != 0);
+
+#if defined(__GNUC__) || defined(__clang__)
+            return static_cast<unsigned>(__builtin_ctzll(word));
+#else
+            auto result = 0u;
+
+            for(; (word & 1) == 0; word >>= 1)
+            {
+                ++result;
+            }
+
+            return result;
+#endif
+        }
+
+        /// @brief Восемь последовательных байт решета как одно число: младший байт -- первый
+        inline std::uint64_t load_sieve_word(std::uint8_t const * first)
+        {
+            auto result = std::uint64_t(0);
+
+            for(auto index = 0u; index < 8; ++index)
+            {
+                result |= std::uint64_t(first[index]) << (8 * index);
+            }
+
+            return result;
+        }
+
+        /// @brief Количество единичных битов
+        inline unsigned popcount_64(std::uint64_t word)
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return static_cast<unsigned>(__builtin_popcountll(word));
+#else
+            auto result = 0u;
+
+            for(; word != 0; word &= word - 1)
+            {
+                ++result;
+            }
+
+            return result;
+#endif
+        }
+    }
+    // namespace detail
+
+    /** @brief Сегментированное решето Эратосфена с колесом по модулю 30
+
+    Позволяет последовательно просеивать сегменты чисел, меньших заданной верхней границы. Байт с
+    номером k соответствует числам 30k + r, где r взаимно просто с 30; бит установлен тогда и
+    только тогда, когда соответствующее число не имеет делителей, больших 5 и не превосходящих
+    квадратного корня из верхней границы. Числа 1, 2, 3 и 5 требуют отдельной обработки.
+    */
+    class wheel_sieve
+    {
+    public:
+        // Типы
+        using number_type = std::uint64_t;
+
+        // Константы
+        /// @brief Размер сегмента по умолчанию в байтах
+        static constexpr std::size_t default_segment_bytes = 32 * 1024;
+
+        /// @brief Количество последовательных чисел, представляемых одним байтом решета
+        static constexpr number_type numbers_per_byte = 30;
+
+        // Создание, копирование, уничтожение
+        /** @brief Конструктор
+        @param hi верхняя граница (не включается) просеиваемых чисел
+        */
+        explicit wheel_sieve(number_type hi)
+        {
+            auto const limit = (hi < 2) ? number_type(0) : saga::isqrt(hi - 1);
+
+            // Простые числа, не превосходящие limit: простое решето по нечётным числам
+            std::vector<bool> composite(limit / 2 + 1, false);
+
+            for(auto num = number_type(3); num <= limit; num += 2)
+            {
+                if(composite[num / 2])
+                {
+                    continue;
+                }
+
+                for(auto mult = num * num; mult <= limit; mult += 2 * num)
+                {
+                    composite[mult / 2] = true;
+                }
+
+                if(num > wheel_sieve::presieve_max)
+                {
+                    sieving_prime sp{};
+                    sp.prime = std::uint32_t(num);
+                    sp.quotient = std::uint32_t(num / 30);
+                    sp.residue_index = detail::wheel30.index[num % 30];
+
+                    this->primes_.push_back(sp);
+                }
+            }
+
+            this->seek(0);
+        }
+
+        // Решето
+        /// @brief Число, соответствующее биту @c bit байта с номером @c byte
+        static constexpr number_type number(number_type byte, unsigned bit)
+        {
+            assert(bit < 8);
+
+            return wheel_sieve::numbers_per_byte * byte + detail::wheel30.residues[bit];
+        }
+
+        /// @brief Номер байта, с которого начнётся следующий просеиваемый сегмент
+        number_type next_byte() const
+        {
+            return this->next_byte_;
+        }
+
+        /** @brief Переход к сегменту, начинающемуся с байта @c first_byte
+        @post <tt>this->next_byte() == first_byte</tt>
+        */
+        void seek(number_type first_byte)
+        {
+            auto const first_num = wheel_sieve::numbers_per_byte * first_byte;
+
+            for(auto & sp : this->primes_)
+            {
+                number_type const prime = sp.prime;
+
+                auto const start = std::max(prime * prime, first_num);
+                auto mult = (start + prime - 1) / prime;
+                mult += detail::wheel30.to_coprime[mult % 30];
+
+                sp.wheel_index = detail::wheel30.index[mult % 30];
+                sp.next_byte = prime * mult / wheel_sieve::numbers_per_byte;
+            }
+
+            this->next_byte_ = first_byte;
+        }
+
+        /** @brief Просеивание очередного сегмента из @c num_bytes байт
+        @param first начало сегмента, в который будет записан результат
+        @post <tt>this->next_byte()</tt> увеличивается на @c num_bytes
+        */
+        void sieve(std::uint8_t * first, std::size_t num_bytes)
+        {
+            auto const first_byte = this->next_byte_;
+            auto const last_byte = first_byte + num_bytes;
+
+            wheel_sieve::presieve(first, num_bytes, first_byte);
+
+            for(auto & sp : this->primes_)
+            {
+                auto byte = sp.next_byte;
+                auto wheel_index = sp.wheel_index;
+
+                auto const & bits = detail::wheel30.bit[sp.residue_index];
+                auto const & carry = detail::wheel30.carry[sp.residue_index];
+
+                for(; byte < last_byte; wheel_index = (wheel_index + 1) % 8)
+                {
+                    first[byte - first_byte] &= std::uint8_t(~(1u << bits[wheel_index]));
+                    byte += number_type(sp.quotient) * detail::wheel30.gaps[wheel_index]
+                          + carry[wheel_index];
+                }
+
+                sp.next_byte = byte;
+                sp.wheel_index = wheel_index;
+            }
+
+            this->next_byte_ = last_byte;
+        }
+
+    private:
+        // Наибольшее простое число, кратные которого вычёркиваются образцом
+        static constexpr number_type presieve_max = 17;
+
+        // Период образца: 7 * 11 * 13 * 17 байт
+        static constexpr std::size_t presieve_period = 7 * 11 * 13 * 17;
+
+        static std::vector<std::uint8_t> const & presieve_pattern()
+        {
+            static auto const pattern = []
+            {
+                std::vector<std::uint8_t> result(wheel_sieve::presieve_period, 0);
+
+                for(auto byte = std::size_t(0); byte < result.size(); ++byte)
+                {
+                    for(auto bit = 0u; bit < 8; ++bit)
+                    {
+                        auto const num = wheel_sieve::number(byte, bit);
+
+                        if(num % 7 != 0 && num % 11 != 0 && num % 13 != 0 && num % 17 != 0)
+                        {
+                            result[byte] |= std::uint8_t(1u << bit);
+                        }
+                    }
+                }
+
+                return result;
+            }();
+
+            return pattern;
+        }
+
+        static void presieve(std::uint8_t * first, std::size_t num_bytes, number_type first_byte)
+        {
+            auto const & pattern = wheel_sieve::presieve_pattern();
+
+            auto offset = std::size_t(first_byte % wheel_sieve::presieve_period);
+
+            for(auto pos = std::size_t(0); pos < num_bytes;)
+            {
+                auto const chunk = std::min(num_bytes - pos, pattern.size() - offset);
+
+                std::copy(pattern.begin() + offset, pattern.begin() + offset + chunk, first + pos);
+
+                pos += chunk;
+                offset = 0;
+            }
+
+            if(first_byte == 0 && num_bytes > 0)
+            {
+                // 1 -- не простое, а 7, 11, 13 и 17 были вычеркнуты образцом
+                first[0] = std::uint8_t((first[0] & ~1u) | 0x1Eu);
+            }
+        }
+
+        struct sieving_prime
+        {
+            std::uint32_t prime;
+            std::uint32_t quotient;
+            std::uint8_t residue_index;
+            std::uint8_t wheel_index;
+            number_type next_byte;
+        };
+
+        std::vector<sieving_prime> primes_;
+        number_type next_byte_ = 0;
+    };
+
+    /** @brief Курсор, последовательно выдающий простые числа из полуинтервала <tt>[lo, hi)</tt>
+
+    В каждый момент времени хранит только один сегмент решета и простые числа, не превосходящие
+    квадратного корня из @c hi, поэтому может перечислять простые числа в сколь угодно далёких
+    интервалах, не используя много памяти.
+    */
+    template <class IntType>
+    class primes_in_cursor
+     : saga::cursor_facade<primes_in_cursor<IntType>, IntType const &>
+    {
+        static_assert(std::is_integral<IntType>{}, "Must be integral type");
+
+        using number_type = wheel_sieve::number_type;
+
+    public:
+        // Типы
+        using cursor_category = std::input_iterator_tag;
+        using value_type = IntType;
+        using reference = IntType const &;
+        using difference_type = std::ptrdiff_t;
+
+        // Создание, копирование, уничтожение
+        /** @brief Конструктор
+        @param lo нижняя граница (включается)
+        @param hi верхняя граница (не включается)
+        @param segment_bytes размер сегмента решета в байтах
+        */
+        primes_in_cursor(IntType lo, IntType hi
+                        , std::size_t segment_bytes = wheel_sieve::default_segment_bytes)
+         : lo_(lo < 0 ? 0 : number_type(lo))
+         , hi_(hi < 0 ? 0 : number_type(hi))
+         , sieve_(this->hi_)
+         , segment_((std::max(segment_bytes, std::size_t(1)) + 7) / 8 * 8)
+        {
+            this->sieve_.seek(this->lo_ / wheel_sieve::numbers_per_byte);
+            this->position_ = this->segment_.size();
+            this->segment_size_ = this->segment_.size();
+
+            this->find_next();
+        }
+
+        // Курсор ввода
+        bool operator!() const
+        {
+            return this->done_;
+        }
+
+        reference front() const
+        {
+            assert(!!*this);
+
+            return this->current_;
+        }
+
+        void drop_front()
+        {
+            assert(!!*this);
+
+            this->find_next();
+        }
+
+    private:
+        void find_next()
+        {
+            static constexpr number_type small_primes[] = {2, 3, 5};
+
+            for(; this->small_index_ < std::size(small_primes);)
+            {
+                auto const prime = small_primes[this->small_index_++];
+
+                if(this->lo_ <= prime && prime < this->hi_)
+                {
+                    this->current_ = IntType(prime);
+                    return;
+                }
+            }
+
+            for(;;)
+            {
+                if(this->word_ == 0)
+                {
+                    if(!this->load_next_word())
+                    {
+                        this->done_ = true;
+                        return;
+                    }
+
+                    continue;
+                }
+
+                auto const index = detail::countr_zero_64(this->word_);
+                this->word_ &= this->word_ - 1;
+
+                auto const num = wheel_sieve::number(this->word_byte_ + index / 8, index % 8);
+
+                if(num >= this->hi_)
+                {
+                    this->done_ = true;
+                    return;
+                }
+
+                if(num >= this->lo_)
+                {
+                    this->current_ = IntType(num);
+                    return;
+                }
+            }
+        }
+
+        bool load_next_word()
+        {
+            if(this->position_ == this->segment_size_)
+            {
+                auto const first_byte = this->sieve_.next_byte();
+                auto const last_byte = (this->hi_ + wheel_sieve::numbers_per_byte - 1)
+                                     / wheel_sieve::numbers_per_byte;
+
+                if(first_byte >= last_byte)
+                {
+                    return false;
+                }
+
+                auto const rest = (last_byte - first_byte + 7) / 8 * 8;
+
+                this->segment_size_ = std::size_t(std::min(number_type(this->segment_.size())
+                                                          , rest));
+                this->segment_first_ = first_byte;
+                this->position_ = 0;
+
+                this->sieve_.sieve(this->segment_.data(), this->segment_size_);
+            }
+
+            this->word_ = detail::load_sieve_word(this->segment_.data() + this->position_);
+
+            this->word_byte_ = this->segment_first_ + this->position_;
+            this->position_ += 8;
+
+            return true;
+        }
+
+        number_type lo_ = 0;
+        number_type hi_ = 0;
+        wheel_sieve sieve_;
+        std::vector<std::uint8_t> segment_;
+        std::size_t segment_size_ = 0;
+        std::size_t position_ = 0;
+        number_type segment_first_ = 0;
+        number_type word_byte_ = 0;
+        std::uint64_t word_ = 0;
+        std::size_t small_index_ = 0;
+        IntType current_ = 0;
+        bool done_ = false;
+    };
+
+    namespace cursor
+    {
+        /** @brief Курсор, последовательно выдающий простые числа из полуинтервала
+        <tt>[lo, hi)</tt>
+        */
+        template <class IntType>
+        primes_in_cursor<IntType>
+        primes_in(IntType lo, IntType hi)
+        {
+            return primes_in_cursor<IntType>(std::move(lo), std::move(hi));
+        }
+    }
+    // namespace cursor
+}
+// namespace saga
+
+#endif
+// Z_SAGA_NUMERIC_SEGMENTED_SIEVE_HPP_INCLUDED
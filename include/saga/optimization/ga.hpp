@@ -37,6 +37,49 @@ SAGA -- это свободной программное обеспечение:
 
 namespace saga
 {
+    namespace detail
+    {
+        template <class Container, class Size, class Objective, class UniformRandomBitGenerator
+                 , class... GenotypeArgs>
+        Container
+        ga_boolen_initial_population(Container population
+                                     , typename Container::difference_type const population_size
+                                     , Size const dim
+                                     , Objective objective
+                                     , UniformRandomBitGenerator & rnd_engine
+                                     , GenotypeArgs const &... genotype_args)
+        {
+            assert(population_size >= 0);
+            assert(dim >= 0);
+
+            auto const pop_size = static_cast<typename Container::size_type>(population_size);
+
+            using Individual = typename Container::value_type;
+            using Genotype = typename Individual::solution_type;
+
+            saga::iid_distribution<std::bernoulli_distribution, Genotype> distr(dim);
+
+            auto generator = [&]
+            {
+                auto x = distr(rnd_engine, genotype_args...);
+                auto y = objective(x);
+
+                return Individual{std::move(x), std::move(y)};
+            };
+
+            population.reserve(pop_size);
+
+            saga::generate(saga::cursor::all(population), generator);
+
+            assert(population.size() <= pop_size);
+            std::generate_n(std::back_inserter(population), pop_size - population.size()
+                           , generator);
+
+            return population;
+        }
+    }
+    // namespace detail
+
     /** @brief Инициализация начальной популяции генетического алгоритма псведо-булевой оптимизации
     @tparam Container тип контейнера, используемого для хранения популяции
     @param population_size требуемый размер начальной популяции
@@ -53,33 +96,35 @@ namespace saga
                                  , Objective objective
                                  , UniformRandomBitGenerator & rnd_engine)
     {
-        assert(population_size >= 0);
-        assert(dim >= 0);
-
-        auto const pop_size = static_cast<typename Container::size_type>(population_size);
-
-        using Individual = typename Container::value_type;
-        using Genotype = typename Individual::solution_type;
+        return detail::ga_boolen_initial_population(Container(), population_size, dim
+                                                   , std::move(objective), rnd_engine);
+    }
 
-        saga::iid_distribution<std::bernoulli_distribution, Genotype> distr(dim);
+    /** @brief Инициализация начальной популяции, размещаемой с помощью распределителя памяти
+    @param alloc распределитель памяти популяции, он же используется для генотипов, если они
+    поддерживают распределители памяти такого типа
+    */
+    template <class Container, class Size, class Objective, class UniformRandomBitGenerator>
+    Container
+    ga_boolen_initial_population(typename Container::difference_type const population_size
+                                 , Size const dim
+                                 , Objective objective
+                                 , UniformRandomBitGenerator & rnd_engine
+                                 , typename Container::allocator_type const & alloc)
+    {
+        using Genotype = typename Container::value_type::solution_type;
+        using Allocator = typename Container::allocator_type;
 
-        auto generator = [&]
+        if constexpr(std::uses_allocator<Genotype, Allocator>{})
         {
-            auto x = distr(rnd_engine);
-            auto y = objective(x);
-
-            return Individual{std::move(x), std::move(y)};
-        };
-
-        Container population;
-        population.reserve(pop_size);
-
-        saga::generate(saga::cursor::all(population), generator);
-
-        assert(population.size() <= pop_size);
-        std::generate_n(std::back_inserter(population), pop_size - population.size(), generator);
-
-        return population;
+            return detail::ga_boolen_initial_population(Container(alloc), population_size, dim
+                                                       , std::move(objective), rnd_engine, alloc);
+        }
+        else
+        {
+            return detail::ga_boolen_initial_population(Container(alloc), population_size, dim
+                                                       , std::move(objective), rnd_engine);
+        }
     }
 
     class ga_boolean_mutation_xor_fn
@@ -171,7 +216,7 @@ namespace saga
         auto s_distr = settings.selection.build_distribution(obj_values, problem.compare);
 
         // Репродукция: селекция, скрещивание, нормальная мутация
-        std::vector<Individual> kids;
+        Population kids(population.get_allocator());
         kids.reserve(settings.population_size);
 
         assert(s_distr.min() == 0);
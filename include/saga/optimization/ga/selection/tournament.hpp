@@ -22,6 +22,7 @@ SAGA -- это свободной программное обеспечение:
  @brief Реализация турнирной селекции
 */
 
+#include <saga/container/small_vector.hpp>
 #include <saga/utility/equality_comparable_box.hpp>
 
 #include <cassert>
@@ -135,7 +136,8 @@ namespace saga
         result_type
         selection_no_repeat(UniformRandomBitGenerator & rnd) const
         {
-            std::vector<result_type> selected;
+            // Обычно размер турнира невелик: участники хранятся без выделения памяти
+            saga::small_vector<result_type, 8> selected;
             selected.reserve(this->tournament_);
 
             std::uniform_real_distribution<double> distr(0.0, 1.0);
@@ -43,6 +43,12 @@ namespace saga
         }
     };
 
+    /** @brief Количество позиций, в которых различаются векторы @c x и @c y одинаковой длины
+
+    Для непрерывных контейнеров целочисленных элементов (например, std::vector<char>) подсчёт
+    выполняется векторизованной реализацией saga::inner_product. Итераторы std::vector<bool> не
+    являются непрерывными, поэтому для него используется поэлементный цикл.
+    */
     struct boolean_manhattan_distance_fn
     {
         template <class BooleanVector1, class BooleanVector2>
@@ -28,6 +28,7 @@ SAGA -- это свободной программное обеспечение:
 #include <saga/type_traits.hpp>
 
 #include <algorithm>
+#include <memory>
 #include <vector>
 
 namespace saga
@@ -79,6 +80,21 @@ namespace saga
             return result;
         }
 
+        /** @brief Порождение значений в контейнере, использующем распределитель памяти @c alloc
+        @param engine генератор равномерно распределённых бит, используемый для порождения значений
+        @param alloc распределитель памяти для порождённого значения
+        */
+        template <class UniformRandomBitGenerator, class Allocator
+                 , class = std::enable_if_t<std::uses_allocator<result_type, Allocator>{}>>
+        result_type operator()(UniformRandomBitGenerator & engine, Allocator const & alloc)
+        {
+            result_type result(this->dim(), alloc);
+
+            saga::generate(saga::cursor::all(result), [&]{ return this->distr_(engine); });
+
+            return result;
+        }
+
         // Характеристики
         /** @brief Размерность порождаемых значений
         @return Размерность значений, порождаемых данным распределением
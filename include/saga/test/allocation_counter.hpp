@@ -0,0 +1,231 @@
+/* (c) 2026 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки SAGA.
+
+SAGA -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#ifndef Z_SAGA_TEST_ALLOCATION_COUNTER_HPP_INCLUDED
+#define Z_SAGA_TEST_ALLOCATION_COUNTER_HPP_INCLUDED
+
+/** @file saga/test/allocation_counter.hpp
+ @brief Подсчёт динамических выделений памяти
+
+ Счётчики увеличиваются заменяющими операторами new и delete, включая их варианты с размером и
+ выравниванием. Чтобы их определить, нужно ровно в одной единице трансляции программы определить
+ макрос SAGA_TEST_DEFINE_COUNTING_OPERATOR_NEW перед включением этого файла. Без этого счётчики
+ остаются нулевыми.
+*/
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace saga
+{
+    /// @brief Количество выделений и освобождений памяти
+    struct allocation_counts
+    {
+        std::ptrdiff_t allocations = 0;
+        std::ptrdiff_t deallocations = 0;
+        std::ptrdiff_t allocated_bytes = 0;
+    };
+
+    inline allocation_counts operator-(allocation_counts const & lhs, allocation_counts const & rhs)
+    {
+        return {lhs.allocations - rhs.allocations, lhs.deallocations - rhs.deallocations
+               , lhs.allocated_bytes - rhs.allocated_bytes};
+    }
+
+    class allocation_counter
+    {
+    public:
+        // Типы
+        using count_type = std::ptrdiff_t;
+
+        // Счётчики
+        /// @brief Значения счётчиков с момента запуска программы
+        static allocation_counts total()
+        {
+            return {allocation_counter::allocations_ref().load(std::memory_order_relaxed)
+                   , allocation_counter::deallocations_ref().load(std::memory_order_relaxed)
+                   , allocation_counter::bytes_ref().load(std::memory_order_relaxed)};
+        }
+
+        static void record_allocation(std::size_t size) noexcept
+        {
+            allocation_counter::allocations_ref().fetch_add(1, std::memory_order_relaxed);
+            allocation_counter::bytes_ref().fetch_add(static_cast<count_type>(size)
+                                                      , std::memory_order_relaxed);
+        }
+
+        static void record_deallocation() noexcept
+        {
+            allocation_counter::deallocations_ref().fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // Создание, копирование, уничтожение
+        /// @brief Начинает подсчёт выделений памяти с текущего момента
+        allocation_counter()
+         : start_(allocation_counter::total())
+        {}
+
+        // Результаты
+        /// @brief Значения счётчиков с момента создания этого объекта
+        allocation_counts counts() const
+        {
+            return allocation_counter::total() - this->start_;
+        }
+
+    private:
+        allocation_counts start_;
+
+        using count_impl_type = std::atomic<count_type>;
+
+        static count_impl_type & allocations_ref()
+        {
+            static count_impl_type instance{0};
+            return instance;
+        }
+
+        static count_impl_type & deallocations_ref()
+        {
+            static count_impl_type instance{0};
+            return instance;
+        }
+
+        static count_impl_type & bytes_ref()
+        {
+            static count_impl_type instance{0};
+            return instance;
+        }
+    };
+}
+// namespace saga
+
+#ifdef SAGA_TEST_DEFINE_COUNTING_OPERATOR_NEW
+namespace saga
+{
+    namespace detail
+    {
+        /* Выделение и освобождение памяти вынесены в функции, которые не встраиваются: иначе после
+        встраивания оператора delete компилятор видит, что память, полученная от оператора new,
+        освобождается функцией std::free, и выдаёт предупреждение -Wmismatched-new-delete.
+        */
+        [[gnu::noinline]] void * counting_allocate(std::size_t size, std::size_t alignment)
+        {
+            saga::allocation_counter::record_allocation(size);
+
+            if(size == 0)
+            {
+                size = 1;
+            }
+
+            void * ptr = nullptr;
+
+            if(alignment <= alignof(std::max_align_t))
+            {
+                ptr = std::malloc(size);
+            }
+            else
+            {
+                // std::aligned_alloc требует, чтобы размер был кратен выравниванию
+                ptr = std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+            }
+
+            if(ptr == nullptr)
+            {
+                throw std::bad_alloc{};
+            }
+
+            return ptr;
+        }
+
+        [[gnu::noinline]] void counting_deallocate(void * ptr) noexcept
+        {
+            if(ptr != nullptr)
+            {
+                saga::allocation_counter::record_deallocation();
+                std::free(ptr);
+            }
+        }
+    }
+    // namespace detail
+}
+// namespace saga
+
+void * operator new(std::size_t size)
+{
+    return saga::detail::counting_allocate(size, alignof(std::max_align_t));
+}
+
+void * operator new[](std::size_t size)
+{
+    return saga::detail::counting_allocate(size, alignof(std::max_align_t));
+}
+
+void * operator new(std::size_t size, std::align_val_t alignment)
+{
+    return saga::detail::counting_allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void * operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return saga::detail::counting_allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void * ptr) noexcept
+{
+    saga::detail::counting_deallocate(ptr);
+}
+
+void operator delete[](void * ptr) noexcept
+{
+    saga::detail::counting_deallocate(ptr);
+}
+
+void operator delete(void * ptr, std::size_t) noexcept
+{
+    saga::detail::counting_deallocate(ptr);
+}
+
+void operator delete[](void * ptr, std::size_t) noexcept
+{
+    saga::detail::counting_deallocate(ptr);
+}
+
+void operator delete(void * ptr, std::align_val_t) noexcept
+{
+    saga::detail::counting_deallocate(ptr);
+}
+
+void operator delete[](void * ptr, std::align_val_t) noexcept
+{
+    saga::detail::counting_deallocate(ptr);
+}
+
+void operator delete(void * ptr, std::size_t, std::align_val_t) noexcept
+{
+    saga::detail::counting_deallocate(ptr);
+}
+
+void operator delete[](void * ptr, std::size_t, std::align_val_t) noexcept
+{
+    saga::detail::counting_deallocate(ptr);
+}
+#endif
+// SAGA_TEST_DEFINE_COUNTING_OPERATOR_NEW
+
+#endif
+// Z_SAGA_TEST_ALLOCATION_COUNTER_HPP_INCLUDED
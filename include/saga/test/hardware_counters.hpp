@@ -0,0 +1,180 @@
+/* (c) 2026 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки SAGA.
+
+SAGA -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#ifndef Z_SAGA_TEST_HARDWARE_COUNTERS_HPP_INCLUDED
+#define Z_SAGA_TEST_HARDWARE_COUNTERS_HPP_INCLUDED
+
+/** @file saga/test/hardware_counters.hpp
+ @brief Аппаратные счётчики производительности (такты, промахи кэша, ошибки предсказания
+ переходов)
+
+ Используется системный вызов perf_event_open, доступный только в Linux. Если он недоступен
+ (другая ОС, запрет в /proc/sys/kernel/perf_event_paranoid, виртуальная машина без PMU), то
+ соответствующие счётчики просто считаются недоступными, а их значения равны -1.
+*/
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/perf_event.h>)
+#define SAGA_HAS_PERF_EVENT 1
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+#endif
+// SAGA_HAS_PERF_EVENT
+
+namespace saga
+{
+    /// @brief Значения аппаратных счётчиков, -1 означает, что счётчик недоступен
+    struct hardware_counts
+    {
+        std::int64_t cycles = -1;
+        std::int64_t instructions = -1;
+        std::int64_t cache_misses = -1;
+        std::int64_t branch_misses = -1;
+    };
+
+    class hardware_counters
+    {
+    public:
+        // Создание, копирование, уничтожение
+        hardware_counters()
+        {
+#ifdef SAGA_HAS_PERF_EVENT
+            std::array<std::uint64_t, event_count> const configs
+                = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS
+                  , PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+
+            for(auto index = std::size_t(0); index < event_count; ++index)
+            {
+                this->fds_[index] = hardware_counters::open_event(configs[index]);
+            }
+#endif
+        }
+
+        hardware_counters(hardware_counters const &) = delete;
+        hardware_counters & operator=(hardware_counters const &) = delete;
+
+        ~hardware_counters()
+        {
+#ifdef SAGA_HAS_PERF_EVENT
+            for(auto fd : this->fds_)
+            {
+                if(fd >= 0)
+                {
+                    ::close(fd);
+                }
+            }
+#endif
+        }
+
+        // Свойства
+        /// @brief Доступен ли хотя бы один счётчик
+        bool available() const
+        {
+            for(auto fd : this->fds_)
+            {
+                if(fd >= 0)
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        // Измерение
+        /// @brief Обнуление и запуск счётчиков
+        void start()
+        {
+#ifdef SAGA_HAS_PERF_EVENT
+            for(auto fd : this->fds_)
+            {
+                if(fd >= 0)
+                {
+                    ::ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+                    ::ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+                }
+            }
+#endif
+        }
+
+        /** @brief Остановка счётчиков
+        @return Значения счётчиков с момента последнего вызова start()
+        */
+        hardware_counts stop()
+        {
+            std::array<std::int64_t, event_count> values;
+            values.fill(-1);
+
+#ifdef SAGA_HAS_PERF_EVENT
+            for(auto index = std::size_t(0); index < event_count; ++index)
+            {
+                auto const fd = this->fds_[index];
+
+                if(fd < 0)
+                {
+                    continue;
+                }
+
+                ::ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+
+                std::uint64_t value = 0;
+
+                if(::read(fd, &value, sizeof(value)) == sizeof(value))
+                {
+                    values[index] = static_cast<std::int64_t>(value);
+                }
+            }
+#endif
+
+            return {values[0], values[1], values[2], values[3]};
+        }
+
+    private:
+        static constexpr std::size_t event_count = 4;
+
+#ifdef SAGA_HAS_PERF_EVENT
+        static int open_event(std::uint64_t config)
+        {
+            perf_event_attr attr;
+            std::memset(&attr, 0, sizeof(attr));
+
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.size = sizeof(attr);
+            attr.config = config;
+            attr.disabled = 1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+
+            return static_cast<int>(::syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+        }
+#endif
+        // SAGA_HAS_PERF_EVENT
+
+        std::array<int, event_count> fds_ = {-1, -1, -1, -1};
+    };
+}
+// namespace saga
+
+#endif
+// Z_SAGA_TEST_HARDWARE_COUNTERS_HPP_INCLUDED
@@ -0,0 +1,105 @@
+/* (c) 2026 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки SAGA.
+
+SAGA -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+#ifndef Z_SAGA_TEST_OPERATION_COUNTER_HPP_INCLUDED
+#define Z_SAGA_TEST_OPERATION_COUNTER_HPP_INCLUDED
+
+/** @file saga/test/operation_counter.hpp
+ @brief Подсчёт сравнений, копирований и перемещений, выполненных алгоритмом
+
+ Подсчёт основан на трассировщиках saga::invocable_tracer (для функции сравнения) и
+ saga::regular_tracer (для элементов), поэтому счётчики общие для всех объектов с одним и тем же
+ типом трассировщика. Чтобы разные тесты не влияли друг на друга, можно использовать разные теги.
+*/
+
+#include <saga/test/invocable_tracer.hpp>
+#include <saga/test/regular_tracer.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+namespace saga
+{
+    /// @brief Количество операций над элементами и вызовов функционального объекта
+    struct operation_counts
+    {
+        std::ptrdiff_t invocations = 0;
+        std::ptrdiff_t copies = 0;
+        std::ptrdiff_t moves = 0;
+        std::ptrdiff_t equality_comparisons = 0;
+    };
+
+    inline operation_counts operator-(operation_counts const & lhs, operation_counts const & rhs)
+    {
+        return {lhs.invocations - rhs.invocations, lhs.copies - rhs.copies
+               , lhs.moves - rhs.moves, lhs.equality_comparisons - rhs.equality_comparisons};
+    }
+
+    /** @brief Счётчик операций
+    @tparam RegularTracer специализация saga::regular_tracer, операции с которой подсчитываются,
+    или @c void
+    @tparam InvocableTracer специализация saga::invocable_tracer, вызовы которой подсчитываются,
+    или @c void
+    */
+    template <class RegularTracer, class InvocableTracer = void>
+    class operation_counter
+    {
+    public:
+        // Счётчики
+        /// @brief Значения счётчиков с момента запуска программы
+        static operation_counts total()
+        {
+            operation_counts result;
+
+            if constexpr (!std::is_void<InvocableTracer>{})
+            {
+                result.invocations = InvocableTracer::invoke_count();
+            }
+
+            if constexpr (!std::is_void<RegularTracer>{})
+            {
+                result.copies = RegularTracer::copy_constructed()
+                              + RegularTracer::copy_assignments();
+                result.moves = RegularTracer::move_constructed()
+                             + RegularTracer::move_assignments();
+                result.equality_comparisons = RegularTracer::equality_comparisons();
+            }
+
+            return result;
+        }
+
+        // Создание, копирование, уничтожение
+        /// @brief Начинает подсчёт операций с текущего момента
+        operation_counter()
+         : start_(operation_counter::total())
+        {}
+
+        // Результаты
+        /// @brief Значения счётчиков с момента создания этого объекта
+        operation_counts counts() const
+        {
+            return operation_counter::total() - this->start_;
+        }
+
+    private:
+        operation_counts start_;
+    };
+}
+// namespace saga
+
+#endif
+// Z_SAGA_TEST_OPERATION_COUNTER_HPP_INCLUDED
@@ -32,6 +32,8 @@ SAGA -- это свободной программное обеспечение:
 #include <saga/cursor/indices.hpp>
 #include <saga/cursor/iota.hpp>
 #include <saga/cursor/filter.hpp>
+#include <saga/cursor/from_chars.hpp>
+#include <saga/cursor/lines.hpp>
 #include <saga/cursor/set_union.hpp>
 #include <saga/cursor/stride.hpp>
 #include <saga/cursor/take_while.hpp>
@@ -39,6 +41,7 @@ SAGA -- это свободной программное обеспечение:
 #include <saga/cursor/transform.hpp>
 #include <saga/flat_set.hpp>
 #include <saga/math.hpp>
+#include <saga/memory/mapped_file.hpp>
 #include <saga/numeric.hpp>
 #include <saga/numeric/is_prime.hpp>
 #include <saga/numeric/primes_cursor.hpp>
@@ -49,6 +52,7 @@ SAGA -- это свободной программное обеспечение:
 #include <saga/utility/functional_macro.hpp>
 
 #include <optional>
+#include <string_view>
 #include <vector>
 
 // Тесты
@@ -3290,44 +3294,16 @@ namespace
         return table.back().back();
     }
 
-    template <class IntType, class IStream>
-    std::vector<IntType>
-    read_csv_line(IStream & input)
-    {
-        std::vector<IntType> result;
-
-        auto num = IntType();
-        input >> num;
-
-        for(; !!input;)
-        {
-            result.push_back(std::move(num));
-
-            auto reader = input.get();
-
-            if(!input || reader == '\n')
-            {
-                break;
-            }
-
-            assert(reader == ',');
-
-            input >> num;
-        }
-
-
-        return result;
-    }
-
-    template <class IntType, class IStream>
+    template <class IntType>
     std::vector<std::vector<IntType>>
-    read_csv(IStream & input)
+    read_csv(std::string_view text)
     {
         std::vector<std::vector<IntType>> table;
 
-        for(; !!input;)
+        for(auto lines = saga::cursor::lines(text); !!lines; ++lines)
         {
-            auto row = ::read_csv_line<IntType>(input);
+            auto row = saga::cursor::from_chars<IntType>(*lines)
+                     | saga::cursor::to<std::vector>();
 
             if(!row.empty())
             {
@@ -3354,11 +3330,9 @@ TEST_CASE("PE 081")
         REQUIRE(path_sum_two_ways(table_1) == 2427);
     }
     {
-        std::ifstream file("ProjectEuler/p081_matrix.txt");
-
-        REQUIRE(file);
+        saga::mapped_file const file("ProjectEuler/p081_matrix.txt");
 
-        auto const table_2 = ::read_csv<int>(file);
+        auto const table_2 = ::read_csv<int>(file.view());
 
         REQUIRE(table_2.size() == 80);
         REQUIRE(table_2.front().size() == 80);
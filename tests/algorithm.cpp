@@ -30,11 +30,15 @@ SAGA -- это свободной программное обеспечение:
 #include <saga/cursor/take.hpp>
 #include <saga/iterator/reverse.hpp>
 #include <saga/math.hpp>
+#include <saga/test/allocation_counter.hpp>
+#include <saga/test/operation_counter.hpp>
 #include <saga/utility/functional_macro.hpp>
 
+#include <cmath>
 #include <forward_list>
 #include <list>
 #include <string>
+#include <valarray>
 #include <vector>
 
 // Тесты
@@ -3776,6 +3780,207 @@ TEST_CASE("set_union")
     << ::test_set_union_subcursor<Container, saga_test::strict_weak_order<Value>>;
 }
 
+namespace
+{
+    template <class Value, class... Args>
+    void test_set_operations_adaptive(std::vector<Value> in1_src, std::vector<Value> in2_src
+                                     , std::vector<Value> const & out_src_old, Args... cmp)
+    {
+        static_assert(sizeof...(Args) <= 1);
+
+        std::sort(in1_src.begin(), in1_src.end(), cmp...);
+        std::sort(in2_src.begin(), in2_src.end(), cmp...);
+
+        auto const in1 = saga_test::random_subcursor_of(saga::cursor::all(in1_src));
+        auto const in2 = saga_test::random_subcursor_of(saga::cursor::all(in2_src));
+
+        // includes
+        REQUIRE(saga::includes_adaptive(in1, in2, cmp...)
+                == std::includes(in1.begin(), in1.end(), in2.begin(), in2.end(), cmp...));
+
+        // set_difference
+        {
+            auto out_saga = out_src_old;
+            auto const out = saga_test::random_subcursor_of(saga::cursor::all(out_saga));
+
+            auto const result = saga::set_difference_adaptive(in1, in2, out, cmp...);
+
+            auto out_std = out_src_old;
+            std::set_difference(in1.begin(), result.in.begin(), in2.begin(), in2.end()
+                               , saga::rebase_cursor(out, out_std).begin(), cmp...);
+
+            REQUIRE(out_saga == out_std);
+        }
+
+        // set_intersection
+        {
+            auto out_saga = out_src_old;
+            auto const out = saga_test::random_subcursor_of(saga::cursor::all(out_saga));
+
+            auto const result = saga::set_intersection_adaptive(in1, in2, out, cmp...);
+
+            auto out_std = out_src_old;
+            std::set_intersection(in1.begin(), result.in1.begin(), in2.begin()
+                                 , result.in2.begin(), saga::rebase_cursor(out, out_std).begin()
+                                 , cmp...);
+
+            REQUIRE(out_saga == out_std);
+        }
+
+        // set_union
+        {
+            auto out_saga = out_src_old;
+            auto const out = saga_test::random_subcursor_of(saga::cursor::all(out_saga));
+
+            auto const result = saga::set_union_adaptive(in1, in2, out, cmp...);
+
+            auto out_std = out_src_old;
+            std::set_union(in1.begin(), result.in1.begin(), in2.begin(), result.in2.begin()
+                          , saga::rebase_cursor(out, out_std).begin(), cmp...);
+
+            REQUIRE(out_saga == out_std);
+        }
+    }
+}
+
+TEST_CASE("set operations adaptive: same as std")
+{
+    using Value = int;
+
+    saga_test::property_checker
+    << ::test_set_operations_adaptive<Value>
+    << ::test_set_operations_adaptive<Value, saga_test::strict_weak_order<Value>>;
+}
+
+TEST_CASE("set operations adaptive: skewed sizes")
+{
+    saga_test::property_checker
+    << [](std::vector<long> large, std::vector<long> const & small_src
+         , saga_test::container_size<std::size_t> const & repeat)
+    {
+        // Большой курсор со сериями повторяющихся элементов
+        for(auto count = repeat.value; count > 0; --count)
+        {
+            large.insert(large.end(), large.begin(), large.end());
+
+            if(large.size() > 10'000)
+            {
+                break;
+            }
+        }
+
+        std::sort(large.begin(), large.end());
+
+        std::vector<long> small;
+        for(auto index = std::size_t(0); index < small_src.size(); ++index)
+        {
+            small.push_back(index % 2 == 0 && !large.empty()
+                            ? large[static_cast<std::size_t>(small_src[index]) % large.size()]
+                            : small_src[index]);
+        }
+        std::sort(small.begin(), small.end());
+
+        for(auto const & [in1, in2] : {std::pair(large, small), std::pair(small, large)})
+        {
+            std::vector<long> expected;
+            std::vector<long> actual;
+
+            std::set_intersection(in1.begin(), in1.end(), in2.begin(), in2.end()
+                                 , std::back_inserter(expected));
+            saga::set_intersection_adaptive(saga::cursor::all(in1), saga::cursor::all(in2)
+                                           , saga::back_inserter(actual));
+            REQUIRE(actual == expected);
+
+            expected.clear();
+            actual.clear();
+            std::set_difference(in1.begin(), in1.end(), in2.begin(), in2.end()
+                               , std::back_inserter(expected));
+            saga::set_difference_adaptive(saga::cursor::all(in1), saga::cursor::all(in2)
+                                         , saga::back_inserter(actual));
+            REQUIRE(actual == expected);
+
+            expected.clear();
+            actual.clear();
+            std::set_union(in1.begin(), in1.end(), in2.begin(), in2.end()
+                          , std::back_inserter(expected));
+            saga::set_union_adaptive(saga::cursor::all(in1), saga::cursor::all(in2)
+                                    , saga::back_inserter(actual));
+            REQUIRE(actual == expected);
+
+            REQUIRE(saga::includes_adaptive(saga::cursor::all(in1), saga::cursor::all(in2))
+                    == std::includes(in1.begin(), in1.end(), in2.begin(), in2.end()));
+        }
+    };
+}
+
+namespace
+{
+    template <class Value, class... Args>
+    void test_set_intersection_k(std::vector<std::vector<Value>> inputs, Args... cmp)
+    {
+        static_assert(sizeof...(Args) <= 1);
+
+        for(auto & input : inputs)
+        {
+            std::sort(input.begin(), input.end(), cmp...);
+        }
+
+        // Ожидаемый результат: последовательные попарные пересечения
+        std::vector<Value> expected;
+
+        if(!inputs.empty())
+        {
+            expected = inputs.front();
+
+            for(auto const & input : inputs)
+            {
+                std::vector<Value> next;
+                std::set_intersection(expected.begin(), expected.end()
+                                     , input.begin(), input.end()
+                                     , std::back_inserter(next), cmp...);
+                expected = std::move(next);
+            }
+        }
+
+        using Cursor = decltype(saga::cursor::all(std::as_const(inputs.front())));
+
+        std::vector<Cursor> cursors;
+        for(auto const & input : inputs)
+        {
+            cursors.push_back(saga::cursor::all(input));
+        }
+
+        std::vector<Value> actual;
+        saga::set_intersection_k(cursors, saga::back_inserter(actual), cmp...);
+
+        REQUIRE(actual == expected);
+    }
+}
+
+TEST_CASE("set_intersection_k")
+{
+    saga_test::property_checker
+    << ::test_set_intersection_k<int>
+    << ::test_set_intersection_k<int, saga_test::strict_weak_order<int>>;
+}
+
+TEST_CASE("set_intersection_k: common elements")
+{
+    using Value = std::uint32_t;
+
+    saga_test::property_checker
+    << [](std::vector<Value> const & common, std::vector<std::vector<Value>> inputs)
+    {
+        for(auto & input : inputs)
+        {
+            input.insert(input.end(), common.begin(), common.end());
+            input.insert(input.end(), common.begin(), common.end());
+        }
+
+        ::test_set_intersection_k(std::move(inputs));
+    };
+}
+
 namespace
 {
     template <class Container, class... Args>
@@ -4557,6 +4762,96 @@ TEST_CASE("binary_search")
     << ::test_binary_search<Value, saga_test::strict_weak_order<Value>>;
 }
 
+namespace
+{
+    template <class Value>
+    void test_bound_contiguous(std::vector<Value> src, Value const & value)
+    {
+        // Подготовка
+        std::sort(src.begin(), src.end());
+
+        auto const input = saga_test::random_subcursor_of(saga::cursor::all(src));
+
+        // Выполнение
+        auto const r_lower = saga::lower_bound(input, value);
+        auto const r_upper = saga::upper_bound(input, value);
+        auto const r_range = saga::equal_range(input, value);
+
+        // Проверка
+        REQUIRE(r_lower.begin() == std::lower_bound(input.begin(), input.end(), value));
+        REQUIRE(r_upper.begin() == std::upper_bound(input.begin(), input.end(), value));
+
+        REQUIRE(r_lower.end() == input.end());
+        REQUIRE(r_upper.end() == input.end());
+        REQUIRE(r_lower.dropped_front().begin() == src.begin());
+        REQUIRE(r_upper.dropped_front().begin() == src.begin());
+
+        REQUIRE(r_range.begin() == r_lower.begin());
+        REQUIRE(r_range.end() == r_upper.begin());
+
+        REQUIRE(saga::binary_search(input, value)
+                == std::binary_search(input.begin(), input.end(), value));
+
+        for(auto const & elem : input)
+        {
+            REQUIRE(saga::lower_bound(input, elem).begin()
+                    == std::lower_bound(input.begin(), input.end(), elem));
+            REQUIRE(saga::upper_bound(input, elem).begin()
+                    == std::upper_bound(input.begin(), input.end(), elem));
+        }
+    }
+}
+
+TEST_CASE("lower_bound, upper_bound: contiguous arithmetic")
+{
+    saga_test::property_checker
+    << ::test_bound_contiguous<signed char>
+    << ::test_bound_contiguous<unsigned char>
+    << ::test_bound_contiguous<short>
+    << ::test_bound_contiguous<unsigned short>
+    << ::test_bound_contiguous<int>
+    << ::test_bound_contiguous<unsigned>
+    << ::test_bound_contiguous<long long>
+    << ::test_bound_contiguous<unsigned long long>
+    << ::test_bound_contiguous<float>
+    << ::test_bound_contiguous<double>;
+}
+
+TEMPLATE_TEST_CASE("lower_bound, upper_bound: contiguous, all sizes", "algorithm"
+                   , std::int8_t, std::uint16_t, std::int32_t, std::uint32_t, std::int64_t
+                   , std::uint64_t, double)
+{
+    using Value = TestType;
+
+    auto const min = std::numeric_limits<Value>::lowest();
+    auto const max = std::numeric_limits<Value>::max();
+
+    for(auto num = 0; num < 100; ++num)
+    {
+        CAPTURE(num);
+
+        // Повторяющиеся значения, включая крайние значения типа
+        std::vector<Value> src;
+        for(auto index = 0; index < num; ++index)
+        {
+            src.push_back(index < num / 4 ? min
+                          : index >= num - num / 4 ? max : static_cast<Value>(index / 3));
+        }
+
+        std::vector<Value> values(src);
+        values.push_back(Value(0));
+        values.push_back(static_cast<Value>(num));
+
+        for(auto const & value : values)
+        {
+            REQUIRE(saga::lower_bound(saga::cursor::all(src), value).begin()
+                    == std::lower_bound(src.begin(), src.end(), value));
+            REQUIRE(saga::upper_bound(saga::cursor::all(src), value).begin()
+                    == std::upper_bound(src.begin(), src.end(), value));
+        }
+    }
+}
+
 namespace
 {
     template <class Value, class... Args>
@@ -5284,3 +5579,368 @@ TEMPLATE_LIST_TEST_CASE("shift_right : generic", "saga_test", Shift_algo_contain
         REQUIRE(result.end() == input.end());
     };
 }
+
+// Векторизованные реализации для непрерывных курсоров
+namespace
+{
+    template <class Value>
+    std::vector<Value> random_small_values(std::size_t num)
+    {
+        std::vector<Value> result;
+        result.reserve(num);
+
+        for(; num > 0; -- num)
+        {
+            result.push_back(static_cast<Value>(saga_test::random_uniform(0, 2)));
+        }
+
+        return result;
+    }
+
+    template <class Container>
+    void change_some_values(Container & values)
+    {
+        using Value = typename Container::value_type;
+
+        for(auto & value : values)
+        {
+            if(saga_test::random_uniform(0, 7) == 0)
+            {
+                value = static_cast<Value>(!value);
+            }
+        }
+    }
+}
+
+static_assert(saga::is_contiguous_cursor<saga::subrange_cursor<int *>>{});
+static_assert(saga::is_contiguous_cursor<saga::subrange_cursor<std::vector<int>::iterator>>{});
+static_assert(!saga::is_contiguous_cursor<saga::subrange_cursor<std::list<int>::iterator>>{});
+static_assert(!saga::is_contiguous_cursor<saga::subrange_cursor<std::vector<bool>::iterator>>{});
+
+TEMPLATE_TEST_CASE("count, find: contiguous cursor", "algorithm"
+                   , char, signed char, short, int, unsigned, long long)
+{
+    using Value = TestType;
+
+    saga_test::property_checker << [](saga_test::container_size<std::size_t> const & num)
+    {
+        auto const values = ::random_small_values<Value>(num.value * 3);
+        auto const value = static_cast<Value>(saga_test::random_uniform(0, 2));
+
+        auto const input = saga_test::random_subcursor_of(saga::cursor::all(values));
+
+        REQUIRE(saga::count(input, value) == std::count(input.begin(), input.end(), value));
+
+        auto const r_find = saga::find(input, value);
+
+        REQUIRE(r_find.begin() == std::find(input.begin(), input.end(), value));
+        REQUIRE(r_find.end() == input.end());
+        REQUIRE(r_find.dropped_front().begin() == input.dropped_front().begin());
+    };
+}
+
+TEMPLATE_TEST_CASE("mismatch, equal: contiguous cursors", "algorithm"
+                   , char, signed char, short, int, unsigned, long long)
+{
+    using Value = TestType;
+
+    saga_test::property_checker << [](saga_test::container_size<std::size_t> const & num)
+    {
+        auto const values1 = ::random_small_values<Value>(num.value * 3);
+        auto values2 = values1;
+        ::change_some_values(values2);
+
+        auto const pos = saga_test::random_position_of(values1);
+
+        auto const in1 = saga::cursor::drop_front_n(saga::cursor::all(values1), pos);
+        auto const in2 = saga::cursor::drop_front_n(saga::cursor::all(values2), pos);
+
+        auto const r_saga = saga::mismatch(in1, in2);
+        auto const r_std = std::mismatch(in1.begin(), in1.end(), in2.begin(), in2.end());
+
+        REQUIRE(r_saga.in1.begin() == r_std.first);
+        REQUIRE(r_saga.in2.begin() == r_std.second);
+        REQUIRE(r_saga.in1.end() == in1.end());
+        REQUIRE(r_saga.in2.end() == in2.end());
+
+        REQUIRE(saga::equal(in1, in2) == std::equal(in1.begin(), in1.end()
+                                                     , in2.begin(), in2.end()));
+        REQUIRE(saga::equal(in1, in1));
+    };
+}
+
+TEMPLATE_TEST_CASE("adjacent_count, inner_product: contiguous cursor", "algorithm"
+                   , char, signed char, short, int, unsigned, long long)
+{
+    using Value = TestType;
+
+    saga_test::property_checker << [](saga_test::container_size<std::size_t> const & num)
+    {
+        auto const values = ::random_small_values<Value>(num.value * 3);
+
+        auto const input = saga_test::random_subcursor_of(saga::cursor::all(values));
+
+        auto expected_equal = std::ptrdiff_t{0};
+        auto expected_not_equal = std::ptrdiff_t{0};
+
+        for(auto pos = input.begin(); pos != input.end() && std::next(pos) != input.end(); ++pos)
+        {
+            if(*pos == *std::next(pos))
+            {
+                ++ expected_equal;
+            }
+            else
+            {
+                ++ expected_not_equal;
+            }
+        }
+
+        REQUIRE(saga::adjacent_count(input) == expected_equal);
+        REQUIRE(saga::adjacent_count(input, std::equal_to<Value>{}) == expected_equal);
+        REQUIRE(saga::adjacent_count(input, std::not_equal_to<>{}) == expected_not_equal);
+
+        if(!!input)
+        {
+            auto const input2 = saga::cursor::drop_front_n(input, 1);
+
+            REQUIRE(saga::inner_product(input, input2, std::size_t(1)
+                                        , std::plus<>{}, std::equal_to<>{})
+                    == std::size_t(1) + expected_equal);
+            REQUIRE(saga::inner_product(input, input2, 0, std::plus<>{}, std::not_equal_to<>{})
+                    == expected_not_equal);
+        }
+    };
+}
+
+TEST_CASE("count, adjacent_count, inner_product: contiguous bool cursor")
+{
+    saga_test::property_checker << [](std::vector<bool> const & src1, std::vector<bool> const & src2)
+    {
+        auto const num = std::min(src1.size(), src2.size());
+
+        std::valarray<bool> values1(num);
+        std::valarray<bool> values2(num);
+
+        std::copy(src1.begin(), src1.begin() + num, std::begin(values1));
+        std::copy(src2.begin(), src2.begin() + num, std::begin(values2));
+
+        auto const in1 = saga::cursor::all(values1);
+        auto const in2 = saga::cursor::all(values2);
+
+        static_assert(saga::is_contiguous_cursor<decltype(in1)>{});
+
+        REQUIRE(saga::count(in1, true) == std::count(src1.begin(), src1.begin() + num, true));
+
+        REQUIRE(saga::inner_product(in1, in2, std::size_t(0), std::plus<>{}, std::not_equal_to<>{})
+                == std::inner_product(std::begin(values1), std::end(values1), std::begin(values2)
+                                      , std::size_t(0), std::plus<>{}, std::not_equal_to<>{}));
+
+        auto const n_unequal
+            = (num == 0) ? 0 : std::inner_product(std::begin(values1), std::end(values1) - 1
+                                                  , std::begin(values1) + 1, std::ptrdiff_t(0)
+                                                  , std::plus<>{}, std::not_equal_to<>{});
+
+        REQUIRE(saga::adjacent_count(in1, std::not_equal_to<>{}) == n_unequal);
+    };
+}
+
+// Сложность алгоритмов сортировки и слияния
+namespace
+{
+    struct complexity_tag{};
+
+    using Complexity_value = saga::regular_tracer<int, complexity_tag>;
+
+    auto complexity_compare()
+    {
+        return saga::make_invocable_tracer<complexity_tag>
+            ([](Complexity_value const & lhs, Complexity_value const & rhs)
+             { return lhs.value() < rhs.value(); });
+    }
+
+    using Complexity_counter
+        = saga::operation_counter<Complexity_value, decltype(::complexity_compare())>;
+
+    std::vector<Complexity_value> complexity_values(std::vector<int> const & src)
+    {
+        return std::vector<Complexity_value>(src.begin(), src.end());
+    }
+
+    // Упорядоченные, обратно упорядоченные и случайные последовательности, на которых
+    // некоторые реализации быстрой сортировки имеют квадратичную сложность
+    std::vector<std::vector<int>> complexity_test_inputs(std::size_t num)
+    {
+        std::vector<int> sorted(num);
+        std::iota(sorted.begin(), sorted.end(), 0);
+
+        auto reversed = sorted;
+        std::reverse(reversed.begin(), reversed.end());
+
+        auto organ_pipe = sorted;
+        std::reverse(organ_pipe.begin() + num / 2, organ_pipe.end());
+
+        std::vector<int> few_unique(num);
+        for(auto & value : few_unique)
+        {
+            value = saga_test::random_uniform(0, 3);
+        }
+
+        std::vector<int> random(num);
+        for(auto & value : random)
+        {
+            value = saga_test::random_uniform(0, 1'000'000);
+        }
+
+        return {sorted, reversed, organ_pipe, few_unique, random};
+    }
+
+    double n_log_n(std::size_t num)
+    {
+        return num * std::log2(std::max(num, std::size_t(2)));
+    }
+}
+
+TEST_CASE("sort: complexity")
+{
+    for(auto const & num : {std::size_t(0), std::size_t(1), std::size_t(17), std::size_t(1000)})
+    for(auto const & src : ::complexity_test_inputs(num))
+    {
+        auto values = ::complexity_values(src);
+
+        ::Complexity_counter const counter;
+        saga::allocation_counter const allocations;
+
+        saga::sort(saga::cursor::all(values), ::complexity_compare());
+
+        auto const counts = counter.counts();
+        auto const n_allocations = allocations.counts().allocations;
+
+        CAPTURE(num, counts.invocations, counts.moves);
+
+        REQUIRE(std::is_sorted(values.begin(), values.end(), ::complexity_compare()));
+
+        REQUIRE(counts.invocations <= 3 * ::n_log_n(num) + num);
+        REQUIRE(counts.moves <= 4 * ::n_log_n(num) + num);
+        REQUIRE(counts.copies == 0);
+        REQUIRE(n_allocations == 0);
+    }
+}
+
+TEST_CASE("sort: pivot is median of quartiles and middle")
+{
+    saga_test::property_checker << [](std::vector<int> const & values)
+    {
+        auto const num = static_cast<std::ptrdiff_t>(values.size());
+
+        if(num < 3)
+        {
+            return;
+        }
+
+        auto cmp = std::less<>{};
+        auto const pivot = saga::detail::median3_index(saga::cursor::all(values), cmp, num);
+
+        auto const offset = (num < 8) ? std::ptrdiff_t(0) : num / 4;
+
+        std::vector<int> samples{values[offset], values[num / 2], values[num - 1 - offset]};
+        std::sort(samples.begin(), samples.end());
+
+        REQUIRE((pivot == offset || pivot == num / 2 || pivot == num - 1 - offset));
+        REQUIRE(values[pivot] == samples[1]);
+    };
+}
+
+TEST_CASE("sort: complexity on presorted inputs")
+{
+    for(auto const & num : {std::size_t(100), std::size_t(1000), std::size_t(10'000)})
+    {
+        std::vector<int> sorted(num);
+        std::iota(sorted.begin(), sorted.end(), 0);
+
+        auto organ_pipe = sorted;
+        std::reverse(organ_pipe.begin() + num / 2, organ_pipe.end());
+
+        auto sawtooth = sorted;
+        for(auto & value : sawtooth)
+        {
+            value %= 16;
+        }
+
+        for(auto const & src : {sorted, organ_pipe, sawtooth})
+        {
+            auto values = ::complexity_values(src);
+
+            ::Complexity_counter const counter;
+
+            saga::sort(saga::cursor::all(values), ::complexity_compare());
+
+            auto const counts = counter.counts();
+
+            CAPTURE(num, counts.invocations);
+
+            REQUIRE(std::is_sorted(values.begin(), values.end(), ::complexity_compare()));
+            REQUIRE(counts.invocations <= 3 * ::n_log_n(num) + num);
+        }
+    }
+}
+
+TEST_CASE("stable_sort: complexity")
+{
+    for(auto const & num : {std::size_t(0), std::size_t(1), std::size_t(17), std::size_t(1000)})
+    for(auto const & src : ::complexity_test_inputs(num))
+    {
+        auto values = ::complexity_values(src);
+
+        ::Complexity_counter const counter;
+        saga::allocation_counter const allocations;
+
+        saga::stable_sort(saga::cursor::all(values), ::complexity_compare());
+
+        auto const counts = counter.counts();
+        auto const n_allocations = allocations.counts().allocations;
+
+        CAPTURE(num, counts.invocations, counts.moves);
+
+        REQUIRE(std::is_sorted(values.begin(), values.end(), ::complexity_compare()));
+
+        // Слияние без буфера: O(n log^2 n) сравнений и перемещений
+        auto const log_n = std::log2(std::max(num, std::size_t(2)));
+
+        REQUIRE(counts.invocations <= 2 * ::n_log_n(num) + num);
+        REQUIRE(counts.moves <= 2 * ::n_log_n(num) * log_n + num);
+        REQUIRE(counts.copies == 0);
+        REQUIRE(n_allocations == 0);
+    }
+}
+
+TEST_CASE("inplace_merge: complexity")
+{
+    for(auto const & num : {std::size_t(0), std::size_t(1), std::size_t(17), std::size_t(1000)})
+    for(auto const & src : ::complexity_test_inputs(num))
+    {
+        auto values = ::complexity_values(src);
+
+        auto const middle = saga_test::random_uniform(std::size_t(0), num);
+
+        std::sort(values.begin(), values.begin() + middle, ::complexity_compare());
+        std::sort(values.begin() + middle, values.end(), ::complexity_compare());
+
+        ::Complexity_counter const counter;
+        saga::allocation_counter const allocations;
+
+        saga::inplace_merge(saga::cursor::drop_front_n(saga::cursor::all(values), middle)
+                            , ::complexity_compare());
+
+        auto const counts = counter.counts();
+        auto const n_allocations = allocations.counts().allocations;
+
+        CAPTURE(num, middle, counts.invocations, counts.moves);
+
+        REQUIRE(std::is_sorted(values.begin(), values.end(), ::complexity_compare()));
+
+        REQUIRE(counts.invocations <= ::n_log_n(num) + num);
+        REQUIRE(counts.moves <= 3 * ::n_log_n(num) + num);
+        REQUIRE(counts.copies == 0);
+        REQUIRE(n_allocations == 0);
+    }
+}
@@ -0,0 +1,169 @@
+/* (c) 2026 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки SAGA.
+
+SAGA -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+// Тестируемый файл
+#include <saga/algorithm/batch_search.hpp>
+
+// Инфраструктура тестирования
+#include "../saga_test.hpp"
+#include <catch2/catch_amalgamated.hpp>
+
+// Вспомогательные файлы
+#include <saga/cursor/subrange.hpp>
+#include <saga/iterator.hpp>
+
+#include <algorithm>
+#include <deque>
+#include <list>
+#include <string>
+#include <vector>
+
+namespace
+{
+    template <class Container, class Queries, class Compare>
+    void check_batch_search(Container const & haystack, Queries const & queries
+                           , Compare const & cmp)
+    {
+        std::vector<std::ptrdiff_t> expected_lower;
+        std::vector<std::ptrdiff_t> expected_upper;
+        std::vector<bool> expected_found;
+
+        for(auto const & value : queries)
+        {
+            auto const lower = std::lower_bound(haystack.begin(), haystack.end(), value, cmp);
+            auto const upper = std::upper_bound(haystack.begin(), haystack.end(), value, cmp);
+
+            expected_lower.push_back(lower - haystack.begin());
+            expected_upper.push_back(upper - haystack.begin());
+            expected_found.push_back(std::binary_search(haystack.begin(), haystack.end()
+                                                       , value, cmp));
+        }
+
+        std::vector<std::ptrdiff_t> actual_lower;
+        std::vector<std::ptrdiff_t> actual_upper;
+        std::vector<bool> actual_found;
+
+        auto const result_lower
+            = saga::lower_bound_batch(saga::cursor::all(haystack), saga::cursor::all(queries)
+                                     , saga::back_inserter(actual_lower), cmp);
+        auto const result_upper
+            = saga::upper_bound_batch(saga::cursor::all(haystack), saga::cursor::all(queries)
+                                     , saga::back_inserter(actual_upper), cmp);
+        auto const result_found
+            = saga::binary_search_batch(saga::cursor::all(haystack), saga::cursor::all(queries)
+                                       , saga::back_inserter(actual_found), cmp);
+
+        REQUIRE(actual_lower == expected_lower);
+        REQUIRE(actual_upper == expected_upper);
+        REQUIRE(actual_found == expected_found);
+
+        REQUIRE(!result_lower.in);
+        REQUIRE(!result_upper.in);
+        REQUIRE(!result_found.in);
+    }
+}
+
+// Тесты
+TEST_CASE("lower_bound_batch, upper_bound_batch, binary_search_batch: random queries")
+{
+    using Element = int;
+
+    saga_test::property_checker
+    << [](std::vector<Element> haystack, std::vector<Element> const & queries)
+    {
+        std::sort(haystack.begin(), haystack.end());
+
+        ::check_batch_search(haystack, queries, std::less<>{});
+        ::check_batch_search(haystack, haystack, std::less<>{});
+    };
+}
+
+TEST_CASE("lower_bound_batch, upper_bound_batch, binary_search_batch: sorted queries")
+{
+    using Element = int;
+
+    saga_test::property_checker
+    << [](std::vector<Element> haystack, std::vector<Element> queries)
+    {
+        std::sort(haystack.begin(), haystack.end());
+        std::sort(queries.begin(), queries.end());
+
+        ::check_batch_search(haystack, queries, std::less<>{});
+    };
+}
+
+TEST_CASE("lower_bound_batch, upper_bound_batch, binary_search_batch: custom compare")
+{
+    using Element = int;
+    using Compare = saga_test::strict_weak_order<Element>;
+
+    saga_test::property_checker
+    << [](std::vector<Element> haystack, std::vector<Element> queries, Compare const & cmp)
+    {
+        std::sort(haystack.begin(), haystack.end(), cmp);
+
+        ::check_batch_search(haystack, queries, cmp);
+
+        std::sort(queries.begin(), queries.end(), cmp);
+
+        ::check_batch_search(haystack, queries, cmp);
+    };
+}
+
+TEST_CASE("lower_bound_batch, upper_bound_batch, binary_search_batch: not contiguous")
+{
+    using Element = std::string;
+
+    saga_test::property_checker
+    << [](std::vector<Element> const & src, std::list<Element> queries)
+    {
+        std::deque<Element> haystack(src.begin(), src.end());
+        std::sort(haystack.begin(), haystack.end());
+
+        ::check_batch_search(haystack, queries, std::less<>{});
+
+        queries.sort();
+
+        ::check_batch_search(haystack, queries, std::less<>{});
+    };
+}
+
+TEST_CASE("lower_bound_batch: all sizes")
+{
+    for(auto num = 0; num < 70; ++num)
+    {
+        CAPTURE(num);
+
+        std::vector<int> haystack;
+        for(auto index = 0; index < num; ++index)
+        {
+            haystack.push_back(2 * index + 1);
+        }
+
+        std::vector<int> queries;
+        for(auto value = 2 * num + 1; value >= -1; --value)
+        {
+            queries.push_back(value);
+        }
+
+        ::check_batch_search(haystack, queries, std::less<>{});
+
+        std::reverse(queries.begin(), queries.end());
+
+        ::check_batch_search(haystack, queries, std::less<>{});
+    }
+}
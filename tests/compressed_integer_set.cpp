@@ -0,0 +1,256 @@
+/* (c) 2026 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки SAGA.
+
+SAGA -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+// Тестируемый файл
+#include <saga/compressed_integer_set.hpp>
+
+// Инфраструктура тестирования
+#include "saga_test.hpp"
+#include <catch2/catch_amalgamated.hpp>
+
+// Вспомогательные файлы
+#include <saga/cursor/subrange.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace
+{
+    template <class UInt>
+    void check_compressed_lookup(saga::compressed_integer_set<UInt> const & actual
+                                , std::vector<UInt> const & expected, UInt key)
+    {
+        CAPTURE(key);
+
+        auto const lower = std::lower_bound(expected.begin(), expected.end(), key);
+        auto const upper = std::upper_bound(expected.begin(), expected.end(), key);
+
+        REQUIRE(std::distance(actual.begin(), actual.lower_bound(key))
+                == std::distance(expected.begin(), lower));
+        REQUIRE(std::distance(actual.begin(), actual.upper_bound(key))
+                == std::distance(expected.begin(), upper));
+
+        if(lower != expected.end())
+        {
+            REQUIRE(*actual.lower_bound(key) == *lower);
+        }
+
+        auto const is_found = (lower != upper);
+
+        REQUIRE(actual.contains(key) == is_found);
+        REQUIRE(actual.count(key) == (is_found ? 1u : 0u));
+        REQUIRE((actual.find(key) != actual.end()) == is_found);
+
+        auto const range = actual.equal_range(key);
+        REQUIRE(range.first == actual.lower_bound(key));
+        REQUIRE(range.second == actual.upper_bound(key));
+    }
+
+    template <class UInt>
+    std::vector<UInt> make_sorted_unique(std::vector<UInt> values)
+    {
+        std::sort(values.begin(), values.end());
+        values.erase(std::unique(values.begin(), values.end()), values.end());
+
+        return values;
+    }
+
+    template <class UInt>
+    void test_compressed_integer_set(std::vector<UInt> const & src, std::vector<UInt> const & keys)
+    {
+        auto const expected = ::make_sorted_unique(src);
+
+        saga::compressed_integer_set<UInt> const actual(saga::sorted_unique
+                                                       , expected.begin(), expected.end());
+
+        REQUIRE(actual.size() == expected.size());
+        REQUIRE(actual.empty() == expected.empty());
+        REQUIRE(std::equal(actual.begin(), actual.end(), expected.begin(), expected.end()));
+        REQUIRE(saga::equal(saga::cursor::all(actual), saga::cursor::all(expected)));
+
+        for(auto const & key : keys)
+        {
+            ::check_compressed_lookup(actual, expected, key);
+        }
+
+        for(auto const & key : expected)
+        {
+            ::check_compressed_lookup(actual, expected, key);
+        }
+    }
+}
+
+// Тесты
+TEST_CASE("compressed_integer_set: same as sorted vector")
+{
+    saga_test::property_checker
+    << ::test_compressed_integer_set<std::uint32_t>
+    << ::test_compressed_integer_set<std::uint64_t>;
+}
+
+TEMPLATE_TEST_CASE("compressed_integer_set: all block sizes and widths", "compressed_integer_set"
+                   , std::uint32_t, std::uint64_t)
+{
+    using UInt = TestType;
+
+    auto const max = std::numeric_limits<UInt>::max();
+
+    for(auto num : {0, 1, 2, 127, 128, 129, 255, 256, 257, 1000})
+    {
+        for(auto step : {UInt(1), UInt(2), UInt(3), UInt(1000), max / 2000, max / 1000})
+        {
+            CAPTURE(num, step);
+
+            // Арифметическая прогрессия, заканчивающаяся максимальным значением
+            std::vector<UInt> expected;
+            for(auto index = num; index > 0; --index)
+            {
+                expected.push_back(max - static_cast<UInt>(index - 1) * step);
+            }
+
+            if(!expected.empty() && step > 1)
+            {
+                expected.front() = 0;
+            }
+
+            saga::compressed_integer_set<UInt> const actual(saga::sorted_unique
+                                                           , expected.begin(), expected.end());
+
+            REQUIRE(actual.size() == expected.size());
+            REQUIRE(std::equal(actual.begin(), actual.end(), expected.begin(), expected.end()));
+
+            for(auto const & value : expected)
+            {
+                ::check_compressed_lookup(actual, expected, value);
+                ::check_compressed_lookup(actual, expected, static_cast<UInt>(value - 1));
+                ::check_compressed_lookup(actual, expected, static_cast<UInt>(value + 1));
+            }
+        }
+    }
+}
+
+TEST_CASE("compressed_integer_set: set operations")
+{
+    using UInt = std::uint32_t;
+    using Set = saga::compressed_integer_set<UInt>;
+
+    saga_test::property_checker
+    << [](std::vector<UInt> const & src1, std::vector<UInt> const & src2
+         , saga_test::container_size<std::size_t> const & repeat)
+    {
+        // Множества с длинными сериями, чтобы были блоки, пропускаемые без распаковки
+        auto values1 = src1;
+        for(auto index = std::size_t(0); index < src1.size() * repeat.value; ++index)
+        {
+            values1.push_back(static_cast<UInt>(index * 3));
+        }
+
+        auto const lhs = ::make_sorted_unique(values1);
+        auto const rhs = ::make_sorted_unique(src2);
+
+        Set const lhs_set(saga::sorted_unique, lhs.begin(), lhs.end());
+        Set const rhs_set(saga::sorted_unique, rhs.begin(), rhs.end());
+
+        for(auto const & [in1, in2, set1, set2] : {std::tie(lhs, rhs, lhs_set, rhs_set)
+                                                 , std::tie(rhs, lhs, rhs_set, lhs_set)})
+        {
+            std::vector<UInt> expected;
+            std::vector<UInt> actual;
+
+            std::set_intersection(in1.begin(), in1.end(), in2.begin(), in2.end()
+                                 , std::back_inserter(expected));
+            set1.set_intersection(set2, saga::back_inserter(actual));
+            REQUIRE(actual == expected);
+
+            expected.clear();
+            actual.clear();
+            std::set_difference(in1.begin(), in1.end(), in2.begin(), in2.end()
+                               , std::back_inserter(expected));
+            set1.set_difference(set2, saga::back_inserter(actual));
+            REQUIRE(actual == expected);
+
+            expected.clear();
+            actual.clear();
+            std::set_union(in1.begin(), in1.end(), in2.begin(), in2.end()
+                          , std::back_inserter(expected));
+            set1.set_union(set2, saga::back_inserter(actual));
+            REQUIRE(actual == expected);
+
+            REQUIRE(set1.includes(set2)
+                    == std::includes(in1.begin(), in1.end(), in2.begin(), in2.end()));
+            REQUIRE(set1.includes(set1));
+        }
+    };
+}
+
+TEST_CASE("compressed_integer_set: from flat_set, equality")
+{
+    using UInt = std::uint64_t;
+
+    saga_test::property_checker << [](std::vector<UInt> const & src, UInt const & extra)
+    {
+        saga::flat_set<UInt> const values(src);
+
+        saga::compressed_integer_set<UInt> const actual(values);
+
+        REQUIRE(std::equal(actual.begin(), actual.end(), values.begin(), values.end()));
+        REQUIRE(actual == saga::compressed_integer_set<UInt>(values));
+
+        auto other = values;
+        other.insert(&extra, &extra + 1);
+
+        REQUIRE((actual == saga::compressed_integer_set<UInt>(other)) == (values == other));
+        REQUIRE((actual != saga::compressed_integer_set<UInt>(other)) == (values != other));
+    };
+}
+
+TEST_CASE("compressed_integer_set: memory size of a dense set")
+{
+    using UInt = std::uint32_t;
+
+    // Каждое четвёртое число в среднем: разности занимают 2-3 бита
+    std::vector<UInt> values;
+    for(auto value = UInt(0); values.size() < 100'000; value += 1 + (value * 7919u) % 7)
+    {
+        values.push_back(value);
+    }
+
+    saga::compressed_integer_set<UInt> const actual(saga::sorted_unique
+                                                   , values.begin(), values.end());
+
+    REQUIRE(std::equal(actual.begin(), actual.end(), values.begin(), values.end()));
+    REQUIRE(actual.memory_size() < actual.size() / 2);
+}
+
+TEST_CASE("compressed_integer_set: default constructor")
+{
+    saga::compressed_integer_set<> const actual;
+
+    REQUIRE(actual.empty());
+    REQUIRE(actual.size() == 0);
+    REQUIRE(actual.begin() == actual.end());
+    REQUIRE(actual.cbegin() == actual.cend());
+    REQUIRE(actual.lower_bound(42) == actual.end());
+    REQUIRE(!actual.contains(42));
+    REQUIRE(actual.includes(actual));
+}
+
+static_assert(std::is_same<saga::compressed_integer_set<>::value_type, std::uint32_t>{});
+static_assert(std::is_same<saga::compressed_integer_set<>::iterator::iterator_category
+                          , std::forward_iterator_tag>{});
@@ -0,0 +1,450 @@
+/* (c) 2026 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки SAGA.
+
+SAGA -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+// Тестируемый файл
+#include <saga/container/small_vector.hpp>
+
+// Инфраструктура тестирования
+#include "../saga_test.hpp"
+#include <catch2/catch_amalgamated.hpp>
+
+// Используемые в тестах возможности
+#include <saga/cursor/to.hpp>
+#include <saga/flat_set.hpp>
+#include <saga/optimization/ga/crossover/ga_boolean_crossover_one_point.hpp>
+#include <saga/optimization/ga/crossover/ga_boolean_crossover_two_point.hpp>
+#include <saga/optimization/ga/crossover/ga_boolean_crossover_uniform.hpp>
+#include <saga/random/iid_distribution.hpp>
+#include <saga/test/allocation_counter.hpp>
+
+#include <set>
+#include <string>
+#include <vector>
+
+namespace
+{
+    template <class T>
+    struct tagged_allocator
+     : std::allocator<T>
+    {
+        using Base = std::allocator<T>;
+
+        using is_always_equal = std::false_type;
+        using propagate_on_container_copy_assignment = std::true_type;
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap = std::true_type;
+
+        template <class Other>
+        struct rebind
+        {
+            using other = tagged_allocator<Other>;
+        };
+
+        tagged_allocator() = default;
+
+        explicit tagged_allocator(int arg)
+         : tag(arg)
+        {}
+
+        template <class Other>
+        tagged_allocator(tagged_allocator<Other> const & other) noexcept
+         : Base(other)
+         , tag(other.tag)
+        {}
+
+        int tag = 0;
+
+        friend bool operator==(tagged_allocator const & lhs, tagged_allocator const & rhs)
+        {
+            return lhs.tag == rhs.tag;
+        }
+
+        friend bool operator!=(tagged_allocator const & lhs, tagged_allocator const & rhs)
+        {
+            return !(lhs == rhs);
+        }
+    };
+
+    template <class SmallVector, class Value>
+    void check_small_vector_operations(std::vector<Value> const & src
+                                      , std::vector<Value> const & values
+                                      , std::size_t pos_seed)
+    {
+        std::vector<Value> expected(src.begin(), src.end());
+        SmallVector actual(src.begin(), src.end());
+
+        REQUIRE(saga::equal(saga::cursor::all(actual), saga::cursor::all(expected)));
+        REQUIRE(actual.capacity() >= actual.size());
+
+        // Вставки в различные позиции
+        for(auto const & value : values)
+        {
+            auto const index = (expected.size() + pos_seed) % (expected.size() + 1);
+
+            auto const pos_expected = expected.insert(expected.begin() + index, value);
+            auto const pos_actual = actual.insert(actual.begin() + index, value);
+
+            REQUIRE(pos_actual - actual.begin() == pos_expected - expected.begin());
+        }
+
+        REQUIRE(saga::equal(saga::cursor::all(actual), saga::cursor::all(expected)));
+
+        auto const index = pos_seed % (expected.size() + 1);
+
+        expected.insert(expected.begin() + index, values.begin(), values.end());
+        actual.insert(actual.begin() + index, values.begin(), values.end());
+
+        REQUIRE(saga::equal(saga::cursor::all(actual), saga::cursor::all(expected)));
+
+        if(!expected.empty())
+        {
+            // Вставляемое значение ссылается на элемент самого контейнера
+            expected.insert(expected.begin(), 3, expected.back());
+            actual.insert(actual.begin(), 3, actual.back());
+
+            expected.push_back(expected.front());
+            actual.push_back(actual.front());
+
+            REQUIRE(saga::equal(saga::cursor::all(actual), saga::cursor::all(expected)));
+        }
+
+        // Удаление
+        auto const first = pos_seed % (expected.size() + 1);
+        auto const last = first + (expected.size() - first) / 2;
+
+        expected.erase(expected.begin() + first, expected.begin() + last);
+        actual.erase(actual.begin() + first, actual.begin() + last);
+
+        REQUIRE(saga::equal(saga::cursor::all(actual), saga::cursor::all(expected)));
+
+        if(!expected.empty())
+        {
+            expected.erase(expected.begin() + pos_seed % expected.size());
+            actual.erase(actual.begin() + pos_seed % actual.size());
+        }
+
+        if(!expected.empty())
+        {
+            expected.pop_back();
+            actual.pop_back();
+        }
+
+        REQUIRE(saga::equal(saga::cursor::all(actual), saga::cursor::all(expected)));
+
+        // Изменение размера
+        expected.resize(src.size());
+        actual.resize(src.size());
+
+        REQUIRE(saga::equal(saga::cursor::all(actual), saga::cursor::all(expected)));
+
+        actual.shrink_to_fit();
+
+        REQUIRE(saga::equal(saga::cursor::all(actual), saga::cursor::all(expected)));
+        REQUIRE(actual.capacity() >= actual.size());
+    }
+}
+
+// Тесты
+TEST_CASE("small_vector: same as std::vector")
+{
+    saga_test::property_checker
+    << ::check_small_vector_operations<saga::small_vector<int, 4>, int>
+    << ::check_small_vector_operations<saga::small_vector<int, 0>, int>
+    << ::check_small_vector_operations<saga::small_vector<std::string, 3>, std::string>;
+}
+
+TEST_CASE("small_vector: constructors and assign")
+{
+    using Vector = saga::small_vector<std::string, 2>;
+
+    saga_test::property_checker
+    << [](std::vector<std::string> const & src, std::string const & value
+         , saga_test::container_size<std::size_t> const & num)
+    {
+        Vector const actual(src.begin(), src.end());
+
+        REQUIRE(saga::equal(saga::cursor::all(actual), saga::cursor::all(src)));
+        REQUIRE(actual.size() == src.size());
+        REQUIRE(actual.empty() == src.empty());
+
+        {
+            Vector const filled(num.value, value);
+            REQUIRE(filled.size() == num.value);
+            REQUIRE(std::all_of(filled.begin(), filled.end()
+                               , [&](std::string const & each) { return each == value; }));
+        }
+        {
+            Vector const filled(num.value);
+            REQUIRE(filled.size() == num.value);
+            REQUIRE(std::all_of(filled.begin(), filled.end()
+                               , [](std::string const & each) { return each.empty(); }));
+        }
+        {
+            auto copy = actual;
+            REQUIRE(copy == actual);
+
+            auto moved = std::move(copy);
+            REQUIRE(moved == actual);
+            REQUIRE(copy.empty());
+
+            Vector other{value, value, value};
+            other = moved;
+            REQUIRE(other == actual);
+
+            other = {value};
+            REQUIRE(other.size() == 1);
+            REQUIRE(other.front() == value);
+            REQUIRE(other.back() == value);
+            REQUIRE(other.at(0) == value);
+            REQUIRE_THROWS_AS(other.at(1), std::out_of_range);
+
+            other = std::move(moved);
+            REQUIRE(other == actual);
+            REQUIRE(moved.empty());
+
+            other.assign(num.value, value);
+            REQUIRE(other == Vector(num.value, value));
+
+            other.assign(src.rbegin(), src.rend());
+            REQUIRE(saga::equal(saga::cursor::all(other)
+                               , saga::make_subrange_cursor(src.rbegin(), src.rend()
+                                                           , saga::unsafe_tag_t{})));
+            REQUIRE(saga::equal(saga::make_subrange_cursor(other.rbegin(), other.rend()
+                                                          , saga::unsafe_tag_t{})
+                               , saga::cursor::all(src)));
+        }
+    };
+}
+
+TEST_CASE("small_vector: swap and comparison")
+{
+    using Vector = saga::small_vector<std::string, 3>;
+
+    saga_test::property_checker
+    << [](std::vector<std::string> const & lhs_src, std::vector<std::string> const & rhs_src)
+    {
+        Vector const lhs_old(lhs_src.begin(), lhs_src.end());
+        Vector const rhs_old(rhs_src.begin(), rhs_src.end());
+
+        auto lhs = lhs_old;
+        auto rhs = rhs_old;
+
+        swap(lhs, rhs);
+
+        REQUIRE(lhs == rhs_old);
+        REQUIRE(rhs == lhs_old);
+
+        lhs.swap(lhs);
+        REQUIRE(lhs == rhs_old);
+
+        REQUIRE((lhs_old == rhs_old) == (lhs_src == rhs_src));
+        REQUIRE((lhs_old != rhs_old) == (lhs_src != rhs_src));
+        REQUIRE((lhs_old < rhs_old) == (lhs_src < rhs_src));
+        REQUIRE((lhs_old > rhs_old) == (lhs_src > rhs_src));
+        REQUIRE((lhs_old <= rhs_old) == (lhs_src <= rhs_src));
+        REQUIRE((lhs_old >= rhs_old) == (lhs_src >= rhs_src));
+    };
+}
+
+TEST_CASE("small_vector: allocator propagation")
+{
+    using Allocator = ::tagged_allocator<int>;
+    using Vector = saga::small_vector<int, 2, Allocator>;
+
+    saga_test::property_checker
+    << [](std::vector<int> const & lhs_src, std::vector<int> const & rhs_src)
+    {
+        Vector const lhs_old(lhs_src.begin(), lhs_src.end(), Allocator(1));
+        Vector const rhs_old(rhs_src.begin(), rhs_src.end(), Allocator(2));
+
+        REQUIRE(lhs_old.get_allocator() == Allocator(1));
+        REQUIRE(Vector(lhs_old).get_allocator() == Allocator(1));
+        REQUIRE(Vector(lhs_old, Allocator(3)).get_allocator() == Allocator(3));
+        REQUIRE(Vector(lhs_old, Allocator(3)) == lhs_old);
+
+        {
+            auto lhs = lhs_old;
+            lhs = rhs_old;
+            REQUIRE(lhs == rhs_old);
+            REQUIRE(lhs.get_allocator() == Allocator(2));
+        }
+        {
+            auto lhs = lhs_old;
+            auto rhs = rhs_old;
+            lhs = std::move(rhs);
+            REQUIRE(lhs == rhs_old);
+            REQUIRE(lhs.get_allocator() == Allocator(2));
+        }
+        {
+            auto lhs = lhs_old;
+            auto rhs = rhs_old;
+            Vector moved(std::move(rhs), Allocator(4));
+            REQUIRE(moved == rhs_old);
+            REQUIRE(moved.get_allocator() == Allocator(4));
+        }
+        {
+            auto lhs = lhs_old;
+            auto rhs = rhs_old;
+            lhs.swap(rhs);
+            REQUIRE(lhs == rhs_old);
+            REQUIRE(rhs == lhs_old);
+            REQUIRE(lhs.get_allocator() == Allocator(2));
+            REQUIRE(rhs.get_allocator() == Allocator(1));
+        }
+    };
+}
+
+TEST_CASE("small_vector: no allocations for size not greater than N")
+{
+    saga_test::property_checker << [](std::vector<int> const & src)
+    {
+        constexpr auto N = std::size_t(16);
+        using Vector = saga::small_vector<int, N>;
+
+        auto const num = std::min(src.size(), N);
+        auto const first = src.begin();
+        auto const last = src.begin() + num;
+
+        saga::allocation_counter const allocations;
+        {
+            Vector values(first, last);
+            auto copy = values;
+            auto moved = std::move(copy);
+            values.resize(N);
+            values.shrink_to_fit();
+            moved.insert(moved.begin(), N - num, 42);
+            moved.erase(moved.begin(), moved.begin() + (N - num) / 2);
+            swap(values, moved);
+
+            auto const result = saga::cursor::to<Vector>(saga::make_subrange_cursor(first, last
+                                                                       , saga::unsafe_tag_t{}));
+
+            REQUIRE(saga::equal(saga::cursor::all(result)
+                               , saga::make_subrange_cursor(first, last, saga::unsafe_tag_t{})));
+        }
+
+        REQUIRE(allocations.counts().allocations == 0);
+
+        {
+            Vector values(N, 42);
+            saga::allocation_counter const grow;
+            values.push_back(values.front());
+
+            REQUIRE(values.size() == N + 1);
+            REQUIRE(values.back() == 42);
+            REQUIRE(grow.counts().allocations == 1);
+
+            values.resize(N);
+            values.shrink_to_fit();
+
+            REQUIRE(values.capacity() == N);
+            REQUIRE(grow.counts().deallocations == 1);
+        }
+    };
+}
+
+TEST_CASE("small_vector: resize and insert with value from the same vector")
+{
+    saga_test::property_checker << [](std::vector<std::string> const & src, std::size_t extra)
+    {
+        using Vector = saga::small_vector<std::string, 2>;
+
+        if(src.empty())
+        {
+            return;
+        }
+
+        extra %= 64;
+
+        auto const new_size = src.size() + extra;
+
+        Vector resized(src.begin(), src.end());
+        resized.shrink_to_fit();
+        resized.resize(new_size, resized.front());
+
+        Vector inserted(src.begin(), src.end());
+        inserted.shrink_to_fit();
+        inserted.insert(inserted.begin(), extra, inserted.back());
+
+        std::vector<std::string> expected_resized(src);
+        expected_resized.resize(new_size, src.front());
+
+        std::vector<std::string> expected_inserted(src);
+        expected_inserted.insert(expected_inserted.begin(), extra, src.back());
+
+        REQUIRE(saga::equal(saga::cursor::all(resized), saga::cursor::all(expected_resized)));
+        REQUIRE(saga::equal(saga::cursor::all(inserted), saga::cursor::all(expected_inserted)));
+    };
+}
+
+TEST_CASE("small_vector: KeyContainer of flat_set")
+{
+    using Set = saga::flat_set<int, std::less<>, saga::small_vector<int, 8>>;
+
+    saga_test::property_checker
+    << [](std::vector<int> const & src1, std::vector<int> const & src2)
+    {
+        Set actual(saga::small_vector<int, 8>(src1.begin(), src1.end()));
+        actual.insert(src2.begin(), src2.end());
+
+        std::set<int> expected(src1.begin(), src1.end());
+        expected.insert(src2.begin(), src2.end());
+
+        REQUIRE(saga::equal(saga::cursor::all(actual), saga::cursor::all(expected)));
+
+        for(auto const & value : src2)
+        {
+            REQUIRE(std::binary_search(actual.begin(), actual.end(), value));
+        }
+    };
+}
+
+TEST_CASE("small_vector: GA genotype without allocations")
+{
+    constexpr auto dim = std::size_t(32);
+    using Genotype = saga::small_vector<bool, dim>;
+
+    saga::iid_distribution<std::bernoulli_distribution, Genotype> distr(dim);
+
+    auto & rnd = saga_test::random_engine();
+
+    saga::allocation_counter const allocations;
+
+    auto const gen1 = distr(rnd);
+    auto const gen2 = distr(rnd);
+
+    auto const child1 = saga::ga_boolean_crossover_uniform_fn{}(gen1, gen2, rnd);
+    auto const child2 = saga::ga_boolean_crossover_one_point_fn{}(gen1, gen2, rnd);
+    auto const child3 = saga::ga_boolean_crossover_two_point_fn{}(gen1, gen2, rnd);
+
+    REQUIRE(allocations.counts().allocations == 0);
+
+    for(auto const & child : {child1, child2, child3})
+    {
+        REQUIRE(child.size() == dim);
+
+        for(auto index = std::size_t(0); index < dim; ++index)
+        {
+            REQUIRE((child[index] == gen1[index] || child[index] == gen2[index]));
+        }
+    }
+}
+
+static_assert(std::is_same<saga::small_vector<int, 4>::iterator, int *>{});
+static_assert(std::is_same<saga::small_vector<int, 4>::const_iterator, int const *>{});
+static_assert(saga::small_vector<int, 4>::inline_capacity == 4);
+static_assert(std::is_nothrow_move_constructible<saga::small_vector<int, 4>>{});
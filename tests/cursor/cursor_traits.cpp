@@ -46,3 +46,9 @@ static_assert(!saga::is_random_access_cursor<InputCursor>{});
 static_assert(!saga::is_random_access_cursor<ForwardCursor>{});
 static_assert(!saga::is_random_access_cursor<BidirectionalCursor>{});
 static_assert( saga::is_random_access_cursor<RandomAccessCursor>{});
+
+static_assert(!saga::is_segmented_cursor<int>{});
+static_assert(!saga::is_segmented_cursor<InputCursor>{});
+static_assert(!saga::is_segmented_cursor<ForwardCursor>{});
+static_assert(!saga::is_segmented_cursor<BidirectionalCursor>{});
+static_assert( saga::is_segmented_cursor<RandomAccessCursor>{});
@@ -0,0 +1,106 @@
+/* (c) 2026 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки SAGA.
+
+SAGA -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+// Тестируемый заголовочный файл
+#include <saga/cursor/cycle.hpp>
+
+// Инфраструктура тестирования
+#include "../saga_test.hpp"
+#include <catch2/catch_amalgamated.hpp>
+
+// Вспомогательные файлы
+#include <saga/algorithm.hpp>
+#include <saga/cursor/subrange.hpp>
+#include <saga/cursor/take.hpp>
+#include <saga/numeric.hpp>
+
+// Тесты
+static_assert(saga::is_segmented_cursor<saga::cycled_cursor<saga::subrange_cursor<int*>>>{});
+
+TEST_CASE("cycled_cursor: take, for_each")
+{
+    using Value = int;
+
+    saga_test::property_checker << [](std::vector<Value> const & values)
+    {
+        if(values.empty())
+        {
+            return;
+        }
+
+        auto const skip = saga_test::random_uniform(0*values.size(), values.size() - 1);
+        auto const num = saga_test::random_uniform(0*values.size(), 3*values.size());
+
+        auto const input
+            = saga::cursor::take(saga::cursor::make_cycled(saga::cursor::drop_front_n
+                                                           (saga::cursor::all(values), skip))
+                                 , num);
+
+        // Выполнение
+        std::vector<Value> result;
+        auto const for_each_result
+            = saga::for_each(input, [&](Value const & arg) { result.push_back(arg); });
+
+        // Проверка
+        std::vector<Value> expected;
+        for(auto index = 0*num; index < num; ++index)
+        {
+            expected.push_back(values[(skip + index) % values.size()]);
+        }
+
+        REQUIRE(result == expected);
+        REQUIRE(!for_each_result.in);
+
+        REQUIRE(saga::reduce(input) == std::accumulate(expected.begin(), expected.end(), 0));
+    };
+}
+
+TEST_CASE("cycled_cursor: take, copy to bounded output")
+{
+    using Value = int;
+
+    saga_test::property_checker
+    << [](std::vector<Value> const & values, std::vector<Value> const & dest_old)
+    {
+        if(values.empty())
+        {
+            return;
+        }
+
+        auto const num = saga_test::random_uniform(0*values.size(), 3*values.size());
+
+        auto const input = saga::cursor::take(saga::cursor::make_cycled(saga::cursor::all(values))
+                                              , num);
+
+        // Выполнение
+        auto dest = dest_old;
+        auto const result = saga::copy(input, saga::cursor::all(dest));
+
+        // Проверка
+        auto const n_copied = std::min(num, dest.size());
+
+        for(auto index = 0*n_copied; index < n_copied; ++index)
+        {
+            REQUIRE(dest[index] == values[index % values.size()]);
+        }
+
+        REQUIRE(std::equal(dest.begin() + n_copied, dest.end(), dest_old.begin() + n_copied));
+
+        REQUIRE(result.out == saga::cursor::drop_front_n(saga::cursor::all(dest), n_copied));
+        REQUIRE(result.in.base().front() == values[n_copied % values.size()]);
+    };
+}
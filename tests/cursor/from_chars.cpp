@@ -0,0 +1,158 @@
+/* (c) 2026 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки SAGA.
+
+SAGA -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+// Тестируемый файл
+#include <saga/cursor/from_chars.hpp>
+
+// Инфраструктура тестирования
+#include "../saga_test.hpp"
+#include <catch2/catch_amalgamated.hpp>
+
+// Используемые в тестах возможности
+#include <saga/cursor/indices.hpp>
+#include <saga/cursor/istream_cursor.hpp>
+#include <saga/cursor/lines.hpp>
+#include <saga/cursor/to.hpp>
+#include <saga/memory/mapped_file.hpp>
+
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Тесты
+namespace
+{
+    /// @brief Чтение всех чисел с сохранением состояния курсора для проверки остатка
+    template <class Number>
+    std::vector<Number> read_all(saga::from_chars_cursor<Number> & cur)
+    {
+        std::vector<Number> result;
+
+        for(; !!cur; ++cur)
+        {
+            result.push_back(*cur);
+        }
+
+        return result;
+    }
+
+    template <class Number>
+    void check_from_chars_cursor_same_as_istream_cursor()
+    {
+        saga_test::property_checker << [](std::vector<Number> const & values)
+        {
+            std::ostringstream output;
+
+            for(auto index : saga::cursor::indices_of(values))
+            {
+                output << values[index] << (index % 3 == 0 ? "\n" : ", ");
+            }
+
+            auto const text = output.str();
+
+            auto cur = saga::cursor::from_chars<Number>(text);
+            auto const actual = ::read_all(cur);
+
+            REQUIRE(actual == values);
+            REQUIRE(cur.rest().empty());
+        };
+    }
+}
+
+TEST_CASE("from_chars_cursor: integers")
+{
+    ::check_from_chars_cursor_same_as_istream_cursor<int>();
+    ::check_from_chars_cursor_same_as_istream_cursor<unsigned>();
+    ::check_from_chars_cursor_same_as_istream_cursor<std::int64_t>();
+}
+
+#ifdef SAGA_HAS_FLOATING_FROM_CHARS
+TEST_CASE("from_chars_cursor: floating point")
+{
+    std::vector<double> const expected{0.5, -2.25, 1e10, 3.0, 7.0};
+
+    auto cur = saga::cursor::from_chars<double>(" 0.5;-2.25\t1e10,\r\n3.0 7");
+    auto const actual = ::read_all(cur);
+
+    CHECK(actual == expected);
+    CHECK(cur.rest().empty());
+}
+#endif
+// SAGA_HAS_FLOATING_FROM_CHARS
+
+TEST_CASE("from_chars_cursor: empty and separators only")
+{
+    CHECK(!saga::cursor::from_chars<int>(""));
+    CHECK(!saga::cursor::from_chars<int>(" ,; \n"));
+}
+
+TEST_CASE("from_chars_cursor: stops on invalid input")
+{
+    auto cur = saga::cursor::from_chars<int>("1 2,x3 4");
+    auto const actual = ::read_all(cur);
+
+    CHECK(actual == std::vector<int>{1, 2});
+    CHECK(cur.rest() == "x3 4");
+}
+
+TEST_CASE("from_chars_cursor: out of range")
+{
+    auto cur = saga::cursor::from_chars<std::uint8_t>("255 256 1");
+    auto const actual = ::read_all(cur);
+
+    CHECK(actual == std::vector<std::uint8_t>{255});
+    CHECK(cur.rest() == "256 1");
+}
+
+TEST_CASE("from_chars_cursor: mapped data file")
+{
+    auto const path = "ProjectEuler/p067_triangle.txt";
+
+    std::ifstream input(path);
+    REQUIRE(!!input);
+
+    auto const expected = saga::make_istream_cursor<int>(input) | saga::cursor::to<std::vector>();
+
+    saga::mapped_file const file(path);
+
+    auto cur = saga::cursor::from_chars<int>(file.view());
+    auto const actual = ::read_all(cur);
+
+    REQUIRE(actual == expected);
+    REQUIRE(cur.rest().empty());
+}
+
+TEST_CASE("from_chars_cursor: lines of mapped data file")
+{
+    saga::mapped_file const file("ProjectEuler/p067_triangle.txt");
+
+    std::size_t row = 0;
+
+    for(auto lines = saga::cursor::lines(file.view()); !!lines; ++lines)
+    {
+        ++row;
+
+        auto const numbers = saga::cursor::from_chars<int>(*lines)
+                           | saga::cursor::to<std::vector>();
+
+        REQUIRE(numbers.size() == row);
+    }
+
+    REQUIRE(row == 100);
+}
@@ -0,0 +1,86 @@
+/* (c) 2026 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки SAGA.
+
+SAGA -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+// Тестируемый файл
+#include <saga/cursor/lines.hpp>
+
+// Инфраструктура тестирования
+#include "../saga_test.hpp"
+#include <catch2/catch_amalgamated.hpp>
+
+// Используемые в тестах возможности
+#include <saga/cursor/by_line.hpp>
+#include <saga/cursor/to.hpp>
+
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Тесты
+TEST_CASE("lines: same as by_line")
+{
+    saga_test::property_checker << [](std::string const & text, char delim)
+    {
+        std::istringstream input(text);
+
+        auto const expected = saga::cursor::by_line(input, delim)
+                            | saga::cursor::to<std::vector>();
+
+        auto const actual = saga::cursor::lines(text, delim)
+                          | saga::cursor::to<std::vector<std::string>>();
+
+        REQUIRE(actual == expected);
+    };
+}
+
+TEST_CASE("lines: zero copy")
+{
+    std::string_view const text = "alpha\nbeta\n\ngamma";
+
+    std::vector<std::string_view> const expected{"alpha", "beta", "", "gamma"};
+
+    auto const actual = saga::cursor::lines(text) | saga::cursor::to<std::vector>();
+
+    REQUIRE(actual == expected);
+
+    for(auto const & line : actual)
+    {
+        CHECK(text.data() <= line.data());
+        CHECK(line.data() + line.size() <= text.data() + text.size());
+    }
+}
+
+TEST_CASE("lines: with delimeter")
+{
+    std::vector<std::string_view> const expected{"192", "168", "0", "1"};
+
+    auto const actual = saga::cursor::lines("192:168:0:1", ':') | saga::cursor::to<std::vector>();
+
+    CHECK(actual == expected);
+}
+
+TEST_CASE("lines: wide characters")
+{
+    std::wstring_view const text = L"one\ntwo\n";
+
+    std::vector<std::wstring_view> const expected{L"one", L"two"};
+
+    auto const actual = saga::cursor::lines(text) | saga::cursor::to<std::vector>();
+
+    CHECK(actual == expected);
+}
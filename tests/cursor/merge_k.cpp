@@ -0,0 +1,250 @@
+/* (c) 2026 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки SAGA.
+
+SAGA -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+// Тестируемый заголовочный файл
+#include <saga/cursor/merge_k.hpp>
+
+// Инфраструктура тестирования
+#include "../saga_test.hpp"
+#include <catch2/catch_amalgamated.hpp>
+
+// Вспомогательные файлы
+#include <saga/algorithm.hpp>
+#include <saga/cursor/istream_cursor.hpp>
+#include <saga/cursor/subrange.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+// Тесты
+namespace
+{
+    template <class Value>
+    std::vector<Value> stable_merge_reference(std::vector<std::vector<Value>> const & inputs)
+    {
+        std::vector<Value> result;
+
+        for(auto const & input : inputs)
+        {
+            result.insert(result.end(), input.begin(), input.end());
+        }
+
+        std::stable_sort(result.begin(), result.end());
+
+        return result;
+    }
+}
+
+TEST_CASE("merge_k: subrange cursors")
+{
+    using Value = int;
+
+    saga_test::property_checker << [](std::vector<std::vector<Value>> inputs)
+    {
+        for(auto & input : inputs)
+        {
+            std::sort(input.begin(), input.end());
+        }
+
+        std::vector<saga::subrange_cursor<std::vector<Value>::const_iterator>> cursors;
+        for(auto const & input : inputs)
+        {
+            cursors.push_back(saga::cursor::all(input));
+        }
+
+        std::vector<Value> result;
+        saga::copy(saga::cursor::merge_k(cursors), saga::back_inserter(result));
+
+        REQUIRE(result == stable_merge_reference(inputs));
+    };
+}
+
+TEST_CASE("merge_k: stability")
+{
+    using Value = int;
+    using Element = std::pair<Value, std::size_t>;
+
+    saga_test::property_checker << [](std::vector<std::vector<Value>> const & values)
+    {
+        std::vector<std::vector<Element>> inputs;
+        for(auto index = 0*values.size(); index < values.size(); ++index)
+        {
+            inputs.emplace_back();
+
+            for(auto const & value : values[index])
+            {
+                inputs.back().emplace_back(value % 8, index);
+            }
+
+            std::stable_sort(inputs.back().begin(), inputs.back().end()
+                            , [](Element const & lhs, Element const & rhs)
+                              { return lhs.first < rhs.first; });
+        }
+
+        std::vector<Element> expected;
+        for(auto const & input : inputs)
+        {
+            expected.insert(expected.end(), input.begin(), input.end());
+        }
+
+        auto const by_key = [](Element const & lhs, Element const & rhs)
+        {
+            return lhs.first < rhs.first;
+        };
+
+        std::stable_sort(expected.begin(), expected.end(), by_key);
+
+        std::vector<saga::subrange_cursor<std::vector<Element>::const_iterator>> cursors;
+        for(auto const & input : inputs)
+        {
+            cursors.push_back(saga::cursor::all(input));
+        }
+
+        std::vector<Element> result;
+        auto merged = saga::cursor::merge_k(std::move(cursors), by_key);
+        for(; !!merged; ++merged)
+        {
+            REQUIRE(merged.front_index() == merged.front().second);
+            result.push_back(*merged);
+        }
+
+        REQUIRE(result == expected);
+    };
+}
+
+TEST_CASE("merge_k: istream cursors")
+{
+    using Value = int;
+
+    saga_test::property_checker << [](std::vector<std::vector<Value>> inputs)
+    {
+        std::vector<std::istringstream> streams;
+        for(auto & input : inputs)
+        {
+            std::sort(input.begin(), input.end());
+            streams.push_back(saga_test::make_istringstream_from_range(input));
+        }
+
+        std::vector<saga::istream_cursor<Value, std::istringstream>> cursors;
+        for(auto & stream : streams)
+        {
+            cursors.push_back(saga::make_istream_cursor<Value>(stream));
+        }
+
+        std::vector<Value> result;
+        saga::copy(saga::cursor::merge_k(std::move(cursors)), saga::back_inserter(result));
+
+        REQUIRE(result == stable_merge_reference(inputs));
+    };
+}
+
+TEST_CASE("merge_k: comparisons per element")
+{
+    using Value = int;
+
+    saga_test::property_checker << [](std::vector<std::vector<Value>> inputs)
+    {
+        for(auto & input : inputs)
+        {
+            std::sort(input.begin(), input.end());
+        }
+
+        std::vector<saga::subrange_cursor<std::vector<Value>::const_iterator>> cursors;
+        for(auto const & input : inputs)
+        {
+            cursors.push_back(saga::cursor::all(input));
+        }
+
+        auto comparisons = std::size_t(0);
+        auto const cmp = [&comparisons](Value const & lhs, Value const & rhs)
+        {
+            ++comparisons;
+            return lhs < rhs;
+        };
+
+        auto merged = saga::cursor::merge_k(cursors, cmp);
+        auto const build_comparisons = comparisons;
+
+        auto num = std::size_t(0);
+        for(; !!merged; ++merged)
+        {
+            ++num;
+        }
+
+        auto const height = inputs.size() < 2 ? 0 : std::ceil(std::log2(inputs.size()));
+
+        REQUIRE(build_comparisons <= inputs.size());
+        REQUIRE(comparisons - build_comparisons <= num * height);
+    };
+}
+
+TEST_CASE("merge_k: empty")
+{
+    std::vector<saga::subrange_cursor<int const *>> cursors;
+
+    auto const merged = saga::cursor::merge_k(cursors);
+
+    REQUIRE(!merged);
+}
+
+namespace
+{
+    struct merge_k_test_key
+    {
+        int value = 0;
+
+        bool less(merge_k_test_key const & other) const
+        {
+            return this->value < other.value;
+        }
+    };
+}
+
+TEST_CASE("merge_k: pointer to member function as comparator")
+{
+    saga_test::property_checker << [](std::vector<std::vector<int>> inputs)
+    {
+        std::vector<std::vector<merge_k_test_key>> keys;
+        for(auto & input : inputs)
+        {
+            std::sort(input.begin(), input.end());
+
+            keys.emplace_back();
+            for(auto const & value : input)
+            {
+                keys.back().push_back(merge_k_test_key{value});
+            }
+        }
+
+        std::vector<saga::subrange_cursor<std::vector<merge_k_test_key>::const_iterator>> cursors;
+        for(auto const & key : keys)
+        {
+            cursors.push_back(saga::cursor::all(key));
+        }
+
+        std::vector<int> result;
+        for(auto cur = saga::cursor::merge_k(cursors, &merge_k_test_key::less); !!cur; ++cur)
+        {
+            result.push_back(cur.front().value);
+        }
+
+        REQUIRE(result == stable_merge_reference(inputs));
+    };
+}
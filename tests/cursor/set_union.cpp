@@ -0,0 +1,134 @@
+/* (c) 2026 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки SAGA.
+
+SAGA -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+// Тестируемый заголовочный файл
+#include <saga/cursor/set_union.hpp>
+
+// Инфраструктура тестирования
+#include "../saga_test.hpp"
+#include <catch2/catch_amalgamated.hpp>
+
+// Вспомогательные файлы
+#include <saga/algorithm.hpp>
+#include <saga/cursor/istream_cursor.hpp>
+#include <saga/cursor/subrange.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <sstream>
+#include <vector>
+
+// Тесты
+namespace
+{
+    template <class Value, class Compare = std::less<>>
+    std::vector<Value>
+    set_union_reference(std::vector<std::vector<Value>> const & inputs, Compare cmp = Compare())
+    {
+        std::vector<Value> result;
+
+        for(auto const & input : inputs)
+        {
+            std::vector<Value> next;
+            std::set_union(result.begin(), result.end(), input.begin(), input.end()
+                          , std::back_inserter(next), cmp);
+            result = std::move(next);
+        }
+
+        return result;
+    }
+}
+
+TEST_CASE("set_union: two cursors")
+{
+    using Value = int;
+
+    saga_test::property_checker << [](std::vector<Value> lhs, std::vector<Value> rhs)
+    {
+        std::sort(lhs.begin(), lhs.end());
+        std::sort(rhs.begin(), rhs.end());
+
+        std::vector<Value> result;
+        saga::copy(saga::cursor::set_union(saga::cursor::all(lhs), saga::cursor::all(rhs))
+                   , saga::back_inserter(result));
+
+        REQUIRE(result == set_union_reference<Value>({lhs, rhs}));
+    };
+}
+
+TEST_CASE("set_union_k: subrange cursors")
+{
+    using Value = int;
+
+    saga_test::property_checker << [](std::vector<std::vector<Value>> inputs)
+    {
+        for(auto & input : inputs)
+        {
+            for(auto & value : input)
+            {
+                value %= 16;
+            }
+
+            std::sort(input.begin(), input.end());
+        }
+
+        std::vector<saga::subrange_cursor<std::vector<Value>::const_iterator>> cursors;
+        for(auto const & input : inputs)
+        {
+            cursors.push_back(saga::cursor::all(input));
+        }
+
+        std::vector<Value> result;
+        saga::copy(saga::cursor::set_union_k(cursors), saga::back_inserter(result));
+
+        REQUIRE(result == set_union_reference(inputs));
+    };
+}
+
+TEST_CASE("set_union_k: istream cursors, custom order")
+{
+    using Value = int;
+
+    saga_test::property_checker << [](std::vector<std::vector<Value>> inputs)
+    {
+        auto const cmp = std::greater<>{};
+
+        std::vector<std::istringstream> streams;
+        for(auto & input : inputs)
+        {
+            for(auto & value : input)
+            {
+                value %= 16;
+            }
+
+            std::sort(input.begin(), input.end(), cmp);
+            streams.push_back(saga_test::make_istringstream_from_range(input));
+        }
+
+        std::vector<saga::istream_cursor<Value, std::istringstream>> cursors;
+        for(auto & stream : streams)
+        {
+            cursors.push_back(saga::make_istream_cursor<Value>(stream));
+        }
+
+        std::vector<Value> result;
+        saga::copy(saga::cursor::set_union_k(std::move(cursors), cmp)
+                   , saga::back_inserter(result));
+
+        REQUIRE(result == set_union_reference(inputs, cmp));
+    };
+}
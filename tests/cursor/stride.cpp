@@ -0,0 +1,92 @@
+/* (c) 2026 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки SAGA.
+
+SAGA -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+// Тестируемый заголовочный файл
+#include <saga/cursor/stride.hpp>
+
+// Инфраструктура тестирования
+#include "../saga_test.hpp"
+#include <catch2/catch_amalgamated.hpp>
+
+// Вспомогательные файлы
+#include <saga/algorithm.hpp>
+#include <saga/cursor/cycle.hpp>
+#include <saga/cursor/subrange.hpp>
+#include <saga/cursor/take.hpp>
+#include <saga/numeric.hpp>
+
+// Тесты
+static_assert(saga::is_segmented_cursor<saga::stride_cursor<saga::subrange_cursor<int*>>>{});
+
+TEST_CASE("stride_cursor: for_each, reduce")
+{
+    // Беззнаковый тип: переполнение при суммировании случайных значений определено
+    using Value = unsigned long;
+
+    saga_test::property_checker << [](std::vector<Value> const & values)
+    {
+        auto const step = saga_test::random_uniform(1, 5);
+
+        auto const input = saga::cursor::stride(saga::cursor::all(values), step);
+
+        // Выполнение
+        std::vector<Value> result;
+        saga::for_each(input, [&](Value const & arg) { result.push_back(arg); });
+
+        // Проверка
+        std::vector<Value> expected;
+        for(auto index = 0*values.size(); index < values.size(); index += step)
+        {
+            expected.push_back(values[index]);
+        }
+
+        REQUIRE(result == expected);
+        REQUIRE(saga::reduce(input) == std::accumulate(expected.begin(), expected.end(), Value(0)));
+    };
+}
+
+TEST_CASE("stride_cursor: over cycled cursor")
+{
+    using Value = int;
+
+    saga_test::property_checker << [](std::vector<Value> const & values)
+    {
+        if(values.empty())
+        {
+            return;
+        }
+
+        auto const step = saga_test::random_uniform(1, 5);
+        auto const num = saga_test::random_uniform(0*values.size(), 3*values.size());
+
+        auto const cycled = saga::cursor::make_cycled(saga::cursor::all(values));
+
+        // Выполнение
+        std::vector<Value> result;
+        auto const input = saga::cursor::take(saga::cursor::stride(cycled, step), num);
+        saga::for_each(input, [&](Value const & arg) { result.push_back(arg); });
+
+        // Проверка
+        std::vector<Value> expected;
+        for(auto index = 0*num; index < num; ++index)
+        {
+            expected.push_back(values[(index * step) % values.size()]);
+        }
+
+        REQUIRE(result == expected);
+    };
+}
@@ -254,3 +254,22 @@ static_assert(std::is_same<saga::subrange_cursor<int*
 #endif
 // __cpp_lib_ranges
 
+
+TEST_CASE("subrange_cursor: data of contiguous range")
+{
+    saga_test::property_checker << [](std::vector<int> const & src)
+    {
+        auto const cur = saga::cursor::all(src);
+
+        if(src.empty())
+        {
+            // Итератор пустого интервала нельзя разыменовывать: возвращается нулевой указатель
+            REQUIRE(cur.data() == nullptr);
+        }
+        else
+        {
+            REQUIRE(cur.data() == src.data());
+            REQUIRE(saga::cursor::drop_front_n(cur, src.size()).data() == nullptr);
+        }
+    };
+}
@@ -85,3 +85,28 @@ TEST_CASE("take_cursor: output")
 
     };
 }
+
+TEST_CASE("take_cursor: segmented")
+{
+    using Value = int;
+
+    saga_test::property_checker << [](std::vector<Value> const & values)
+    {
+        auto const num = saga_test::random_uniform(0*values.size(), 2*values.size());
+
+        auto const input = saga::cursor::take(saga::cursor::all(values), num);
+
+        static_assert(saga::is_segmented_cursor<decltype(input)>{});
+
+        // Выполнение
+        std::vector<Value> result;
+        auto const for_each_result
+            = saga::for_each(input, [&](Value const & arg) { result.push_back(arg); });
+
+        // Проверка
+        auto const n_expected = std::min(values.size(), num);
+
+        REQUIRE(result == std::vector<Value>(values.begin(), values.begin() + n_expected));
+        REQUIRE(for_each_result.in.base() == saga::cursor::drop_front_n(input.base(), n_expected));
+    };
+}
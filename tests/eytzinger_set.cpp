@@ -0,0 +1,165 @@
+/* (c) 2026 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки SAGA.
+
+SAGA -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+// Тестируемый файл
+#include <saga/eytzinger_set.hpp>
+
+// Инфраструктура тестирования
+#include "saga_test.hpp"
+#include <catch2/catch_amalgamated.hpp>
+
+// Вспомогательные файлы
+#include <algorithm>
+#include <string>
+
+namespace
+{
+    template <class Set, class FlatSet, class Key>
+    void check_eytzinger_lookup(Set const & actual, FlatSet const & expected, Key const & key)
+    {
+        auto const cmp = expected.key_comp();
+
+        auto const lower = std::lower_bound(expected.begin(), expected.end(), key, cmp);
+        auto const upper = std::upper_bound(expected.begin(), expected.end(), key, cmp);
+
+        CAPTURE(key);
+
+        REQUIRE(std::distance(actual.begin(), actual.lower_bound(key))
+                == std::distance(expected.begin(), lower));
+        REQUIRE(std::distance(actual.begin(), actual.upper_bound(key))
+                == std::distance(expected.begin(), upper));
+
+        auto const range = actual.equal_range(key);
+        REQUIRE(range.first == actual.lower_bound(key));
+        REQUIRE(range.second == actual.upper_bound(key));
+
+        auto const is_found = (lower != upper);
+
+        REQUIRE(actual.contains(key) == is_found);
+        REQUIRE(actual.count(key) == (is_found ? 1u : 0u));
+
+        if(is_found)
+        {
+            REQUIRE(*actual.find(key) == *lower);
+        }
+        else
+        {
+            REQUIRE(actual.find(key) == actual.end());
+        }
+    }
+}
+
+// Тесты
+TEST_CASE("eytzinger_set: all tree shapes")
+{
+    for(auto num = 0; num < 130; ++num)
+    {
+        CAPTURE(num);
+
+        std::vector<int> values;
+        for(auto index = 0; index < num; ++index)
+        {
+            values.push_back(2 * index + 1);
+        }
+
+        saga::flat_set<int> const expected(values);
+        saga::eytzinger_set<int> const actual(expected);
+
+        REQUIRE(actual.size() == expected.size());
+        REQUIRE(actual.empty() == expected.empty());
+
+        REQUIRE(std::equal(actual.begin(), actual.end(), expected.begin(), expected.end()));
+        REQUIRE(std::equal(saga::make_reverse_iterator(actual.end())
+                          , saga::make_reverse_iterator(actual.begin())
+                          , expected.rbegin(), expected.rend()));
+
+        for(auto key = -1; key <= 2 * num + 1; ++key)
+        {
+            ::check_eytzinger_lookup(actual, expected, key);
+        }
+    }
+}
+
+TEST_CASE("eytzinger_set: same as flat_set")
+{
+    using Element = int;
+    using Compare = saga_test::strict_weak_order<Element>;
+
+    saga_test::property_checker
+    << [](std::vector<Element> const & src, std::vector<Element> const & queries
+         , Compare const & cmp)
+    {
+        saga::flat_set<Element, Compare> const expected(src.begin(), src.end(), cmp
+                                                       , std::allocator<Element>{});
+        saga::eytzinger_set<Element, Compare> const actual(expected);
+
+        REQUIRE(actual.key_comp() == cmp);
+        REQUIRE(actual.value_comp() == cmp);
+        REQUIRE(actual.size() == expected.size());
+        REQUIRE(std::equal(actual.begin(), actual.end(), expected.begin(), expected.end()));
+
+        for(auto const & key : queries)
+        {
+            ::check_eytzinger_lookup(actual, expected, key);
+        }
+
+        for(auto const & key : src)
+        {
+            ::check_eytzinger_lookup(actual, expected, key);
+        }
+    };
+}
+
+TEST_CASE("eytzinger_set: from sorted unique range")
+{
+    using Element = std::string;
+
+    saga_test::property_checker << [](std::vector<Element> const & src)
+    {
+        saga::flat_set<Element> const expected(src);
+
+        saga::eytzinger_set<Element> const actual(saga::sorted_unique
+                                                 , expected.begin(), expected.end());
+
+        REQUIRE(std::equal(actual.begin(), actual.end(), expected.begin(), expected.end()));
+        REQUIRE(actual == saga::eytzinger_set<Element>(expected));
+        REQUIRE_FALSE(actual != saga::eytzinger_set<Element>(expected));
+
+        for(auto const & key : src)
+        {
+            REQUIRE(actual.contains(key));
+            REQUIRE(*actual.find(key) == key);
+        }
+    };
+}
+
+TEST_CASE("eytzinger_set: default constructor")
+{
+    saga::eytzinger_set<long> const actual;
+
+    REQUIRE(actual.empty());
+    REQUIRE(actual.size() == 0);
+    REQUIRE(actual.begin() == actual.end());
+    REQUIRE(actual.cbegin() == actual.cend());
+    REQUIRE(actual.find(42) == actual.end());
+    REQUIRE(actual.lower_bound(42) == actual.end());
+    REQUIRE(!actual.contains(42));
+}
+
+static_assert(std::is_same<saga::eytzinger_set<int>::iterator::iterator_category
+                          , std::bidirectional_iterator_tag>{});
+static_assert(std::is_same<saga::eytzinger_set<int>::iterator::reference, int const &>{});
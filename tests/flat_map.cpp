@@ -0,0 +1,379 @@
+/* (c) 2026 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки SAGA.
+
+SAGA -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+// Тестируемый файл
+#include <saga/flat_map.hpp>
+
+// Инфраструктура тестирования
+#include "saga_test.hpp"
+#include <catch2/catch_amalgamated.hpp>
+
+// Вспомогательные файлы
+#include <saga/test/allocation_counter.hpp>
+
+#include <cstddef>
+#include <deque>
+#include <map>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+namespace
+{
+    template <class FlatMap, class Map>
+    bool is_same_as_map(FlatMap const & actual, Map const & expected)
+    {
+        if(actual.size() != expected.size() || actual.empty() != expected.empty())
+        {
+            return false;
+        }
+
+        auto pos = expected.begin();
+
+        for(auto const & elem : actual)
+        {
+            if(elem.first != pos->first || elem.second != pos->second)
+            {
+                return false;
+            }
+
+            ++pos;
+        }
+
+        return pos == expected.end();
+    }
+
+    // Ключи из небольшого множества, чтобы было много повторов
+    template <class Pairs>
+    Pairs with_few_keys(Pairs src)
+    {
+        for(auto & elem : src)
+        {
+            elem.first %= 64;
+        }
+
+        return src;
+    }
+}
+
+// Тесты
+TEST_CASE("flat_map: containers constructor")
+{
+    using Key = int;
+    using Value = long;
+    using Compare = saga_test::strict_weak_order<Key>;
+    using FlatMap = saga::flat_map<Key, Value, Compare>;
+
+    saga_test::property_checker
+    << [](std::vector<std::pair<Key, Value>> const & src, Compare const & cmp)
+    {
+        std::vector<Key> keys;
+        std::vector<Value> values;
+        std::map<Key, Value, Compare> expected(cmp);
+
+        for(auto const & elem : with_few_keys(src))
+        {
+            keys.push_back(elem.first);
+            values.push_back(elem.second);
+            expected.emplace(elem.first, elem.second);
+        }
+
+        FlatMap const actual(keys, values, cmp);
+
+        REQUIRE(::is_same_as_map(actual, expected));
+        REQUIRE(actual.key_comp() == cmp);
+
+        FlatMap const sorted(saga::sorted_unique, actual.keys(), actual.values(), cmp);
+
+        REQUIRE(sorted == actual);
+    };
+}
+
+TEST_CASE("flat_map: insert range")
+{
+    using Key = int;
+    using Value = std::string;
+    using Compare = saga_test::strict_weak_order<Key>;
+    using KeyContainer = std::deque<Key>;
+    using FlatMap = saga::flat_map<Key, Value, Compare, KeyContainer>;
+
+    saga_test::property_checker
+    << [](std::vector<std::pair<Key, Value>> const & src_raw
+         , std::vector<std::pair<Key, Value>> const & extra_raw, Compare const & cmp)
+    {
+        auto const src = with_few_keys(src_raw);
+        auto const extra = with_few_keys(extra_raw);
+
+        std::map<Key, Value, Compare> expected(src.begin(), src.end(), cmp);
+
+        FlatMap actual(src.begin(), src.end(), cmp);
+        REQUIRE(::is_same_as_map(actual, expected));
+
+        expected.insert(extra.begin(), extra.end());
+        actual.insert(extra.begin(), extra.end());
+
+        REQUIRE(::is_same_as_map(actual, expected));
+    };
+}
+
+TEST_CASE("flat_map: insert range uses allocators of containers")
+{
+    using Key = int;
+    using Value = long;
+    using KeyContainer = std::pmr::vector<Key>;
+    using MappedContainer = std::pmr::vector<Value>;
+    using FlatMap = saga::flat_map<Key, Value, std::less<>, KeyContainer, MappedContainer>;
+
+    saga_test::property_checker
+    << [](std::vector<std::pair<Key, Value>> const & src
+         , std::vector<std::pair<Key, Value>> const & extra)
+    {
+        auto const elem_size = sizeof(Key) + sizeof(Value) + sizeof(std::size_t);
+
+        std::vector<std::byte> buffer(16 * (src.size() + extra.size() + 1) * elem_size);
+
+        std::pmr::monotonic_buffer_resource resource(buffer.data(), buffer.size()
+                                                     , std::pmr::null_memory_resource());
+
+        saga::allocation_counter const allocations;
+
+        FlatMap actual{KeyContainer(&resource), MappedContainer(&resource)};
+        actual.insert(src.begin(), src.end());
+        actual.insert(extra.begin(), extra.end());
+
+        REQUIRE(allocations.counts().allocations == 0);
+
+        std::map<Key, Value> expected(src.begin(), src.end());
+        expected.insert(extra.begin(), extra.end());
+
+        REQUIRE(::is_same_as_map(actual, expected));
+    };
+}
+
+TEST_CASE("flat_map: insert sorted unique range")
+{
+    using Key = long;
+    using Value = int;
+    using FlatMap = saga::flat_map<Key, Value>;
+
+    saga_test::property_checker
+    << [](std::vector<std::pair<Key, Value>> const & src_raw
+         , std::vector<std::pair<Key, Value>> const & extra_raw)
+    {
+        auto const src = with_few_keys(src_raw);
+        std::map<Key, Value> const extra(extra_raw.begin(), extra_raw.end());
+
+        std::map<Key, Value> expected(src.begin(), src.end());
+        std::map<Key, Value> const src_map = expected;
+
+        FlatMap actual(saga::sorted_unique, src_map.begin(), src_map.end());
+        REQUIRE(::is_same_as_map(actual, expected));
+
+        expected.insert(extra.begin(), extra.end());
+        actual.insert(saga::sorted_unique, extra.begin(), extra.end());
+
+        REQUIRE(::is_same_as_map(actual, expected));
+    };
+}
+
+TEST_CASE("flat_map: element-wise modifications and lookup")
+{
+    using Key = int;
+    using Value = int;
+    using FlatMap = saga::flat_map<Key, Value>;
+
+    saga_test::property_checker
+    << [](std::vector<std::pair<Key, Value>> const & ops_raw)
+    {
+        auto const ops = with_few_keys(ops_raw);
+
+        FlatMap actual;
+        std::map<Key, Value> expected;
+
+        for(auto const & op : ops)
+        {
+            switch((op.second % 6 + 6) % 6)
+            {
+            case 0:
+                actual[op.first] += op.second;
+                expected[op.first] += op.second;
+                break;
+
+            case 1:
+                REQUIRE(actual.insert({op.first, op.second}).second
+                        == expected.insert({op.first, op.second}).second);
+                break;
+
+            case 2:
+                REQUIRE(actual.try_emplace(op.first, op.second).second
+                        == expected.try_emplace(op.first, op.second).second);
+                break;
+
+            case 3:
+                REQUIRE(actual.insert_or_assign(op.first, op.second).second
+                        == expected.insert_or_assign(op.first, op.second).second);
+                break;
+
+            case 4:
+                REQUIRE(actual.erase(op.first) == expected.erase(op.first));
+                break;
+
+            default:
+                REQUIRE(actual.emplace(op.first, op.second).second
+                        == expected.emplace(op.first, op.second).second);
+            }
+
+            REQUIRE(::is_same_as_map(actual, expected));
+        }
+
+        for(auto key = Key(-1); key <= 64; ++key)
+        {
+            auto const & const_actual = actual;
+
+            REQUIRE(actual.count(key) == expected.count(key));
+            REQUIRE(actual.contains(key) == (expected.count(key) == 1));
+            REQUIRE((actual.find(key) == actual.end()) == (expected.find(key) == expected.end()));
+            REQUIRE(const_actual.find(key) == actual.find(key));
+
+            auto const lower = std::distance(expected.begin(), expected.lower_bound(key));
+            auto const upper = std::distance(expected.begin(), expected.upper_bound(key));
+
+            REQUIRE(actual.lower_bound(key) - actual.begin() == lower);
+            REQUIRE(const_actual.lower_bound(key) - const_actual.begin() == lower);
+            REQUIRE(actual.upper_bound(key) - actual.begin() == upper);
+            REQUIRE(const_actual.upper_bound(key) - const_actual.begin() == upper);
+
+            auto const range = actual.equal_range(key);
+            REQUIRE(range.first == actual.lower_bound(key));
+            REQUIRE(range.second == actual.upper_bound(key));
+
+            if(actual.contains(key))
+            {
+                REQUIRE(actual.at(key) == expected.at(key));
+                REQUIRE(const_actual.at(key) == expected.at(key));
+                REQUIRE(actual.find(key)->second == expected.at(key));
+            }
+            else
+            {
+                REQUIRE_THROWS_AS(actual.at(key), std::out_of_range);
+                REQUIRE_THROWS_AS(const_actual.at(key), std::out_of_range);
+            }
+        }
+    };
+}
+
+TEST_CASE("flat_map: iterators")
+{
+    using Key = int;
+    using Value = long;
+    using FlatMap = saga::flat_map<Key, Value>;
+
+    static_assert(std::is_convertible<FlatMap::iterator, FlatMap::const_iterator>{});
+    static_assert(!std::is_convertible<FlatMap::const_iterator, FlatMap::iterator>{});
+    static_assert(std::is_same<FlatMap::iterator::reference, std::pair<Key const &, Value &>>{});
+    static_assert(std::is_same<FlatMap::const_iterator::reference
+                              , std::pair<Key const &, Value const &>>{});
+
+    saga_test::property_checker << [](std::vector<std::pair<Key, Value>> const & src)
+    {
+        FlatMap actual(src.begin(), src.end());
+        auto const & const_actual = actual;
+
+        REQUIRE(actual.end() - actual.begin() == static_cast<std::ptrdiff_t>(actual.size()));
+        REQUIRE(actual.cbegin() == const_actual.begin());
+        REQUIRE(actual.cend() == const_actual.end());
+
+        for(auto index = std::size_t(0); index < actual.size(); ++index)
+        {
+            auto const pos = actual.begin() + static_cast<std::ptrdiff_t>(index);
+
+            REQUIRE(pos->first == actual.keys()[index]);
+            REQUIRE(actual.begin()[static_cast<std::ptrdiff_t>(index)].second
+                    == actual.values()[index]);
+            REQUIRE((actual.rbegin() + static_cast<std::ptrdiff_t>(actual.size() - index - 1))
+                    ->first == pos->first);
+            REQUIRE(pos < actual.end());
+            REQUIRE(FlatMap::const_iterator(pos) == pos);
+
+            pos->second = static_cast<Value>(index);
+        }
+
+        REQUIRE(actual.crend() - actual.crbegin() == static_cast<std::ptrdiff_t>(actual.size()));
+
+        auto expected_value = Value(0);
+        for(auto const & value : actual.values())
+        {
+            REQUIRE(value == expected_value);
+            ++expected_value;
+        }
+    };
+}
+
+TEST_CASE("flat_map: extract, replace, clear, swap")
+{
+    using Key = int;
+    using Value = int;
+    using FlatMap = saga::flat_map<Key, Value>;
+
+    saga_test::property_checker
+    << [](std::vector<std::pair<Key, Value>> const & lhs_src
+         , std::vector<std::pair<Key, Value>> const & rhs_src)
+    {
+        FlatMap const lhs_old(lhs_src.begin(), lhs_src.end());
+        FlatMap const rhs_old(rhs_src.begin(), rhs_src.end());
+
+        auto lhs = lhs_old;
+        auto rhs = rhs_old;
+
+        swap(lhs, rhs);
+        REQUIRE(lhs == rhs_old);
+        REQUIRE(rhs == lhs_old);
+        REQUIRE((lhs < rhs) == (rhs_old < lhs_old));
+
+        auto containers = std::move(lhs).extract();
+        REQUIRE(lhs.empty());
+        REQUIRE(containers.keys == rhs_old.keys());
+        REQUIRE(containers.values == rhs_old.values());
+
+        lhs.replace(std::move(containers.keys), std::move(containers.values));
+        REQUIRE(lhs == rhs_old);
+
+        lhs.clear();
+        REQUIRE(lhs.empty());
+        REQUIRE(lhs.begin() == lhs.end());
+    };
+}
+
+TEST_CASE("flat_map: initializer list")
+{
+    saga::flat_map<std::string, int> actual{{"one", 1}, {"two", 2}, {"one", 3}};
+
+    REQUIRE(actual.size() == 2);
+    REQUIRE(actual.at("one") == 1);
+    REQUIRE(actual.at("two") == 2);
+
+    actual.insert({{"three", 3}, {"two", 4}});
+
+    REQUIRE(actual.keys() == std::vector<std::string>{"one", "three", "two"});
+    REQUIRE(actual.values() == std::vector<int>{1, 3, 2});
+}
+
+static_assert(std::is_same<saga::flat_map<char, int>::value_type, std::pair<char, int>>{});
+static_assert(std::is_same<saga::flat_map<char, int>::key_container_type, std::vector<char>>{});
+static_assert(std::is_same<saga::flat_map<char, int>::mapped_container_type, std::vector<int>>{});
+static_assert(std::is_same<saga::flat_map<char, int, std::greater<>>::key_compare
+                          , std::greater<>>{});
@@ -23,7 +23,12 @@ SAGA -- это свободной программное обеспечение:
 #include <catch2/catch_amalgamated.hpp>
 
 // Используемые возможности
+#include <saga/test/allocation_counter.hpp>
+
+#include <cstddef>
 #include <deque>
+#include <memory>
+#include <memory_resource>
 #include <set>
 
 namespace
@@ -179,6 +184,44 @@ TEST_CASE("flat_set: constructor from elements, compare and allocator")
     };
 }
 
+TEST_CASE("flat_set: allocator constructors")
+{
+    using Element = int;
+    using Compare = saga_test::strict_weak_order<Element>;
+    using Allocator = saga_test::allocator_with_tag<Element>;
+    using Container = std::vector<Element, Allocator>;
+    using FlatSet = saga::flat_set<Element, Compare, Container>;
+
+    static_assert(std::uses_allocator<FlatSet, Allocator>{});
+
+    saga_test::property_checker
+    << [](std::vector<Element> const & src, Compare const & cmp
+         , Allocator const & alloc, Allocator const & other_alloc)
+    {
+        saga::flat_set<Element, std::less<>, Container> const empty_set(alloc);
+        REQUIRE(empty_set.empty());
+        REQUIRE(empty_set.get_allocator() == alloc);
+
+        FlatSet const empty_with_cmp(cmp, alloc);
+        REQUIRE(empty_with_cmp.empty());
+        REQUIRE(empty_with_cmp.key_comp() == cmp);
+        REQUIRE(empty_with_cmp.get_allocator() == alloc);
+
+        FlatSet const actual(src.begin(), src.end(), cmp, alloc);
+
+        FlatSet const copy(actual, other_alloc);
+        REQUIRE(saga_test::deep_equal_associative_container(copy, FlatSet(actual.begin()
+                                                                         , actual.end(), cmp
+                                                                         , other_alloc)));
+
+        auto tmp = actual;
+        FlatSet const moved(std::move(tmp), other_alloc);
+        REQUIRE(moved == actual);
+        REQUIRE(moved.key_comp() == cmp);
+        REQUIRE(moved.get_allocator() == other_alloc);
+    };
+}
+
 // @todo Возможно, перенести в тест saga_test
 TEST_CASE("flat_set: deep equality - for test")
 {
@@ -660,6 +703,202 @@ TEST_CASE("flat_set: container constructor")
     };
 }
 
+// Модифицирующие операции
+TEST_CASE("flat_set: insert range")
+{
+    using Element = int;
+    using Compare = saga_test::strict_weak_order<Element>;
+    using Container = std::deque<Element>;
+    using FlatSet = saga::flat_set<Element, Compare, Container>;
+
+    saga_test::property_checker
+    << [](std::vector<Element> const & src, std::vector<Element> const & extra, Compare const & cmp)
+    {
+        std::set<Element, Compare> const old_set(src.begin(), src.end(), cmp);
+
+        auto expected = old_set;
+        expected.insert(extra.begin(), extra.end());
+
+        FlatSet actual(src.begin(), src.end(), cmp, std::allocator<Element>{});
+        actual.insert(extra.begin(), extra.end());
+
+        CAPTURE(actual, expected);
+        REQUIRE(::is_equivalent_by_compare(actual, expected, cmp));
+
+        // Уже имевшиеся элементы не заменяются эквивалентными им новыми
+        for(auto const & elem : actual)
+        {
+            auto const pos = old_set.find(elem);
+
+            if(pos != old_set.end())
+            {
+                REQUIRE(*pos == elem);
+            }
+        }
+    };
+}
+
+TEST_CASE("flat_set: insert sorted unique range")
+{
+    using Element = long;
+    using Compare = saga_test::strict_weak_order<Element>;
+    using FlatSet = saga::flat_set<Element, Compare>;
+
+    saga_test::property_checker
+    << [](std::vector<Element> const & src, std::vector<Element> const & extra, Compare const & cmp)
+    {
+        std::set<Element, Compare> const old_set(src.begin(), src.end(), cmp);
+        std::set<Element, Compare> const extra_set(extra.begin(), extra.end(), cmp);
+
+        auto expected = old_set;
+        expected.insert(extra_set.begin(), extra_set.end());
+
+        FlatSet actual(src.begin(), src.end(), cmp, std::allocator<Element>{});
+        actual.insert(saga::sorted_unique, extra_set.begin(), extra_set.end());
+
+        CAPTURE(actual, expected);
+        REQUIRE(::is_equivalent_by_compare(actual, expected, cmp));
+
+        for(auto const & elem : actual)
+        {
+            auto const pos = old_set.find(elem);
+
+            if(pos != old_set.end())
+            {
+                REQUIRE(*pos == elem);
+            }
+        }
+    };
+}
+
+TEST_CASE("flat_set: insert range uses allocator of container")
+{
+    using Element = int;
+    using FlatSet = saga::flat_set<Element, std::less<>, std::pmr::vector<Element>>;
+
+    saga_test::property_checker
+    << [](std::vector<Element> const & src, std::vector<Element> const & extra)
+    {
+        std::vector<std::byte> buffer(16 * (src.size() + extra.size() + 1) * sizeof(Element));
+
+        std::pmr::monotonic_buffer_resource resource(buffer.data(), buffer.size()
+                                                     , std::pmr::null_memory_resource());
+
+        saga::allocation_counter const allocations;
+
+        FlatSet actual{std::pmr::polymorphic_allocator<Element>(&resource)};
+        actual.insert(src.begin(), src.end());
+        actual.insert(extra.begin(), extra.end());
+
+        REQUIRE(allocations.counts().allocations == 0);
+
+        std::set<Element> expected(src.begin(), src.end());
+        expected.insert(extra.begin(), extra.end());
+
+        REQUIRE(saga::equal(saga::cursor::all(actual), saga::cursor::all(expected)));
+    };
+}
+
+TEST_CASE("flat_set: insert range of move-only elements")
+{
+    using Element = std::unique_ptr<int>;
+
+    struct Compare
+    {
+        bool operator()(Element const & lhs, Element const & rhs) const
+        {
+            return *lhs < *rhs;
+        }
+    };
+
+    using FlatSet = saga::flat_set<Element, Compare>;
+
+    FlatSet actual;
+
+    std::vector<Element> extra;
+    for(auto value : {5, 1, 3, 1})
+    {
+        extra.push_back(std::make_unique<int>(value));
+    }
+
+    actual.insert(std::make_move_iterator(extra.begin()), std::make_move_iterator(extra.end()));
+
+    extra.clear();
+    for(auto value : {0, 3, 4, 6})
+    {
+        extra.push_back(std::make_unique<int>(value));
+    }
+
+    actual.insert(std::make_move_iterator(extra.begin()), std::make_move_iterator(extra.end()));
+
+    std::vector<int> values;
+    for(auto const & elem : actual)
+    {
+        values.push_back(*elem);
+    }
+
+    REQUIRE(values == std::vector<int>{0, 1, 3, 4, 5, 6});
+}
+
+// Теоретико-множественные операции
+TEST_CASE("flat_set: includes, intersect, subtract, unite")
+{
+    using Element = int;
+    using Compare = saga_test::strict_weak_order<Element>;
+    using FlatSet = saga::flat_set<Element, Compare>;
+
+    saga_test::property_checker
+    << [](std::vector<Element> const & src1, std::vector<Element> const & src2
+         , Compare const & cmp)
+    {
+        std::set<Element, Compare> const set1(src1.begin(), src1.end(), cmp);
+        std::set<Element, Compare> const set2(src2.begin(), src2.end(), cmp);
+
+        FlatSet const flat1(src1.begin(), src1.end(), cmp, std::allocator<Element>{});
+        FlatSet const flat2(src2.begin(), src2.end(), cmp, std::allocator<Element>{});
+
+        REQUIRE(flat1.includes(flat2)
+                == std::includes(set1.begin(), set1.end(), set2.begin(), set2.end(), cmp));
+        REQUIRE(flat1.includes(flat1));
+
+        // Пересечение
+        {
+            std::vector<Element> expected;
+            std::set_intersection(set1.begin(), set1.end(), set2.begin(), set2.end()
+                                 , std::back_inserter(expected), cmp);
+
+            auto actual = flat1;
+            actual.intersect(flat2);
+
+            REQUIRE(std::equal(actual.begin(), actual.end(), expected.begin(), expected.end()));
+        }
+
+        // Разность
+        {
+            std::vector<Element> expected;
+            std::set_difference(set1.begin(), set1.end(), set2.begin(), set2.end()
+                               , std::back_inserter(expected), cmp);
+
+            auto actual = flat1;
+            actual.subtract(flat2);
+
+            REQUIRE(std::equal(actual.begin(), actual.end(), expected.begin(), expected.end()));
+        }
+
+        // Объединение
+        {
+            std::vector<Element> expected;
+            std::set_union(set1.begin(), set1.end(), set2.begin(), set2.end()
+                          , std::back_inserter(expected), cmp);
+
+            auto actual = flat1;
+            actual.unite(flat2);
+
+            REQUIRE(std::equal(actual.begin(), actual.end(), expected.begin(), expected.end()));
+        }
+    };
+}
+
 static_assert(std::is_same<typename saga::flat_set<char>::key_type, char>{});
 
 static_assert(std::is_same<typename saga::flat_set<int>::key_compare, std::less<int>>{});
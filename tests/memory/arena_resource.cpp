@@ -0,0 +1,202 @@
+/* (c) 2026 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки SAGA.
+
+SAGA -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+// Тестируемый файл
+#include <saga/memory/arena_resource.hpp>
+
+// Инфраструктура тестирования
+#include "../saga_test.hpp"
+#include <catch2/catch_amalgamated.hpp>
+
+// Используемые в тестах возможности
+#include <saga/cursor/subrange.hpp>
+#include <saga/cursor/to.hpp>
+#include <saga/flat_set.hpp>
+
+#include <cstdint>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    /// @brief Ресурс, подсчитывающий обращения к вышестоящему ресурсу
+    class counting_resource
+     : public std::pmr::memory_resource
+    {
+    public:
+        std::size_t allocations = 0;
+        std::size_t deallocations = 0;
+
+    private:
+        void * do_allocate(std::size_t bytes, std::size_t alignment) override
+        {
+            ++ this->allocations;
+
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void * ptr, std::size_t bytes, std::size_t alignment) override
+        {
+            ++ this->deallocations;
+
+            std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+        }
+
+        bool do_is_equal(std::pmr::memory_resource const & other) const noexcept override
+        {
+            return this == &other;
+        }
+    };
+}
+
+// Тесты
+TEST_CASE("arena_resource: alignment and no overlap")
+{
+    saga_test::property_checker
+    << [](std::vector<saga_test::container_size<std::size_t>> const & sizes
+         , std::vector<unsigned> const & alignment_logs)
+    {
+        ::counting_resource upstream;
+        saga::arena_resource arena(64, &upstream);
+
+        REQUIRE(arena.upstream_resource() == &upstream);
+        REQUIRE(arena.capacity() == 0);
+
+        std::vector<std::pair<std::uintptr_t, std::uintptr_t>> blocks;
+
+        for(auto index = std::size_t(0); index < sizes.size(); ++index)
+        {
+            auto const bytes = sizes[index].value + 1;
+            auto const alignment = std::size_t(1) << (alignment_logs.empty()
+                                                      ? 0
+                                                      : alignment_logs[index
+                                                                       % alignment_logs.size()]
+                                                        % 7);
+
+            auto * const ptr = arena.allocate(bytes, alignment);
+            auto const address = reinterpret_cast<std::uintptr_t>(ptr);
+
+            REQUIRE(address % alignment == 0);
+
+            blocks.emplace_back(address, address + bytes);
+        }
+
+        std::sort(blocks.begin(), blocks.end());
+
+        for(auto index = std::size_t(1); index < blocks.size(); ++index)
+        {
+            REQUIRE(blocks[index - 1].second <= blocks[index].first);
+        }
+
+        REQUIRE(arena.used() <= arena.capacity());
+        REQUIRE(upstream.deallocations == 0);
+
+        arena.release();
+
+        REQUIRE(upstream.deallocations == upstream.allocations);
+        REQUIRE(arena.capacity() == 0);
+        REQUIRE(arena.used() == 0);
+    };
+}
+
+TEST_CASE("arena_resource: reset keeps memory")
+{
+    saga_test::property_checker
+    << [](std::vector<std::string> const & src
+         , saga_test::container_size<std::size_t> const & rounds)
+    {
+        ::counting_resource upstream;
+        saga::arena_resource arena(128, &upstream);
+
+        auto const process = [&]
+        {
+            std::pmr::vector<std::pmr::string> strings(&arena);
+
+            for(auto const & str : src)
+            {
+                strings.emplace_back(str);
+            }
+
+            REQUIRE(std::equal(strings.begin(), strings.end(), src.begin(), src.end()
+                              , [](std::pmr::string const & lhs, std::string const & rhs)
+                                { return std::string_view(lhs) == std::string_view(rhs); }));
+        };
+
+        process();
+
+        auto const allocations = upstream.allocations;
+        auto const capacity = arena.capacity();
+
+        for(auto round = rounds.value; round > 0; --round)
+        {
+            arena.reset();
+            REQUIRE(arena.used() == 0);
+
+            process();
+
+            REQUIRE(upstream.allocations == allocations);
+            REQUIRE(arena.capacity() == capacity);
+        }
+
+        REQUIRE(upstream.deallocations == 0);
+    };
+}
+
+TEST_CASE("arena_resource: is_equal")
+{
+    saga::arena_resource arena1;
+    saga::arena_resource arena2;
+
+    REQUIRE(arena1.is_equal(arena1));
+    REQUIRE(!arena1.is_equal(arena2));
+    REQUIRE(std::pmr::polymorphic_allocator<int>(&arena1)
+            != std::pmr::polymorphic_allocator<int>(&arena2));
+}
+
+TEST_CASE("arena_resource: containers and cursor::to")
+{
+    saga_test::property_checker << [](std::vector<int> const & src)
+    {
+        saga::arena_resource arena;
+
+        auto const vec = saga::cursor::to<std::pmr::vector<int>>(saga::cursor::all(src), &arena);
+
+        REQUIRE(vec.get_allocator().resource() == &arena);
+        REQUIRE(saga::equal(saga::cursor::all(vec), saga::cursor::all(src)));
+
+        using Set = saga::flat_set<int, std::less<>, std::pmr::vector<int>>;
+
+        Set set{std::pmr::polymorphic_allocator<int>(&arena)};
+        set.insert(src.begin(), src.end());
+
+        REQUIRE(set.get_allocator().resource() == &arena);
+
+        std::set<int> const expected(src.begin(), src.end());
+        REQUIRE(saga::equal(saga::cursor::all(set), saga::cursor::all(expected)));
+
+        // Вложенные контейнеры получают ресурс внешнего контейнера
+        std::pmr::vector<Set> sets(&arena);
+        sets.emplace_back();
+        sets.push_back(set);
+
+        REQUIRE(sets.front().get_allocator().resource() == &arena);
+        REQUIRE(sets.back().get_allocator().resource() == &arena);
+        REQUIRE(sets.back() == set);
+    };
+}
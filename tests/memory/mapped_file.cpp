@@ -0,0 +1,133 @@
+/* (c) 2026 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки SAGA.
+
+SAGA -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+// Тестируемый файл
+#include <saga/memory/mapped_file.hpp>
+
+// Инфраструктура тестирования
+#include "../saga_test.hpp"
+#include <catch2/catch_amalgamated.hpp>
+
+// Используемые в тестах возможности
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <type_traits>
+
+// Тесты
+static_assert(std::is_nothrow_move_constructible<saga::mapped_file>{}, "");
+static_assert(std::is_nothrow_move_assignable<saga::mapped_file>{}, "");
+static_assert(!std::is_copy_constructible<saga::mapped_file>{}, "");
+static_assert(!std::is_copy_assignable<saga::mapped_file>{}, "");
+
+namespace
+{
+    /// @brief Временный файл с заданным содержимым, удаляемый в деструкторе
+    class temporary_file
+    {
+    public:
+        temporary_file(std::string path, std::string const & content)
+         : path_(std::move(path))
+        {
+            std::ofstream(this->path_, std::ios::binary) << content;
+        }
+
+        ~temporary_file()
+        {
+            std::remove(this->path_.c_str());
+        }
+
+        std::string const & path() const
+        {
+            return this->path_;
+        }
+
+    private:
+        std::string path_;
+    };
+}
+
+TEST_CASE("mapped_file: default constructed")
+{
+    saga::mapped_file const file;
+
+    CHECK(file.empty());
+    CHECK(file.size() == 0);
+    CHECK(file.view().empty());
+    CHECK(file.begin() == file.end());
+}
+
+TEST_CASE("mapped_file: content")
+{
+    saga_test::property_checker << [](std::string const & content)
+    {
+        ::temporary_file const tmp("saga_test_mapped_file.tmp", content);
+
+        saga::mapped_file const file(tmp.path());
+
+        REQUIRE(file.size() == content.size());
+        REQUIRE(file.empty() == content.empty());
+        REQUIRE(file.view() == content);
+        REQUIRE(std::string(file.begin(), file.end()) == content);
+    };
+}
+
+TEST_CASE("mapped_file: data file")
+{
+    auto const path = "ProjectEuler/p099_base_exp.txt";
+
+    std::ifstream input(path, std::ios::binary);
+    REQUIRE(!!input);
+
+    std::string const expected(std::istreambuf_iterator<char>(input), {});
+
+    saga::mapped_file const file(path);
+
+    REQUIRE(!file.empty());
+    REQUIRE(file.view() == expected);
+}
+
+TEST_CASE("mapped_file: move")
+{
+    std::string const content = "192 168 0 1\n";
+    ::temporary_file const tmp("saga_test_mapped_file_move.tmp", content);
+
+    saga::mapped_file file(tmp.path());
+    auto const data = file.data();
+
+    saga::mapped_file other(std::move(file));
+
+    CHECK(file.empty());
+    CHECK(other.data() == data);
+    CHECK(other.view() == content);
+
+    file = std::move(other);
+
+    CHECK(other.empty());
+    CHECK(file.data() == data);
+    CHECK(file.view() == content);
+
+    file = saga::mapped_file();
+
+    CHECK(file.empty());
+}
+
+TEST_CASE("mapped_file: missing file")
+{
+    CHECK_THROWS_AS(saga::mapped_file("saga_test_no_such_file.txt"), std::system_error);
+}
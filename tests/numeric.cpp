@@ -34,6 +34,7 @@ SAGA -- это свободной программное обеспечение:
 #include <saga/utility/functional_macro.hpp>
 
 #include <list>
+#include <memory_resource>
 #include <vector>
 
 // Тесты
@@ -1194,6 +1195,31 @@ TEST_CASE("primes_below: regression #1258")
     CHECK(saga::primes_below(43) == std::vector{2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41});
 }
 
+TEST_CASE("primes_below, euler_phi_below: allocator")
+{
+    saga_test::property_checker << [](saga_test::container_size<int> const & num)
+    {
+        std::pmr::monotonic_buffer_resource resource;
+        std::pmr::polymorphic_allocator<int> const alloc(&resource);
+
+        auto const primes = saga::primes_below(num.value, alloc);
+        static_assert(std::is_same<decltype(primes), std::pmr::vector<int> const>{});
+
+        auto const primes_expected = saga::primes_below(num.value);
+
+        REQUIRE(primes.get_allocator() == alloc);
+        REQUIRE(saga::equal(saga::cursor::all(primes), saga::cursor::all(primes_expected)));
+
+        auto const phi = saga::euler_phi_below(num.value, alloc);
+        static_assert(std::is_same<decltype(phi), std::pmr::vector<int> const>{});
+
+        auto const phi_expected = saga::euler_phi_below(num.value);
+
+        REQUIRE(phi.get_allocator() == alloc);
+        REQUIRE(saga::equal(saga::cursor::all(phi), saga::cursor::all(phi_expected)));
+    };
+}
+
 TEST_CASE("legendre_symbol")
 {
     {
@@ -1266,6 +1292,61 @@ TEST_CASE("sqrt_modulo_prime")
     }
 }
 
+TEST_CASE("sqrt_modulo_prime: 64-bit prime")
+{
+    using IntType = std::uint64_t;
+
+    saga_test::property_checker << [](IntType expected)
+    {
+        auto const prime = (IntType(1) << 62) - 87;
+        auto const mult = saga::multiplies_modulo<IntType>(prime);
+
+        auto const num = mult(expected, expected);
+        auto const actual = saga::sqrt_modulo_prime(num, prime, saga::unsafe_tag_t{});
+
+        CAPTURE(expected, num, actual);
+        REQUIRE(mult(actual, actual) == num);
+        REQUIRE(saga::legendre_symbol(num, prime) == (num == 0 ? 0 : 1));
+    };
+}
+
+TEST_CASE("multiplies_modulo: no overflow")
+{
+    saga_test::property_checker << [](std::uint64_t lhs, std::uint64_t rhs, std::uint64_t mod
+                                      , std::int32_t lhs_32, std::int32_t rhs_32)
+    {
+        if(mod == 0)
+        {
+            return;
+        }
+
+        // Умножение "в столбик" со сложением по модулю без переполнения
+        auto const add_modulo = [mod](std::uint64_t x, std::uint64_t y)
+        {
+            return (x >= mod - y) ? x - (mod - y) : x + y;
+        };
+
+        auto expected = std::uint64_t(0);
+
+        for(auto bit = 64; bit > 0; --bit)
+        {
+            expected = add_modulo(expected, expected);
+
+            if((rhs >> (bit - 1)) & 1)
+            {
+                expected = add_modulo(expected, lhs % mod);
+            }
+        }
+
+        REQUIRE(saga::multiplies_modulo<std::uint64_t>(mod)(lhs, rhs) == expected);
+
+        auto const mod_32 = std::int32_t(mod % 2'000'000'000 + 1);
+
+        REQUIRE(saga::multiplies_modulo<std::int32_t>(mod_32)(lhs_32, rhs_32)
+                == std::int64_t(lhs_32) * rhs_32 % mod_32);
+    };
+}
+
 TEST_CASE("inverses modulo prime")
 {
     using IntType = long;
@@ -1357,3 +1438,77 @@ TEST_CASE("divisor_sums_below")
         REQUIRE(divisor_sums[num] == aliquotes[num] + num);
     }
 }
+
+TEST_CASE("lucy_prime_count, lucy_prime_sum: small")
+{
+    auto const num_end = saga_test::random_uniform(1u, 20'000u);
+
+    auto const primes = saga::primes_below(num_end);
+
+    auto count = 0LL;
+    auto sum = 0LL;
+    auto pos = primes.begin();
+
+    for(auto num = 0LL; num < num_end; ++num)
+    {
+        for(; pos != primes.end() && *pos <= num; ++pos)
+        {
+            ++count;
+            sum += *pos;
+        }
+
+        CAPTURE(num);
+        REQUIRE(saga::lucy_prime_count(num) == count);
+        REQUIRE(saga::lucy_prime_sum(num) == sum);
+    }
+}
+
+TEST_CASE("lucy_prime_count, lucy_prime_sum: known values")
+{
+    CHECK(saga::lucy_prime_count(-5) == 0);
+    CHECK(saga::lucy_prime_count(std::uint64_t(1'000'000'000)) == 50'847'534);
+    CHECK(saga::lucy_prime_count(std::uint64_t(10'000'000'000)) == 455'052'511);
+
+    // PE 10
+    CHECK(saga::lucy_prime_sum(std::uint64_t(2'000'000)) == 142'913'828'922);
+
+    // Промежуточные суммы здесь не помещаются в std::int64_t, а итоговая -- помещается
+    CHECK(saga::lucy_prime_sum(std::int64_t(10'000'000'000)) == 2'220'822'432'581'729'238);
+    CHECK(saga::lucy_prime_sum(std::uint64_t(10'000'000'000)) == 2'220'822'432'581'729'238u);
+}
+
+TEST_CASE("mertens, euler_phi_sum: small")
+{
+    auto const num_end = saga_test::random_uniform(1u, 20'000u);
+
+    auto const mu = saga::linear_sieve<>(num_end, saga::linear_sieve_tables::moebius).moebius();
+    auto const phi = saga::euler_phi_below(num_end);
+
+    auto mertens = 0LL;
+    auto phi_sum = 0ULL;
+
+    for(auto num = 0u; num < num_end; ++num)
+    {
+        mertens += mu[num];
+        phi_sum += phi[num];
+
+        CAPTURE(num);
+        REQUIRE(saga::mertens(num) == mertens);
+        REQUIRE(saga::euler_phi_sum(std::uint64_t(num)) == phi_sum);
+    }
+}
+
+TEST_CASE("mertens, euler_phi_sum: known values")
+{
+    CHECK(saga::mertens(0) == 0);
+    CHECK(saga::mertens(1'000'000) == 212);
+    CHECK(saga::mertens(10'000'000) == 1037);
+    CHECK(saga::mertens(std::int64_t(1'000'000'000)) == -222);
+
+    // PE 72: количество несократимых дробей со знаменателем не больше 10^6
+    CHECK(saga::euler_phi_sum(std::int64_t(1'000'000)) - 1 == 303'963'552'391);
+
+    // num (num + 1) / 2 здесь не помещается в std::int64_t, а итоговая сумма -- помещается
+    CHECK(saga::euler_phi_sum(std::int64_t(4'500'000'000)) == 6'155'261'907'022'466'840);
+    CHECK(saga::euler_phi_sum(std::uint64_t(7'000'000'000)) == 14'894'213'996'277'344'636u);
+}
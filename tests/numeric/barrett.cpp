@@ -0,0 +1,93 @@
+/* (c) 2026 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки SAGA.
+
+SAGA -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+// Тестируемый файл
+#include <saga/numeric/barrett.hpp>
+
+// Инфраструктура тестирования
+#include "../saga_test.hpp"
+#include <catch2/catch_amalgamated.hpp>
+
+// Вспомогательные файлы
+#include <cstdint>
+
+// Тесты
+TEST_CASE("barrett_32: reduce")
+{
+    saga_test::property_checker << [](std::uint32_t mod, std::uint64_t num)
+    {
+        if(mod < 2)
+        {
+            return;
+        }
+
+        auto const barrett = saga::barrett_32(mod);
+
+        REQUIRE(barrett.modulus() == mod);
+        REQUIRE(barrett.reduce(num) == num % mod);
+        REQUIRE(barrett.reduce(std::uint64_t(-1)) == std::uint64_t(-1) % mod);
+        REQUIRE(barrett.reduce(0) == 0);
+    };
+
+    for(auto shift = 1; shift < 32; ++shift)
+    {
+        auto const mod = std::uint32_t(1) << shift;
+        auto const barrett = saga::barrett_32(mod);
+
+        CAPTURE(mod);
+        REQUIRE(barrett.reduce(std::uint64_t(-1)) == mod - 1);
+        REQUIRE(barrett.reduce(std::uint64_t(mod) * mod) == 0);
+    }
+}
+
+TEST_CASE("barrett_32: multiply, add, subtract, power")
+{
+    saga_test::property_checker << [](std::uint32_t mod, std::uint32_t a, std::uint32_t b
+                                      , std::uint16_t exponent)
+    {
+        if(mod < 2)
+        {
+            return;
+        }
+
+        auto const barrett = saga::barrett_32(mod);
+
+        auto const lhs = a % mod;
+        auto const rhs = b % mod;
+
+        REQUIRE(barrett.multiply(lhs, rhs) == std::uint64_t(lhs) * rhs % mod);
+        REQUIRE(barrett.add(lhs, rhs) == (std::uint64_t(lhs) + rhs) % mod);
+        REQUIRE(barrett.add(barrett.subtract(lhs, rhs), rhs) == lhs);
+        REQUIRE(barrett.add(barrett.negate(lhs), lhs) == 0);
+
+        auto expected = std::uint64_t(1) % mod;
+        for(auto index = 0; index < exponent; ++index)
+        {
+            expected = expected * lhs % mod;
+        }
+
+        REQUIRE(barrett.power(lhs, exponent) == expected);
+    };
+}
+
+TEST_CASE("barrett_32: constexpr")
+{
+    constexpr auto barrett = saga::barrett_32(1'000'000'007);
+
+    static_assert(barrett.reduce(std::uint64_t(1) << 40) == 511'620'083);
+    static_assert(barrett.power(2, 1'000'000'006) == 1);
+}
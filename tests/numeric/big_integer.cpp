@@ -0,0 +1,331 @@
+/* (c) 2026 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки SAGA.
+
+SAGA -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+// Тестируемый файл
+#include <saga/numeric/big_integer.hpp>
+
+// Инфраструктура тестирования
+#include "../saga_test.hpp"
+#include <catch2/catch_amalgamated.hpp>
+
+// Вспомогательные файлы
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Тесты
+namespace
+{
+    __extension__ typedef __int128 int128_type;
+    __extension__ typedef unsigned __int128 uint128_type;
+
+    std::string to_string_128(int128_type value)
+    {
+        auto const negative = (value < 0);
+        auto magnitude = negative ? -static_cast<uint128_type>(value)
+                                  : static_cast<uint128_type>(value);
+
+        std::string result;
+
+        do
+        {
+            result.push_back(static_cast<char>('0' + static_cast<int>(magnitude % 10)));
+            magnitude /= 10;
+        }
+        while(magnitude > 0);
+
+        if(negative)
+        {
+            result.push_back('-');
+        }
+
+        return std::string(result.rbegin(), result.rend());
+    }
+
+    std::vector<std::uint64_t> random_limbs(std::size_t num)
+    {
+        std::vector<std::uint64_t> result(num);
+
+        for(auto & limb : result)
+        {
+            limb = saga_test::random_engine()();
+        }
+
+        return result;
+    }
+
+    saga::big_integer random_big_integer(std::size_t digits)
+    {
+        std::string str(digits, '0');
+
+        for(auto & digit : str)
+        {
+            digit = static_cast<char>('0' + saga_test::random_uniform(0, 9));
+        }
+
+        str.front() = static_cast<char>('1' + saga_test::random_uniform(0, 8));
+
+        return saga::big_integer(str);
+    }
+}
+
+TEST_CASE("big_integer: default and zero")
+{
+    saga::big_integer const zero{};
+
+    CHECK(!zero);
+    CHECK(!zero.is_negative());
+    CHECK(zero.limbs().empty());
+    CHECK(zero.bit_width() == 0);
+    CHECK(zero.to_string() == "0");
+    CHECK(zero == saga::big_integer(0));
+    CHECK(zero == saga::big_integer("-0"));
+    CHECK(-zero == zero);
+    CHECK(!(-zero).is_negative());
+}
+
+TEST_CASE("big_integer: from integral, to_string")
+{
+    saga_test::property_checker << [](std::int64_t value, std::uint64_t unsigned_value)
+    {
+        saga::big_integer const num(value);
+
+        REQUIRE(num.to_string() == std::to_string(value));
+        REQUIRE(num.is_negative() == (value < 0));
+        REQUIRE(static_cast<bool>(num) == (value != 0));
+        REQUIRE(saga::big_integer(std::to_string(value)) == num);
+
+        REQUIRE(saga::big_integer(unsigned_value).to_string() == std::to_string(unsigned_value));
+    };
+
+    CHECK(saga::big_integer(INT64_MIN).to_string() == "-9223372036854775808");
+    CHECK(saga::big_integer("+123") == 123);
+    CHECK(saga::big_integer("000123") == 123);
+}
+
+TEST_CASE("big_integer: ostream")
+{
+    saga_test::property_checker << [](std::int64_t value)
+    {
+        std::ostringstream os;
+        os << saga::big_integer(value);
+
+        REQUIRE(os.str() == std::to_string(value));
+    };
+}
+
+TEST_CASE("big_integer: invalid strings")
+{
+    CHECK_THROWS_AS(saga::big_integer(""), std::invalid_argument);
+    CHECK_THROWS_AS(saga::big_integer("-"), std::invalid_argument);
+    CHECK_THROWS_AS(saga::big_integer("12a3"), std::invalid_argument);
+    CHECK_THROWS_AS(saga::big_integer(" 1"), std::invalid_argument);
+    CHECK_THROWS_AS(saga::big_integer("--1"), std::invalid_argument);
+}
+
+TEST_CASE("big_integer: arithmetic is consistent with __int128")
+{
+    saga_test::property_checker << [](std::int64_t lhs, std::int64_t rhs)
+    {
+        saga::big_integer const a(lhs);
+        saga::big_integer const b(rhs);
+
+        auto const lhs_128 = static_cast<int128_type>(lhs);
+        auto const rhs_128 = static_cast<int128_type>(rhs);
+
+        REQUIRE((a + b).to_string() == to_string_128(lhs_128 + rhs_128));
+        REQUIRE((a - b).to_string() == to_string_128(lhs_128 - rhs_128));
+        REQUIRE((a * b).to_string() == to_string_128(lhs_128 * rhs_128));
+        REQUIRE((a * rhs).to_string() == to_string_128(lhs_128 * rhs_128));
+        REQUIRE((lhs * b).to_string() == to_string_128(lhs_128 * rhs_128));
+
+        REQUIRE((a < b) == (lhs < rhs));
+        REQUIRE((a == b) == (lhs == rhs));
+        REQUIRE((a >= b) == (lhs >= rhs));
+
+        if(rhs != 0)
+        {
+            REQUIRE((a / b).to_string() == to_string_128(lhs_128 / rhs_128));
+            REQUIRE((a % b).to_string() == to_string_128(lhs_128 % rhs_128));
+        }
+    };
+}
+
+TEST_CASE("big_integer: shifts")
+{
+    saga_test::property_checker << [](std::uint64_t value, std::uint8_t shift)
+    {
+        saga::big_integer const num(value);
+
+        auto shifted = num << shift;
+
+        auto expected = num;
+        for(auto index = 0; index < shift; ++index)
+        {
+            expected *= 2;
+        }
+
+        REQUIRE(shifted == expected);
+        REQUIRE((shifted >> shift) == num);
+        REQUIRE((num >> (shift % 64)) == (value >> (shift % 64)));
+    };
+}
+
+TEST_CASE("big_integer: multiplication algorithms agree")
+{
+    for(auto num : {1, 5, 31, 32, 33, 100, 257, 1000, 2100})
+    {
+        CAPTURE(num);
+
+        auto const lhs = random_limbs(num);
+        auto const rhs = random_limbs(num);
+
+        std::vector<std::uint64_t> expected(2 * num);
+        saga::detail::limbs_mul_basecase(expected.data(), lhs.data(), num, rhs.data(), num);
+
+        std::vector<std::uint64_t> scratch(saga::detail::karatsuba_scratch_size(num));
+        std::vector<std::uint64_t> karatsuba(2 * num);
+        saga::detail::limbs_mul_karatsuba(karatsuba.data(), lhs.data(), rhs.data(), num
+                                         , scratch.data());
+        REQUIRE(karatsuba == expected);
+
+        std::vector<std::uint64_t> ntt(2 * num);
+        saga::detail::limbs_mul_ntt(ntt.data(), lhs.data(), num, rhs.data(), num);
+        REQUIRE(ntt == expected);
+
+        std::vector<std::uint64_t> dispatched(2 * num);
+        saga::detail::limbs_multiply(dispatched.data(), lhs.data(), num, rhs.data(), num);
+        REQUIRE(dispatched == expected);
+
+        saga::detail::limbs_mul_basecase(expected.data(), lhs.data(), num, lhs.data(), num);
+        saga::detail::limbs_mul_ntt(ntt.data(), lhs.data(), num, lhs.data(), num);
+        REQUIRE(ntt == expected);
+    }
+}
+
+TEST_CASE("big_integer: unbalanced multiplication")
+{
+    for(auto sizes : {std::pair<int, int>(3, 500), std::pair<int, int>(40, 3000)
+                     , std::pair<int, int>(2500, 2100)})
+    {
+        CAPTURE(sizes.first, sizes.second);
+
+        auto const lhs = random_limbs(sizes.first);
+        auto const rhs = random_limbs(sizes.second);
+        auto const size = lhs.size() + rhs.size();
+
+        std::vector<std::uint64_t> expected(size);
+        saga::detail::limbs_mul_basecase(expected.data(), rhs.data(), rhs.size()
+                                        , lhs.data(), lhs.size());
+
+        std::vector<std::uint64_t> actual(size);
+        saga::detail::limbs_multiply(actual.data(), lhs.data(), lhs.size()
+                                    , rhs.data(), rhs.size());
+
+        REQUIRE(actual == expected);
+    }
+}
+
+TEST_CASE("big_integer: division identity")
+{
+    for(auto digits : {std::pair<int, int>(30, 10), std::pair<int, int>(400, 150)
+                      , std::pair<int, int>(3000, 1400), std::pair<int, int>(20000, 5000)
+                      , std::pair<int, int>(5000, 5000), std::pair<int, int>(10, 300)})
+    {
+        CAPTURE(digits.first, digits.second);
+
+        auto const lhs = random_big_integer(digits.first);
+        auto const rhs = random_big_integer(digits.second);
+
+        for(auto const & dividend : {lhs, -lhs})
+        {
+            for(auto const & divisor : {rhs, -rhs})
+            {
+                auto const quotient = dividend / divisor;
+                auto const remainder = dividend % divisor;
+
+                REQUIRE(quotient * divisor + remainder == dividend);
+                REQUIRE((remainder < 0 ? -remainder : remainder)
+                        < (divisor < 0 ? -divisor : divisor));
+                REQUIRE((!remainder || remainder.is_negative() == dividend.is_negative()));
+            }
+        }
+    }
+}
+
+TEST_CASE("big_integer: decimal round trip")
+{
+    for(auto digits : {1, 19, 20, 40, 600, 5000, 30000})
+    {
+        CAPTURE(digits);
+
+        auto const num = random_big_integer(digits);
+        auto const str = num.to_string();
+
+        REQUIRE(str.size() == static_cast<std::size_t>(digits));
+        REQUIRE(saga::big_integer(str) == num);
+        REQUIRE(saga::big_integer("-" + str) == -num);
+        REQUIRE((-num).to_string() == "-" + str);
+    }
+
+    auto const power = saga::big_integer("1" + std::string(1000, '0'));
+    CHECK((power - 1).to_string() == std::string(1000, '9'));
+    CHECK((power + 1).to_string() == "1" + std::string(999, '0') + "1");
+}
+
+TEST_CASE("big_integer: in-place operations")
+{
+    auto const lhs = random_big_integer(500);
+    auto const rhs = random_big_integer(200);
+
+    auto value = lhs;
+    value += rhs;
+    CHECK(value == lhs + rhs);
+    value -= rhs;
+    CHECK(value == lhs);
+    value *= rhs;
+    CHECK(value == lhs * rhs);
+    value /= rhs;
+    CHECK(value == lhs);
+    value %= rhs;
+    CHECK(value == lhs % rhs);
+
+    value = lhs;
+    value -= value;
+    CHECK(!value);
+
+    value = lhs;
+    value += value;
+    CHECK(value == lhs * 2);
+}
+
+TEST_CASE("big_factorial")
+{
+    CHECK(saga::big_factorial(0) == 1);
+    CHECK(saga::big_factorial(1) == 1);
+    CHECK(saga::big_factorial(20) == 2'432'902'008'176'640'000);
+    CHECK(saga::big_factorial(30).to_string() == "265252859812191058636308480000000");
+
+    auto expected = saga::big_integer(1);
+    for(auto num = 2; num <= 300; ++num)
+    {
+        expected *= num;
+    }
+
+    CHECK(saga::big_factorial(300) == expected);
+}
@@ -0,0 +1,109 @@
+/* (c) 2026 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки SAGA.
+
+SAGA -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+// Тестируемый файл
+#include <saga/numeric/factorize.hpp>
+
+// Инфраструктура тестирования
+#include "../saga_test.hpp"
+#include <catch2/catch_amalgamated.hpp>
+
+// Вспомогательные файлы
+#include <saga/numeric.hpp>
+
+#include <cstdint>
+
+// Тесты
+namespace
+{
+    template <class IntType>
+    void check_factorization(IntType num, std::vector<saga::prime_power<IntType>> const & factors)
+    {
+        auto product = IntType(1);
+
+        for(auto index = std::size_t(0); index < factors.size(); ++index)
+        {
+            REQUIRE(saga::is_prime(factors[index].prime));
+            REQUIRE(factors[index].exponent > 0);
+
+            if(index > 0)
+            {
+                REQUIRE(factors[index - 1].prime < factors[index].prime);
+            }
+
+            for(auto power = IntType(0); power < factors[index].exponent; ++power)
+            {
+                product *= factors[index].prime;
+            }
+        }
+
+        REQUIRE(product == num);
+    }
+}
+
+TEST_CASE("factorize: small numbers agree with first factors table")
+{
+    auto const n_max = 100'000;
+    auto const first_factors = saga::first_factors_below(n_max);
+
+    for(auto num = 1; num < n_max; ++num)
+    {
+        auto const factors = saga::factorize(num);
+
+        check_factorization(num, factors);
+
+        if(num > 1)
+        {
+            REQUIRE(factors.front().prime == first_factors[num]);
+        }
+    }
+}
+
+TEST_CASE("factorize: random 64-bit numbers")
+{
+    saga_test::property_checker << [](std::uint32_t high, std::uint32_t low)
+    {
+        auto const num = (std::uint64_t(high) << 32) | low;
+
+        if(num == 0)
+        {
+            return;
+        }
+
+        check_factorization(num, saga::factorize(num));
+    };
+}
+
+TEST_CASE("factorize: products of large primes")
+{
+    using Factors = std::vector<saga::prime_power<std::uint64_t>>;
+
+    auto const p1 = std::uint64_t(4'294'967'291);
+    auto const p2 = std::uint64_t(4'294'967'279);
+
+    CHECK(saga::factorize(p1 * p2) == Factors{{p2, 1}, {p1, 1}});
+    CHECK(saga::factorize(p1 * p1) == Factors{{p1, 2}});
+    CHECK(saga::factorize(std::uint64_t(1'000'003) * 1'000'003 * 1'000'033)
+          == Factors{{1'000'003, 2}, {1'000'033, 1}});
+    CHECK(saga::factorize(std::uint64_t(18'446'744'073'709'551'557u))
+          == Factors{{18'446'744'073'709'551'557u, 1}});
+    CHECK(saga::factorize(std::uint64_t(1) << 63) == Factors{{2, 63}});
+
+    CHECK(saga::factorize(std::int64_t(600'851'475'143))
+          == std::vector<saga::prime_power<std::int64_t>>{{71, 1}, {839, 1}, {1471, 1}
+                                                          , {6857, 1}});
+}
@@ -31,3 +31,60 @@ TEST_CASE("is_prime_sorted : 1 is not prime - regression 1350")
 
     REQUIRE(saga::is_prime_sorted(1, primes, saga::unsafe_tag_t{}) == false);
 }
+
+#include "../saga_test.hpp"
+
+#include <cstdint>
+
+TEST_CASE("is_prime : agrees with sieve")
+{
+    auto const n_max = 200'000;
+    auto const primes = saga::primes_below(n_max);
+
+    std::vector<bool> expected(n_max, false);
+    for(auto const & prime : primes)
+    {
+        expected[prime] = true;
+    }
+
+    for(auto num = -5; num < n_max; ++num)
+    {
+        CAPTURE(num);
+        REQUIRE(saga::is_prime(num) == (num >= 0 && expected[num]));
+    }
+}
+
+TEST_CASE("is_prime : agrees with is_prime_sorted")
+{
+    saga_test::property_checker << [](std::uint32_t num)
+    {
+        static auto const primes = saga::primes_below(std::uint64_t(1) << 20);
+
+        auto const value = std::uint64_t(num) * 257 + 1;
+
+        REQUIRE(saga::is_prime(value)
+                == saga::is_prime_sorted(value, primes, saga::unsafe_tag_t{}));
+    };
+}
+
+TEST_CASE("is_prime : strong pseudoprimes and large numbers")
+{
+    // Сильные псевдопростые по нескольким первым простым основаниям
+    CHECK(!saga::is_prime(std::uint64_t(3'215'031'751)));
+    CHECK(!saga::is_prime(std::uint64_t(2'152'302'898'747)));
+    CHECK(!saga::is_prime(std::uint64_t(3'474'749'660'383)));
+    CHECK(!saga::is_prime(std::uint64_t(341'550'071'728'321)));
+    CHECK(!saga::is_prime(std::uint64_t(3'825'123'056'546'413'051)));
+
+    // Числа Кармайкла
+    CHECK(!saga::is_prime(561));
+    CHECK(!saga::is_prime(41'041));
+    CHECK(!saga::is_prime(std::uint64_t(9'999'109'081)));
+
+    CHECK(saga::is_prime(std::uint64_t(2'305'843'009'213'693'951)));
+    CHECK(saga::is_prime(std::uint64_t(18'446'744'073'709'551'557u)));
+    CHECK(!saga::is_prime(std::uint64_t(18'446'744'073'709'551'559u)));
+    CHECK(!saga::is_prime(std::uint64_t(4'294'967'291) * 4'294'967'279));
+    CHECK(!saga::is_prime(std::uint64_t(4'294'967'291) * 4'294'967'291));
+    CHECK(saga::is_prime(std::int64_t(9'223'372'036'854'775'783)));
+}
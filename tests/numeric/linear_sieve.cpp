@@ -0,0 +1,196 @@
+/* (c) 2026 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки SAGA.
+
+SAGA -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+// Тестируемый файл
+#include <saga/numeric/linear_sieve.hpp>
+
+// Инфраструктура тестирования
+#include "../saga_test.hpp"
+#include <catch2/catch_amalgamated.hpp>
+
+// Вспомогательные файлы
+#include <saga/numeric.hpp>
+
+#include <cstdint>
+#include <numeric>
+
+// Тесты
+namespace
+{
+    // Наивные реализации по определению
+    std::uint32_t smallest_prime_factor_naive(std::uint32_t num)
+    {
+        for(auto divisor = std::uint32_t(2); divisor * divisor <= num; ++divisor)
+        {
+            if(num % divisor == 0)
+            {
+                return divisor;
+            }
+        }
+
+        return num;
+    }
+
+    std::uint32_t euler_phi_naive(std::uint32_t num)
+    {
+        auto result = std::uint32_t(0);
+
+        for(auto k = std::uint32_t(1); k <= num; ++k)
+        {
+            result += (std::gcd(k, num) == 1);
+        }
+
+        return result;
+    }
+
+    int moebius_naive(std::uint32_t num)
+    {
+        auto result = 1;
+
+        for(auto divisor = std::uint32_t(2); num > 1; ++divisor)
+        {
+            if(num % divisor == 0)
+            {
+                num /= divisor;
+
+                if(num % divisor == 0)
+                {
+                    return 0;
+                }
+
+                result = -result;
+            }
+        }
+
+        return result;
+    }
+
+    template <class Function>
+    void for_each_divisor(std::uint32_t num, Function fun)
+    {
+        for(auto divisor = std::uint32_t(1); divisor <= num; ++divisor)
+        {
+            if(num % divisor == 0)
+            {
+                fun(divisor);
+            }
+        }
+    }
+}
+
+TEST_CASE("linear_sieve: all tables")
+{
+    auto const n_max = std::size_t(2000);
+
+    saga::linear_sieve<> const sieve(n_max, saga::linear_sieve_tables::all);
+
+    REQUIRE(sieve.smallest_prime_factors().size() == n_max);
+    REQUIRE(sieve.euler_phi().size() == n_max);
+    REQUIRE(sieve.moebius().size() == n_max);
+    REQUIRE(sieve.divisor_counts().size() == n_max);
+    REQUIRE(sieve.divisor_sums().size() == n_max);
+
+    CHECK(sieve.smallest_prime_factors()[0] == 0);
+    CHECK(sieve.smallest_prime_factors()[1] == 1);
+    CHECK(sieve.euler_phi()[0] == 0);
+    CHECK(sieve.euler_phi()[1] == 1);
+    CHECK(sieve.moebius()[0] == 0);
+    CHECK(sieve.moebius()[1] == 1);
+    CHECK(sieve.divisor_counts()[0] == 0);
+    CHECK(sieve.divisor_counts()[1] == 1);
+    CHECK(sieve.divisor_sums()[0] == 0);
+    CHECK(sieve.divisor_sums()[1] == 1);
+
+    std::vector<std::uint32_t> primes_expected;
+
+    for(auto num = std::uint32_t(2); num < n_max; ++num)
+    {
+        CAPTURE(num);
+
+        if(smallest_prime_factor_naive(num) == num)
+        {
+            primes_expected.push_back(num);
+        }
+
+        auto d_count = std::uint32_t(0);
+        auto d_sum = std::uint64_t(0);
+        for_each_divisor(num, [&](std::uint32_t divisor) { ++d_count; d_sum += divisor; });
+
+        REQUIRE(sieve.smallest_prime_factors()[num] == smallest_prime_factor_naive(num));
+        REQUIRE(sieve.euler_phi()[num] == euler_phi_naive(num));
+        REQUIRE(sieve.moebius()[num] == moebius_naive(num));
+        REQUIRE(sieve.divisor_counts()[num] == d_count);
+        REQUIRE(sieve.divisor_sums()[num] == d_sum);
+    }
+
+    REQUIRE(sieve.primes() == primes_expected);
+}
+
+TEST_CASE("linear_sieve: only requested tables are kept")
+{
+    auto const n_max = std::size_t(1000);
+
+    saga::linear_sieve<std::uint64_t> const sieve(n_max, saga::linear_sieve_tables::moebius);
+
+    CHECK(sieve.smallest_prime_factors().empty());
+    CHECK(sieve.euler_phi().empty());
+    CHECK(sieve.divisor_counts().empty());
+    CHECK(sieve.divisor_sums().empty());
+
+    REQUIRE(sieve.moebius().size() == n_max);
+    REQUIRE(sieve.primes() == saga::primes_below(std::uint64_t(n_max)));
+
+    for(auto num = std::uint32_t(1); num < n_max; ++num)
+    {
+        CAPTURE(num);
+        REQUIRE(sieve.moebius()[num] == moebius_naive(num));
+    }
+}
+
+TEST_CASE("linear_sieve: small bounds")
+{
+    for(auto n_max = std::size_t(0); n_max < 4; ++n_max)
+    {
+        CAPTURE(n_max);
+
+        saga::linear_sieve<> const sieve(n_max, saga::linear_sieve_tables::all);
+
+        CHECK(sieve.smallest_prime_factors().size() == n_max);
+        CHECK(sieve.euler_phi().size() == n_max);
+        CHECK(sieve.primes().size() == (n_max > 2 ? 1u : 0u));
+    }
+}
+
+TEST_CASE("euler_phi_below: linear sieve")
+{
+    saga_test::property_checker << [](saga_test::container_size<std::uint16_t> const & n_max)
+    {
+        auto const phi = saga::euler_phi_below(n_max.value);
+
+        REQUIRE(phi.size() == n_max.value);
+
+        for(auto num = std::uint16_t(1); num < n_max.value; ++num)
+        {
+            REQUIRE(phi[num] == euler_phi_naive(num));
+        }
+
+        if(n_max.value > 0)
+        {
+            REQUIRE(phi[0] == 0);
+        }
+    };
+}
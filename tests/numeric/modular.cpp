@@ -0,0 +1,331 @@
+/* (c) 2026 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки SAGA.
+
+SAGA -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+// Тестируемый файл
+#include <saga/numeric/modular.hpp>
+
+// Инфраструктура тестирования
+#include "../saga_test.hpp"
+#include <catch2/catch_amalgamated.hpp>
+
+// Вспомогательные файлы
+#include <saga/cursor/subrange.hpp>
+#include <saga/iterator.hpp>
+#include <saga/numeric.hpp>
+
+#include <cstdint>
+#include <numeric>
+#include <sstream>
+#include <vector>
+
+// Тесты
+namespace
+{
+    __extension__ typedef unsigned __int128 uint128_type;
+
+    std::uint64_t multiply_modulo_wide(std::uint64_t lhs, std::uint64_t rhs, std::uint64_t mod)
+    {
+        return static_cast<std::uint64_t>(uint128_type(lhs) * rhs % mod);
+    }
+
+    std::uint64_t power_modulo_wide(std::uint64_t base, std::uint64_t exponent
+                                    , std::uint64_t mod)
+    {
+        auto result = std::uint64_t(1) % mod;
+
+        for(; exponent > 0; --exponent)
+        {
+            result = multiply_modulo_wide(result, base, mod);
+        }
+
+        return result;
+    }
+
+    template <class Modular>
+    void check_modular_arithmetic(std::uint64_t a, std::uint64_t b, std::uint16_t exponent)
+    {
+        auto const mod = Modular::modulus();
+
+        Modular const lhs(a);
+        Modular const rhs(b);
+
+        REQUIRE(lhs.value() == a % mod);
+        REQUIRE((lhs + rhs).value() == (uint128_type(a % mod) + b % mod) % mod);
+        REQUIRE((lhs - rhs + rhs) == lhs);
+        REQUIRE((lhs * rhs).value() == multiply_modulo_wide(a % mod, b % mod, mod));
+        REQUIRE((-lhs + lhs) == Modular(0));
+        REQUIRE(lhs.power(exponent).value() == power_modulo_wide(a % mod, exponent, mod));
+
+        if(std::gcd(b % mod, mod) == 1)
+        {
+            REQUIRE((rhs * rhs.inverse()) == Modular(1));
+            REQUIRE((lhs / rhs * rhs) == lhs);
+        }
+
+        auto value = lhs;
+        value += rhs;
+        REQUIRE(value == lhs + rhs);
+        value -= rhs;
+        REQUIRE(value == lhs);
+        value *= rhs;
+        REQUIRE(value == lhs * rhs);
+    }
+
+    struct runtime_odd_tag {};
+    struct runtime_small_tag {};
+}
+
+TEST_CASE("modular_integer: static modulus")
+{
+    saga_test::property_checker << [](std::uint64_t a, std::uint64_t b, std::uint8_t exponent)
+    {
+        check_modular_arithmetic<saga::static_modular_integer<1'000'000'007>>(a, b, exponent);
+        check_modular_arithmetic<saga::static_modular_integer<998'244'353>>(a, b, exponent);
+        check_modular_arithmetic<saga::static_modular_integer<1'000'000>>(a, b, exponent);
+        check_modular_arithmetic<saga::static_modular_integer<(std::uint64_t(1) << 61) - 1>>
+            (a, b, exponent);
+        check_modular_arithmetic<saga::static_modular_integer<18'446'744'073'709'551'557u>>
+            (a, b, exponent);
+    };
+}
+
+TEST_CASE("modular_integer: runtime modulus")
+{
+    saga_test::property_checker << [](std::uint64_t mod, std::uint32_t small_mod
+                                      , std::uint64_t a, std::uint64_t b, std::uint8_t exponent)
+    {
+        mod |= 1;
+
+        if(mod > 1)
+        {
+            saga::runtime_modulus<runtime_odd_tag>::set_modulus(mod);
+
+            using Modular = saga::modular_integer<saga::runtime_modulus<runtime_odd_tag>>;
+
+            REQUIRE(Modular::modulus() == mod);
+            check_modular_arithmetic<Modular>(a, b, exponent);
+        }
+
+        if(small_mod > 1)
+        {
+            using Modulus = saga::runtime_modulus<runtime_small_tag, saga::barrett_32>;
+
+            Modulus::set_modulus(small_mod);
+
+            using Modular = saga::modular_integer<Modulus>;
+
+            REQUIRE(Modular::modulus() == small_mod);
+            check_modular_arithmetic<Modular>(a, b, exponent);
+        }
+    };
+}
+
+TEST_CASE("modular_integer: negative numbers, output, constexpr")
+{
+    using Modular = saga::static_modular_integer<97>;
+
+    saga_test::property_checker << [](std::int64_t num)
+    {
+        auto const expected = (num % 97 + 97) % 97;
+
+        REQUIRE(Modular(num).value() == static_cast<std::uint64_t>(expected));
+
+        std::ostringstream os;
+        os << Modular(num);
+
+        REQUIRE(os.str() == std::to_string(expected));
+    };
+
+    static_assert(Modular(-1).value() == 96);
+    static_assert(Modular(3).power(96) == Modular(1));
+    static_assert((Modular(5) / Modular(7) * Modular(7)) == Modular(5));
+
+    using Wide = saga::static_modular_integer<(std::uint64_t(1) << 61) - 1>;
+
+    static_assert(Wide(2).power(61) == Wide(1));
+}
+
+TEST_CASE("modular_integer: power_natural")
+{
+    using Modular = saga::static_modular_integer<1'000'000'007>;
+
+    saga_test::property_checker << [](std::uint64_t base, std::uint32_t exponent)
+    {
+        if(exponent == 0)
+        {
+            return;
+        }
+
+        REQUIRE(saga::power_natural(Modular(base), exponent) == Modular(base).power(exponent));
+    };
+}
+
+TEST_CASE("modular_inverses")
+{
+    using Modular = saga::static_modular_integer<1'000'000'007>;
+
+    saga_test::property_checker << [](std::vector<std::uint32_t> const & values)
+    {
+        std::vector<Modular> original;
+
+        for(auto const & value : values)
+        {
+            if(value % Modular::modulus() != 0)
+            {
+                original.emplace_back(value);
+            }
+        }
+
+        std::vector<Modular> inverses;
+
+        auto const result = saga::modular_inverses(saga::cursor::all(original)
+                                                   , saga::back_inserter(inverses));
+
+        REQUIRE(!result.in);
+        REQUIRE(inverses.size() == original.size());
+
+        for(auto index = std::size_t(0); index < inverses.size(); ++index)
+        {
+            REQUIRE(inverses[index] == original[index].inverse());
+        }
+    };
+}
+
+TEST_CASE("modular_inverses: inplace")
+{
+    using Modular = saga::static_modular_integer<1'000'000'007>;
+
+    saga_test::property_checker << [](std::vector<std::uint32_t> const & values)
+    {
+        std::vector<Modular> inverses;
+
+        for(auto const & value : values)
+        {
+            if(value % Modular::modulus() != 0)
+            {
+                inverses.emplace_back(value);
+            }
+        }
+
+        auto const original = inverses;
+
+        auto const result = saga::modular_inverses(saga::cursor::all(inverses)
+                                                   , saga::cursor::all(inverses));
+
+        REQUIRE(!result.in);
+        REQUIRE(!result.out);
+
+        for(auto index = std::size_t(0); index < inverses.size(); ++index)
+        {
+            REQUIRE(inverses[index] == original[index].inverse());
+        }
+    };
+}
+
+TEST_CASE("modular_inverses: shorter output")
+{
+    using Modular = saga::static_modular_integer<1'000'000'007>;
+
+    saga_test::property_checker << [](std::vector<std::uint32_t> const & values)
+    {
+        std::vector<Modular> original;
+
+        for(auto const & value : values)
+        {
+            if(value % Modular::modulus() != 0)
+            {
+                original.emplace_back(value);
+            }
+        }
+
+        std::vector<Modular> inverses(original.size() / 2, Modular(0));
+
+        auto const result = saga::modular_inverses(saga::cursor::all(original)
+                                                   , saga::cursor::all(inverses));
+
+        REQUIRE(!result.in);
+        REQUIRE(!result.out);
+
+        for(auto index = std::size_t(0); index < inverses.size(); ++index)
+        {
+            REQUIRE(inverses[index] == original[index].inverse());
+        }
+    };
+}
+
+TEST_CASE("modular_integer: inverses_modulo_prime")
+{
+    using Small = saga::static_modular_integer<7919>;
+
+    auto const all = saga::inverses_modulo_prime(saga::in_place_type<Small>);
+
+    auto const expected = saga::inverses_modulo_prime(std::uint64_t(7919));
+
+    REQUIRE(all.size() == expected.size());
+
+    for(auto num = std::size_t(1); num < all.size(); ++num)
+    {
+        REQUIRE(all[num] == Small(num).inverse());
+        REQUIRE(all[num].value() == expected[num]);
+    }
+
+    using Wide = saga::static_modular_integer<(std::uint64_t(1) << 61) - 1>;
+
+    auto const num_end = saga_test::random_uniform(std::size_t(2), std::size_t(10'000));
+
+    auto const inverses = saga::inverses_modulo_prime(saga::in_place_type<Wide>, num_end);
+
+    REQUIRE(inverses.size() == num_end);
+
+    for(auto num = std::size_t(1); num < num_end; ++num)
+    {
+        REQUIRE(inverses[num] * Wide(num) == Wide(1));
+    }
+}
+
+TEST_CASE("modular_integer: legendre_symbol and sqrt_modulo_prime")
+{
+    using Modular = saga::static_modular_integer<1'000'000'009>;
+
+    saga_test::property_checker << [](std::uint64_t num)
+    {
+        auto const square = Modular(num) * Modular(num);
+
+        REQUIRE(saga::legendre_symbol(square) == (square == Modular(0) ? 0 : 1));
+
+        auto const root = saga::sqrt_modulo_prime(square, saga::unsafe_tag_t{});
+
+        REQUIRE(root * root == square);
+        REQUIRE((root == Modular(num) || root == -Modular(num)));
+
+        auto const expected = saga::legendre_symbol(static_cast<std::int64_t>(num % 1'000'000'009)
+                                                    , std::int64_t(1'000'000'009));
+
+        REQUIRE(saga::legendre_symbol(Modular(num)) == expected);
+    };
+
+    // Модуль больше 2^32, сравнимый с 1 по модулю 8
+    using Wide = saga::static_modular_integer<(std::uint64_t(1) << 62) - 87>;
+
+    saga_test::property_checker << [](std::uint64_t num)
+    {
+        auto const square = Wide(num) * Wide(num);
+        auto const root = saga::sqrt_modulo_prime(square, saga::unsafe_tag_t{});
+
+        REQUIRE(root * root == square);
+    };
+}
@@ -0,0 +1,142 @@
+/* (c) 2026 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки SAGA.
+
+SAGA -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+// Тестируемый файл
+#include <saga/numeric/montgomery.hpp>
+
+// Инфраструктура тестирования
+#include "../saga_test.hpp"
+#include <catch2/catch_amalgamated.hpp>
+
+// Вспомогательные файлы
+#include <cstdint>
+
+// Тесты
+namespace
+{
+    // Умножение по модулю без 128-битных чисел: сложение с удвоением
+    std::uint64_t multiply_modulo_slow(std::uint64_t lhs, std::uint64_t rhs, std::uint64_t mod)
+    {
+        lhs %= mod;
+        rhs %= mod;
+
+        auto result = std::uint64_t(0);
+
+        for(; rhs > 0; rhs /= 2)
+        {
+            if(rhs % 2 == 1)
+            {
+                result = (result >= mod - lhs) ? result - (mod - lhs) : result + lhs;
+            }
+
+            lhs = (lhs >= mod - lhs) ? lhs - (mod - lhs) : lhs + lhs;
+        }
+
+        return result;
+    }
+}
+
+TEST_CASE("multiply_wide_64")
+{
+    saga_test::property_checker << [](std::uint32_t a1, std::uint32_t a0
+                                      , std::uint32_t b1, std::uint32_t b0)
+    {
+        auto const lhs = (std::uint64_t(a1) << 32) | a0;
+        auto const rhs = (std::uint64_t(b1) << 32) | b0;
+
+        auto const product = saga::detail::multiply_wide_64(lhs, rhs);
+
+        REQUIRE(product.low == lhs * rhs);
+
+        // Проверка старшей части по модулю 2^32 - 5
+        auto const mod = std::uint64_t(4'294'967'291);
+        auto const two_64 = multiply_modulo_slow(std::uint64_t(1) << 32, std::uint64_t(1) << 32
+                                                , mod);
+        auto const expected = multiply_modulo_slow(lhs, rhs, mod);
+        auto const actual = (multiply_modulo_slow(product.high, two_64, mod) + product.low % mod)
+                          % mod;
+
+        REQUIRE(actual == expected);
+    };
+}
+
+TEST_CASE("divide_wide_64")
+{
+    saga_test::property_checker << [](std::uint32_t d1, std::uint32_t d0, std::uint64_t high
+                                      , std::uint64_t low, std::uint8_t shift)
+    {
+        auto const divisor = (((std::uint64_t(d1) << 32) | d0) >> (shift % 64)) | 1;
+        high %= divisor;
+
+        auto const result = saga::detail::divide_wide_64_portable(high, low, divisor);
+
+        REQUIRE(result.remainder < divisor);
+
+        auto const product = saga::detail::multiply_wide_64(result.quotient, divisor);
+        auto const sum_low = product.low + result.remainder;
+        auto const sum_high = product.high + (sum_low < product.low);
+
+        REQUIRE(sum_low == low);
+        REQUIRE(sum_high == high);
+
+        auto const native = saga::detail::divide_wide_64(high, low, divisor);
+
+        REQUIRE(native.quotient == result.quotient);
+        REQUIRE(native.remainder == result.remainder);
+    };
+}
+
+TEST_CASE("montgomery_64: multiply, power")
+{
+    saga_test::property_checker << [](std::uint32_t m1, std::uint32_t m0
+                                      , std::uint32_t a, std::uint32_t b, std::uint16_t exponent)
+    {
+        auto const mod = ((std::uint64_t(m1) << 32) | m0) | 1;
+
+        if(mod == 1)
+        {
+            return;
+        }
+
+        auto const lhs = std::uint64_t(a) * 0x9E37'79B9u;
+        auto const rhs = std::uint64_t(b) << 31;
+
+        auto const mont = saga::montgomery_64(mod);
+
+        auto const lhs_m = mont.to_montgomery(lhs);
+        auto const rhs_m = mont.to_montgomery(rhs);
+
+        REQUIRE(mont.from_montgomery(lhs_m) == lhs % mod);
+        REQUIRE(mont.from_montgomery(mont.one()) == 1);
+        REQUIRE(mont.from_montgomery(mont.multiply(lhs_m, rhs_m))
+                == multiply_modulo_slow(lhs, rhs, mod));
+        auto const lhs_r = lhs % mod;
+        auto const rhs_r = rhs % mod;
+        auto const sum = (lhs_r >= mod - rhs_r) ? lhs_r - (mod - rhs_r) : lhs_r + rhs_r;
+
+        REQUIRE(mont.from_montgomery(mont.add(lhs_m, rhs_m)) == sum);
+        REQUIRE(mont.add(mont.subtract(lhs_m, rhs_m), rhs_m) == lhs_m);
+
+        auto expected = std::uint64_t(1);
+        for(auto index = 0; index < exponent; ++index)
+        {
+            expected = multiply_modulo_slow(expected, lhs, mod);
+        }
+
+        REQUIRE(mont.from_montgomery(mont.power(lhs_m, exponent)) == expected);
+    };
+}
@@ -0,0 +1,134 @@
+/* (c) 2026 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки SAGA.
+
+SAGA -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+// Тестируемый файл
+#include <saga/numeric/parallel_sieve.hpp>
+
+// Инфраструктура тестирования
+#include "../saga_test.hpp"
+#include <catch2/catch_amalgamated.hpp>
+
+// Вспомогательные файлы
+#include <saga/algorithm.hpp>
+#include <saga/numeric.hpp>
+
+#include <cstdint>
+#include <vector>
+
+// Тесты
+TEST_CASE("copy_primes_in_parallel: small intervals")
+{
+    saga_test::property_checker << [](std::uint16_t lo, std::uint16_t len, std::uint8_t threads)
+    {
+        std::int64_t const hi = lo + len;
+
+        std::vector<std::int64_t> expected;
+        saga::copy(saga::cursor::primes_in(std::int64_t(lo), hi), saga::back_inserter(expected));
+
+        std::vector<std::int64_t> actual;
+        saga::copy_primes_in_parallel(std::int64_t(lo), hi, saga::back_inserter(actual)
+                                      , threads % 4 + 1);
+
+        REQUIRE(actual == expected);
+    };
+}
+
+TEST_CASE("copy_primes_in_parallel: many chunks, ordered output")
+{
+    auto const lo = std::uint64_t(1'000'000'000);
+    auto const hi = lo + 60'000'000;
+
+    for(auto threads : {1u, 2u, 4u})
+    {
+        std::vector<std::uint64_t> expected;
+        saga::copy(saga::cursor::primes_in(lo, hi), saga::back_inserter(expected));
+
+        std::vector<std::uint64_t> actual;
+        saga::copy_primes_in_parallel(lo, hi, saga::back_inserter(actual), threads);
+
+        CAPTURE(threads);
+        REQUIRE(actual == expected);
+    }
+}
+
+namespace
+{
+    struct output_error
+    {};
+
+    // Выходной курсор, порождающий исключение при записи заданного элемента
+    struct throwing_output
+    {
+        throwing_output & operator<<(std::uint64_t)
+        {
+            if(++this->written == this->limit)
+            {
+                throw output_error{};
+            }
+
+            return *this;
+        }
+
+        std::size_t limit = 0;
+        std::size_t written = 0;
+    };
+}
+
+TEST_CASE("copy_primes_in_parallel: exception in output")
+{
+    for(auto threads : {1u, 4u})
+    {
+        auto const action = [&]
+        {
+            saga::copy_primes_in_parallel(std::uint64_t(0), std::uint64_t(100'000'000)
+                                          , throwing_output{1'000'000}, threads);
+        };
+
+        REQUIRE_THROWS_AS(action(), output_error);
+    }
+}
+
+TEST_CASE("prime_count, prime_sum: small values")
+{
+    saga_test::property_checker << [](std::uint16_t n_max, std::uint8_t threads)
+    {
+        auto const primes = saga::primes_below(std::int64_t(n_max) + 1);
+
+        REQUIRE(saga::prime_count(std::int64_t(n_max), threads % 4 + 1)
+                == std::int64_t(primes.size()));
+        REQUIRE(saga::prime_sum(std::int64_t(n_max), threads % 4 + 1)
+                == saga::reduce(saga::cursor::all(primes)));
+    };
+}
+
+TEST_CASE("prime_count, prime_sum: known values")
+{
+    CHECK(saga::prime_count(-1) == 0);
+    CHECK(saga::prime_count(1) == 0);
+    CHECK(saga::prime_count(2) == 1);
+    CHECK(saga::prime_count(30) == 10);
+    CHECK(saga::prime_count(31) == 11);
+    CHECK(saga::prime_count(std::int64_t(10'000'000)) == 664'579);
+
+    for(auto threads : {1u, 3u})
+    {
+        CHECK(saga::prime_count(std::int64_t(100'000'000), threads) == 5'761'455);
+        CHECK(saga::prime_sum(std::int64_t(2'000'000), threads) == 142'913'828'922);
+    }
+
+    CHECK(saga::prime_sum(10) == 17);
+}
@@ -25,10 +25,16 @@ SAGA -- это свободной программное обеспечение:
 // Вспомогательные файлы
 #include <saga/action/reverse.hpp>
 #include <saga/algorithm.hpp>
+#include <saga/cursor/reverse.hpp>
 #include <saga/cursor/subrange.hpp>
 #include <saga/cursor/to.hpp>
 #include <saga/numeric/digits_of.hpp>
 
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
 // Тесты
 TEST_CASE("polynomial_horner for binary code")
 {
@@ -48,3 +54,360 @@ TEST_CASE("polynomial_horner for binary code")
         REQUIRE(result == value);
     };
 }
+
+namespace
+{
+    using Friendly = saga::static_modular_integer<998'244'353>;
+    using Arbitrary = saga::static_modular_integer<1'000'000'007>;
+    using Composite = saga::static_modular_integer<1'000'000>;
+
+    template <class Modular>
+    std::vector<Modular> random_polynomial(std::size_t size)
+    {
+        std::vector<Modular> result;
+
+        for(auto index = std::size_t(0); index < size; ++index)
+        {
+            result.emplace_back(saga_test::random_uniform(std::uint64_t(0), Modular::modulus()));
+        }
+
+        return result;
+    }
+
+    template <class Modular>
+    void check_polynomial_multiply(std::size_t lhs_size, std::size_t rhs_size)
+    {
+        CAPTURE(Modular::modulus(), lhs_size, rhs_size);
+
+        auto const lhs = random_polynomial<Modular>(lhs_size);
+        auto const rhs = random_polynomial<Modular>(rhs_size);
+
+        REQUIRE(saga::polynomial_multiply(lhs, rhs)
+                == saga::detail::polynomial_multiply_basecase(lhs, rhs));
+        REQUIRE(saga::polynomial_multiply(lhs, lhs)
+                == saga::detail::polynomial_multiply_basecase(lhs, lhs));
+    }
+}
+
+namespace
+{
+    struct primitive_root_tag {};
+}
+
+TEST_CASE("primitive_root: runtime modulus")
+{
+    using Modulus = saga::runtime_modulus<primitive_root_tag>;
+    using Modular = saga::modular_integer<Modulus>;
+
+    // Корень запоминается, но должен пересчитываться при смене модуля
+    for(auto prime : {13u, 23u, 1'000'000'007u, 998'244'353u, 13u, 23u})
+    {
+        Modulus::set_modulus(prime);
+
+        auto const root = saga::detail::primitive_root<Modular>();
+
+        CAPTURE(prime, root);
+
+        REQUIRE(root == saga::detail::find_primitive_root<Modular>());
+
+        auto const order = std::uint64_t(prime - 1);
+
+        for(auto const & factor : saga::factorize(order))
+        {
+            REQUIRE(root.power(order / factor.prime) != Modular(1));
+        }
+    }
+}
+
+TEST_CASE("polynomial_multiply")
+{
+    for(auto sizes : {std::pair<std::size_t, std::size_t>(1, 1), {1, 100}, {63, 64}, {64, 64}
+                     , {100, 300}, {500, 700}, {1024, 1025}})
+    {
+        check_polynomial_multiply<Friendly>(sizes.first, sizes.second);
+        check_polynomial_multiply<Arbitrary>(sizes.first, sizes.second);
+        check_polynomial_multiply<Composite>(sizes.first, sizes.second);
+    }
+
+    CHECK(saga::polynomial_multiply(std::vector<Friendly>{}, std::vector<Friendly>{1, 2}).empty());
+}
+
+TEST_CASE("polynomial_multiply: maximal coefficients")
+{
+    // Коэффициенты точного произведения близки к верхней границе для восстановления по трём модулям
+    using Modular = saga::static_modular_integer<(std::uint64_t(1) << 31) - 1>;
+
+    std::vector<Modular> const poly(3000, Modular(-1));
+
+    auto const product = saga::polynomial_multiply(poly, poly);
+
+    REQUIRE(product == saga::detail::polynomial_multiply_basecase(poly, poly));
+}
+
+TEST_CASE("polynomial_inverse")
+{
+    for(auto size : {1, 2, 10, 100, 1000, 3000})
+    {
+        CAPTURE(size);
+
+        auto series = random_polynomial<Arbitrary>(size);
+        series.front() = Arbitrary(1) + Arbitrary(saga_test::random_uniform(0, 1000));
+
+        for(auto num : {std::size_t(size), std::size_t(2 * size + 1)})
+        {
+            auto product = saga::polynomial_multiply(series, saga::polynomial_inverse(series, num));
+            product.resize(num);
+
+            std::vector<Arbitrary> expected(num);
+            expected.front() = Arbitrary(1);
+
+            REQUIRE(product == expected);
+        }
+    }
+}
+
+TEST_CASE("polynomial_inverse: partition numbers")
+{
+    // 1 / prod(1 - x^k) -- производящая функция числа разбиений, знаменатель задаётся
+    // пентагональной теоремой Эйлера
+    auto const num = std::size_t(60'000);
+
+    std::vector<Composite> euler(num);
+
+    for(auto k = std::int64_t(0);; ++k)
+    {
+        auto const sign = (k % 2 == 0) ? Composite(1) : Composite(-1);
+        auto const first = k * (3 * k - 1) / 2;
+        auto const second = k * (3 * k + 1) / 2;
+
+        if(first >= std::int64_t(num))
+        {
+            break;
+        }
+
+        euler[first] = sign;
+
+        if(k > 0 && second < std::int64_t(num))
+        {
+            euler[second] = sign;
+        }
+    }
+
+    auto const partitions = saga::polynomial_inverse(euler, num);
+
+    REQUIRE(partitions[5] == Composite(7));
+    REQUIRE(partitions[100] == Composite(190'569'292));
+
+    // PE 078
+    auto const pos = std::find(partitions.begin(), partitions.end(), Composite(0));
+    REQUIRE(pos - partitions.begin() == 55'374);
+}
+
+TEST_CASE("polynomial_log")
+{
+    // log(1 / (1 - x)) = sum x^k / k
+    auto const num = std::size_t(2000);
+
+    std::vector<Friendly> const geometric(num, Friendly(1));
+    auto const series = saga::polynomial_inverse(std::vector<Friendly>{1, -1}, num);
+
+    REQUIRE(series == geometric);
+
+    auto const log = saga::polynomial_log(series, num);
+
+    REQUIRE(log[0] == Friendly(0));
+
+    for(auto index = std::size_t(1); index < num; ++index)
+    {
+        REQUIRE(log[index] * Friendly(index) == Friendly(1));
+    }
+}
+
+TEST_CASE("polynomial_log: derivative")
+{
+    for(auto size : {2, 50, 700})
+    {
+        CAPTURE(size);
+
+        auto series = random_polynomial<Arbitrary>(size);
+        series.front() = Arbitrary(1);
+
+        auto const num = std::size_t(size + 10);
+        auto const log = saga::polynomial_log(series, num);
+
+        // (log f)' f = f'
+        std::vector<Arbitrary> log_derivative;
+        std::vector<Arbitrary> derivative(num - 1);
+
+        for(auto index = std::size_t(1); index < num; ++index)
+        {
+            log_derivative.push_back(log[index] * Arbitrary(index));
+
+            if(index < series.size())
+            {
+                derivative[index - 1] = series[index] * Arbitrary(index);
+            }
+        }
+
+        auto product = saga::polynomial_multiply(log_derivative, series);
+        product.resize(num - 1);
+
+        REQUIRE(product == derivative);
+    }
+}
+
+TEST_CASE("polynomial_evaluate")
+{
+    for(auto sizes : {std::pair<std::size_t, std::size_t>(0, 5), {1, 0}, {5, 3}, {100, 300}
+                     , {1000, 500}, {300, 2000}})
+    {
+        CAPTURE(sizes.first, sizes.second);
+
+        auto const poly = random_polynomial<Friendly>(sizes.first);
+        auto const points = random_polynomial<Friendly>(sizes.second);
+
+        auto const values = saga::polynomial_evaluate(poly, points);
+
+        REQUIRE(values.size() == points.size());
+
+        for(auto index = std::size_t(0); index < points.size(); ++index)
+        {
+            auto const expected
+                = saga::polynomial_horner(saga::cursor::all(poly) | saga::cursor::reverse
+                                         , points[index], Friendly(0));
+
+            REQUIRE(values[index] == expected);
+        }
+    }
+}
+
+namespace
+{
+    template <class Modular>
+    void check_polynomial_batch(std::size_t num_coefficients, std::size_t num_points)
+    {
+        CAPTURE(num_coefficients, num_points);
+
+        auto const poly = random_polynomial<Modular>(num_coefficients);
+        auto const points = random_polynomial<Modular>(num_points);
+
+        std::vector<Modular> horner(points.size());
+        saga::polynomial_horner(saga::cursor::all(poly), saga::cursor::all(points)
+                               , saga::cursor::all(horner));
+
+        std::vector<Modular> estrin(points.size());
+        saga::polynomial_estrin(saga::cursor::all(poly), saga::cursor::all(points)
+                               , saga::cursor::all(estrin));
+
+        for(auto index = std::size_t(0); index < points.size(); ++index)
+        {
+            auto const expected
+                = saga::polynomial_horner(saga::cursor::all(poly), points[index], Modular(0));
+
+            REQUIRE(horner[index] == expected);
+            REQUIRE(estrin[index] == expected);
+        }
+
+        auto in_place = points;
+        saga::polynomial_horner(saga::cursor::all(poly), saga::cursor::all(in_place)
+                               , saga::cursor::all(in_place));
+
+        REQUIRE(in_place == horner);
+
+        // Выходной курсор, не являющийся непрерывным
+        std::vector<Modular> appended;
+        auto const appended_result
+            = saga::polynomial_estrin(saga::cursor::all(poly), saga::cursor::all(points)
+                                     , saga::back_inserter(appended));
+
+        REQUIRE(appended == horner);
+        REQUIRE(!appended_result.in);
+
+        // Выходной курсор короче курсора точек
+        std::vector<Modular> prefix(points.size() / 2);
+        auto const prefix_result
+            = saga::polynomial_horner(saga::cursor::all(poly), saga::cursor::all(points)
+                                     , saga::cursor::all(prefix));
+
+        REQUIRE(static_cast<std::size_t>(prefix_result.in.size()) == points.size() - prefix.size());
+        REQUIRE(!prefix_result.out);
+        REQUIRE(std::equal(prefix.begin(), prefix.end(), horner.begin()));
+    }
+
+    template <class Real>
+    void check_polynomial_batch_real(std::size_t num_coefficients, std::size_t num_points)
+    {
+        CAPTURE(num_coefficients, num_points);
+
+        std::vector<Real> poly;
+        auto abs_sum = Real(0);
+
+        for(auto index = std::size_t(0); index < num_coefficients; ++index)
+        {
+            poly.push_back(saga_test::random_uniform(Real(-1), Real(1)));
+            abs_sum += std::abs(poly.back());
+        }
+
+        std::vector<Real> points;
+
+        for(auto index = std::size_t(0); index < num_points; ++index)
+        {
+            points.push_back(saga_test::random_uniform(Real(-1), Real(1)));
+        }
+
+        std::vector<Real> horner(points.size());
+        saga::polynomial_horner(saga::cursor::all(poly), saga::cursor::all(points)
+                               , saga::cursor::all(horner));
+
+        std::vector<Real> estrin(points.size());
+        saga::polynomial_estrin(saga::cursor::all(poly), saga::cursor::all(points)
+                               , saga::cursor::all(estrin));
+
+        auto const tolerance
+            = Real(4 * num_coefficients + 4) * std::numeric_limits<Real>::epsilon() * abs_sum;
+
+        for(auto index = std::size_t(0); index < points.size(); ++index)
+        {
+            auto const expected
+                = saga::polynomial_horner(saga::cursor::all(poly), points[index], Real(0));
+
+            CAPTURE(index, points[index], expected, horner[index], estrin[index]);
+
+            REQUIRE(std::abs(horner[index] - expected) <= tolerance);
+            REQUIRE(std::abs(estrin[index] - expected) <= tolerance);
+        }
+    }
+}
+
+TEST_CASE("polynomial_horner, polynomial_estrin: many points")
+{
+    for(auto sizes : {std::pair<std::size_t, std::size_t>(0, 5), {1, 0}, {1, 7}, {2, 3}
+                     , {5, 33}, {8, 64}, {17, 71}, {40, 200}})
+    {
+        check_polynomial_batch<Arbitrary>(sizes.first, sizes.second);
+        check_polynomial_batch_real<double>(sizes.first, sizes.second);
+        check_polynomial_batch_real<float>(sizes.first, sizes.second);
+    }
+}
+
+TEST_CASE("polynomial_horner: many points, integer coefficients")
+{
+    saga_test::property_checker
+    << [](std::vector<std::int32_t> const & poly, std::vector<std::int32_t> const & points)
+    {
+        std::vector<std::uint64_t> const points_64(points.begin(), points.end());
+        std::vector<std::uint64_t> values(points.size());
+
+        saga::polynomial_horner(saga::cursor::all(poly), saga::cursor::all(points_64)
+                               , saga::cursor::all(values));
+
+        for(auto index = std::size_t(0); index < points.size(); ++index)
+        {
+            auto const expected
+                = saga::polynomial_horner(saga::cursor::all(poly), points_64[index]
+                                         , std::uint64_t(0));
+
+            REQUIRE(values[index] == expected);
+        }
+    };
+}
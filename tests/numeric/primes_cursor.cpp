@@ -0,0 +1,93 @@
+/* (c) 2026 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки SAGA.
+
+SAGA -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+// Тестируемый файл
+#include <saga/numeric/primes_cursor.hpp>
+
+// Инфраструктура тестирования
+#include "../saga_test.hpp"
+#include <catch2/catch_amalgamated.hpp>
+
+// Вспомогательные файлы
+#include <saga/numeric.hpp>
+
+#include <cstdint>
+
+// Тесты
+TEST_CASE("primes_cursor: front contains all primes found so far")
+{
+    auto const expected = saga::primes_below(std::int64_t(200'000));
+
+    auto cur = saga::primes_cursor<std::int64_t>();
+
+    REQUIRE(!!cur);
+    REQUIRE(cur.front() == std::vector<std::int64_t>{2});
+
+    for(auto index = std::size_t(1); index < expected.size(); ++index)
+    {
+        ++cur;
+
+        REQUIRE(cur->size() == index + 1);
+        REQUIRE(cur->back() == expected[index]);
+    }
+
+    REQUIRE(*cur == expected);
+}
+
+TEST_CASE("primes_cursor: 10001st prime")
+{
+    auto const cur = saga::cursor::drop_front_n(saga::primes_cursor<int>(), 10'000);
+
+    REQUIRE(cur->size() == 10'001);
+    REQUIRE(cur->back() == 104'743);
+}
+
+namespace
+{
+    template <class IntType>
+    void check_primes_cursor_runs_to_the_end()
+    {
+        using Wide = long long;
+
+        std::vector<IntType> expected;
+
+        for(auto num = Wide(2); num <= Wide(std::numeric_limits<IntType>::max()); ++num)
+        {
+            if(saga::is_prime(num))
+            {
+                expected.push_back(IntType(num));
+            }
+        }
+
+        auto cur = saga::primes_cursor<IntType>();
+
+        for(; !!cur; ++cur)
+        {
+            REQUIRE(cur->size() <= expected.size());
+        }
+
+        REQUIRE(*cur == expected);
+    }
+}
+
+TEST_CASE("primes_cursor: narrow types run to the end")
+{
+    ::check_primes_cursor_runs_to_the_end<std::int8_t>();
+    ::check_primes_cursor_runs_to_the_end<std::uint8_t>();
+    ::check_primes_cursor_runs_to_the_end<std::int16_t>();
+    ::check_primes_cursor_runs_to_the_end<std::uint16_t>();
+}
@@ -0,0 +1,171 @@
+/* (c) 2026 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки SAGA.
+
+SAGA -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+// Тестируемый файл
+#include <saga/numeric/segmented_sieve.hpp>
+
+// Инфраструктура тестирования
+#include "../saga_test.hpp"
+#include <catch2/catch_amalgamated.hpp>
+
+// Вспомогательные файлы
+#include <saga/numeric.hpp>
+
+#include <cstdint>
+#include <vector>
+
+// Тесты
+namespace
+{
+    // Простые числа, меньшие n_max: несегментированное решето по нечётным числам
+    std::vector<std::uint64_t> primes_below_reference(std::uint64_t n_max)
+    {
+        std::vector<std::uint64_t> result;
+
+        if(n_max <= 2)
+        {
+            return result;
+        }
+
+        result.push_back(2);
+
+        std::vector<unsigned short> seive((n_max - 2) / 2, true);
+        saga::eratosthenes_seive(saga::cursor::all(seive));
+
+        for(auto index = std::size_t(0); index < seive.size(); ++index)
+        {
+            if(seive[index])
+            {
+                result.push_back(2 * index + 3);
+            }
+        }
+
+        return result;
+    }
+
+    bool is_prime_by_trial_division(std::uint64_t num)
+    {
+        if(num < 2)
+        {
+            return false;
+        }
+
+        for(auto divisor = std::uint64_t(2); divisor * divisor <= num; ++divisor)
+        {
+            if(num % divisor == 0)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
+
+TEST_CASE("wheel30 tables")
+{
+    auto const & wheel = saga::detail::wheel30;
+
+    for(auto prime = 0; prime < 8; ++prime)
+    {
+        for(auto mult = 0; mult < 8; ++mult)
+        {
+            auto const product = wheel.residues[prime] * wheel.residues[mult];
+
+            REQUIRE(wheel.residues[wheel.bit[prime][mult]] == product % 30);
+        }
+    }
+
+    for(auto rest = 0; rest < 30; ++rest)
+    {
+        REQUIRE(wheel.index[(rest + wheel.to_coprime[rest]) % 30] < 8);
+    }
+}
+
+TEST_CASE("primes_in: small intervals, various segment sizes")
+{
+    saga_test::property_checker << [](std::uint16_t lo, std::uint16_t len, std::uint8_t segment)
+    {
+        std::uint64_t const hi = lo + len;
+
+        auto const all = primes_below_reference(hi);
+
+        std::vector<std::uint64_t> expected;
+        for(auto const & prime : all)
+        {
+            if(prime >= lo)
+            {
+                expected.push_back(prime);
+            }
+        }
+
+        std::vector<std::uint64_t> result;
+        for(auto cur = saga::primes_in_cursor<std::uint64_t>(lo, hi, segment); !!cur; ++cur)
+        {
+            result.push_back(*cur);
+        }
+
+        REQUIRE(result == expected);
+    };
+}
+
+TEST_CASE("primes_in: default segment size")
+{
+    auto const n_max = std::uint64_t(3'000'000);
+
+    auto const expected = primes_below_reference(n_max);
+
+    std::vector<std::uint64_t> result;
+    saga::copy(saga::cursor::primes_in(std::uint64_t(0), n_max), saga::back_inserter(result));
+
+    REQUIRE(result == expected);
+}
+
+TEST_CASE("primes_in: signed type, empty intervals")
+{
+    REQUIRE(!saga::cursor::primes_in(-10, 2));
+    REQUIRE(!saga::cursor::primes_in(10, 10));
+    REQUIRE(!saga::cursor::primes_in(24, 29));
+    REQUIRE(saga::cursor::primes_in(-10, 3).front() == 2);
+}
+
+TEST_CASE("primes_in: interval near 10^11")
+{
+    auto const lo = std::uint64_t(100'000'000'000);
+    auto const hi = lo + 10'000;
+
+    std::vector<std::uint64_t> expected;
+    for(auto num = lo; num < hi; ++num)
+    {
+        if(is_prime_by_trial_division(num))
+        {
+            expected.push_back(num);
+        }
+    }
+
+    std::vector<std::uint64_t> result;
+    saga::copy(saga::cursor::primes_in(lo, hi), saga::back_inserter(result));
+
+    REQUIRE(result == expected);
+}
+
+TEST_CASE("primes_below: prime counting")
+{
+    CHECK(saga::primes_below(100).size() == 25);
+    CHECK(saga::primes_below(10'000).size() == 1'229);
+    CHECK(saga::primes_below(10'000'000).size() == 664'579);
+}
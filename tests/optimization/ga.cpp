@@ -28,6 +28,7 @@ SAGA -- это свободной программное обеспечение:
 #include <saga/cpp20/span.hpp>
 #include <saga/cursor/indices.hpp>
 #include <saga/cursor/to.hpp>
+#include <saga/memory/arena_resource.hpp>
 #include <saga/numeric/digits_of.hpp>
 #include <saga/optimization/test_objectives.hpp>
 
@@ -140,6 +141,53 @@ TEST_CASE("GA_boolean_cycle: empty population")
     REQUIRE(population.empty());
 }
 
+TEST_CASE("GA_boolean_cycle: population and genotypes from memory resource")
+{
+    auto const dim = 20;
+    auto const population_size = 50;
+
+    using Genotype = std::pmr::vector<char>;
+    using Individual = saga::evaluated_solution<Genotype, double>;
+    using Population = std::pmr::vector<Individual>;
+
+    auto const objective = [](Genotype const & arg) -> double
+    {
+        return saga::boolean_manhattan_norm(arg);
+    };
+
+    auto const problem = saga::make_optimization_problem_boolean(objective, dim);
+
+    saga::GA_settings<Genotype, saga::ga_boolean_crossover_uniform_fn, saga::selection_tournament>
+        settings;
+    settings.population_size = population_size;
+
+    saga::arena_resource arena;
+
+    auto population
+        = saga::ga_boolen_initial_population<Population>(population_size, dim, objective
+                                                        , saga_test::random_engine()
+                                                        , Population::allocator_type(&arena));
+
+    REQUIRE(population.size() == static_cast<std::size_t>(population_size));
+    REQUIRE(population.get_allocator().resource() == &arena);
+
+    for(auto const & individual : population)
+    {
+        REQUIRE(individual.solution.size() == static_cast<std::size_t>(dim));
+        REQUIRE(individual.solution.get_allocator().resource() == &arena);
+        REQUIRE(individual.objective_value == Catch::Approx(objective(individual.solution)));
+    }
+
+    saga::for_n(3, [&]
+    {
+        ::saga::genetic_algorithm_boolean_cycle(population, problem, settings
+                                                , saga_test::random_engine());
+
+        REQUIRE(population.size() == static_cast<std::size_t>(population_size));
+        REQUIRE(population.get_allocator().resource() == &arena);
+    });
+}
+
 TEST_CASE("GA boolean : manhattan distance, tournament selection")
 {
     for(auto tournament : saga::cursor::indices(2, 5))
@@ -76,6 +76,24 @@ TEST_CASE("iid_distribution<bernoully_distribution, std::vector>")
     };
 }
 
+#include <memory_resource>
+
+TEST_CASE("iid_distribution<bernoully_distribution, std::pmr::vector>: allocator")
+{
+    saga_test::property_checker << [](saga_test::container_size<std::size_t> const dim)
+    {
+        saga::iid_distribution<std::bernoulli_distribution, std::pmr::vector<bool>> distr(dim);
+
+        std::pmr::monotonic_buffer_resource resource;
+        std::pmr::polymorphic_allocator<bool> const alloc(&resource);
+
+        auto const value = distr(saga_test::random_engine(), alloc);
+
+        REQUIRE(value.size() == dim);
+        REQUIRE(value.get_allocator() == alloc);
+    };
+}
+
 TEST_CASE("iid_distribution<normal_distribution, std::valarray>")
 {
     saga_test::property_checker
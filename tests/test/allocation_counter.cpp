@@ -0,0 +1,114 @@
+/* (c) 2026 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки SAGA.
+
+SAGA -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+// Тестируемый файл
+// Замена операторов new и delete для всей программы тестирования
+#define SAGA_TEST_DEFINE_COUNTING_OPERATOR_NEW
+#include <saga/test/allocation_counter.hpp>
+
+// Тестовая инфраструктура
+#include <catch2/catch_amalgamated.hpp>
+#include "../saga_test.hpp"
+
+// Вспомогательные файлы
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// Тесты
+TEST_CASE("allocation_counter: no allocations")
+{
+    saga::allocation_counter const counter;
+
+    auto const counts = counter.counts();
+
+    REQUIRE(counts.allocations == 0);
+    REQUIRE(counts.deallocations == 0);
+    REQUIRE(counts.allocated_bytes == 0);
+}
+
+// Сам Catch2 может выделять память при проверках, поэтому значения счётчиков сохраняются до них
+TEST_CASE("allocation_counter: new and delete")
+{
+    saga_test::property_checker << [](int const & value)
+    {
+        saga::allocation_counter const counter;
+
+        auto ptr = std::make_unique<int>(value);
+        auto const counts_allocated = counter.counts();
+
+        ptr.reset();
+        auto const counts_deallocated = counter.counts();
+
+        REQUIRE(counts_allocated.allocations == 1);
+        REQUIRE(counts_allocated.deallocations == 0);
+        REQUIRE(counts_allocated.allocated_bytes >= static_cast<std::ptrdiff_t>(sizeof(int)));
+
+        REQUIRE(counts_deallocated.allocations == 1);
+        REQUIRE(counts_deallocated.deallocations == 1);
+    };
+}
+
+TEST_CASE("allocation_counter: vector reserve")
+{
+    saga_test::property_checker << [](saga_test::container_size<std::size_t> const & num)
+    {
+        saga::allocation_counter const counter;
+        saga::allocation_counts counts_reserved;
+
+        {
+            std::vector<long> values;
+            values.reserve(num.value + 1);
+
+            counts_reserved = counter.counts();
+        }
+
+        auto const counts_destroyed = counter.counts();
+
+        REQUIRE(counts_reserved.allocations == 1);
+        REQUIRE(counts_reserved.allocated_bytes
+                >= static_cast<std::ptrdiff_t>((num.value + 1) * sizeof(long)));
+        REQUIRE(counts_destroyed.deallocations == 1);
+    };
+}
+
+namespace
+{
+    struct alignas(64) over_aligned
+    {
+        char data[64] = {};
+    };
+}
+
+TEST_CASE("allocation_counter: over-aligned new and delete")
+{
+    saga::allocation_counter const counter;
+
+    auto ptr = std::make_unique<::over_aligned>();
+    auto const address = reinterpret_cast<std::uintptr_t>(ptr.get());
+    auto const counts_allocated = counter.counts();
+
+    ptr.reset();
+    auto const counts_deallocated = counter.counts();
+
+    REQUIRE(address % alignof(::over_aligned) == 0);
+
+    REQUIRE(counts_allocated.allocations == 1);
+    REQUIRE(counts_allocated.allocated_bytes >= static_cast<std::ptrdiff_t>(sizeof(::over_aligned)));
+
+    REQUIRE(counts_deallocated.deallocations == 1);
+}
@@ -0,0 +1,55 @@
+/* (c) 2026 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки SAGA.
+
+SAGA -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+// Тестируемый файл
+#include <saga/test/hardware_counters.hpp>
+
+// Тестовая инфраструктура
+#include <catch2/catch_amalgamated.hpp>
+
+// Вспомогательные файлы
+#include <numeric>
+#include <vector>
+
+// Тесты
+// Счётчики могут быть недоступны, в этом случае их значения должны быть равны -1
+TEST_CASE("hardware_counters: graceful degradation")
+{
+    saga::hardware_counters counters;
+
+    std::vector<long> values(1000);
+    std::iota(values.begin(), values.end(), 0);
+
+    counters.start();
+    auto const sum = std::accumulate(values.begin(), values.end(), 0L);
+    auto const counts = counters.stop();
+
+    REQUIRE(sum == 999 * 1000 / 2);
+
+    REQUIRE(counts.cycles >= -1);
+    REQUIRE(counts.instructions >= -1);
+    REQUIRE(counts.cache_misses >= -1);
+    REQUIRE(counts.branch_misses >= -1);
+
+    if(!counters.available())
+    {
+        REQUIRE(counts.cycles == -1);
+        REQUIRE(counts.instructions == -1);
+        REQUIRE(counts.cache_misses == -1);
+        REQUIRE(counts.branch_misses == -1);
+    }
+}
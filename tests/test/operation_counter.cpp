@@ -0,0 +1,76 @@
+/* (c) 2026 Галушин Павел Викторович, galushin@gmail.com
+
+Данный файл -- часть библиотеки SAGA.
+
+SAGA -- это свободной программное обеспечение: вы можете перераспространять ее и/или изменять ее
+на условиях Стандартной общественной лицензии GNU в том виде, в каком она была опубликована Фондом
+свободного программного обеспечения; либо версии 3 лицензии, либо (по вашему выбору) любой более
+поздней версии.
+
+Это программное обеспечение распространяется в надежде, что оно будет полезной, но БЕЗО ВСЯКИХ
+ГАРАНТИЙ; даже без неявной гарантии ТОВАРНОГО ВИДА или ПРИГОДНОСТИ ДЛЯ ОПРЕДЕЛЕННЫХ ЦЕЛЕЙ.
+Подробнее см. в Стандартной общественной лицензии GNU.
+
+Вы должны были получить копию Стандартной общественной лицензии GNU вместе с этим программным
+обеспечение. Если это не так, см. https://www.gnu.org/licenses/.
+*/
+
+// Тестируемый файл
+#include <saga/test/operation_counter.hpp>
+
+// Тестовая инфраструктура
+#include <catch2/catch_amalgamated.hpp>
+#include "../saga_test.hpp"
+
+// Вспомогательные файлы
+#include <functional>
+#include <utility>
+
+// Тесты
+TEST_CASE("operation_counter: regular_tracer")
+{
+    struct Tag{};
+    using Value = saga::regular_tracer<int, Tag>;
+
+    saga_test::property_checker << [](int const & value)
+    {
+        saga::operation_counter<Value> const counter;
+
+        Value original(value);
+        auto copy = original;
+        auto moved = std::move(copy);
+
+        REQUIRE(counter.counts().copies == 1);
+        REQUIRE(counter.counts().moves == 1);
+
+        copy = original;
+        moved = std::move(copy);
+
+        REQUIRE(counter.counts().copies == 2);
+        REQUIRE(counter.counts().moves == 2);
+
+        REQUIRE(moved == original);
+
+        REQUIRE(counter.counts().equality_comparisons == 1);
+        REQUIRE(counter.counts().invocations == 0);
+    };
+}
+
+TEST_CASE("operation_counter: invocable_tracer")
+{
+    struct Tag{};
+
+    saga_test::property_checker << [](int const & lhs, int const & rhs)
+    {
+        auto const cmp = saga::make_invocable_tracer<Tag>(std::less<>{});
+
+        saga::operation_counter<void, decltype(cmp)> const counter;
+
+        REQUIRE(cmp(lhs, rhs) == (lhs < rhs));
+        REQUIRE(cmp(rhs, lhs) == (rhs < lhs));
+
+        REQUIRE(counter.counts().invocations == 2);
+        REQUIRE(counter.counts().copies == 0);
+        REQUIRE(counter.counts().moves == 0);
+    };
+}